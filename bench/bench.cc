@@ -0,0 +1,355 @@
+// Throughput benchmarks for each phase of the pipeline, run over the
+// conformance corpus and over generated scripts of increasing size.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+# include <sys/resource.h>
+#endif
+
+#include "cxxopt.hh"
+#include "script_generator.hh"
+
+#include "tailslide.hh"
+#include "ast_serialization.hh"
+#include "passes/tree_simplifier.hh"
+#include "passes/lso/script_compiler.hh"
+#include "passes/mono/script_compiler.hh"
+
+using namespace Tailslide;
+namespace fs = std::filesystem;
+using BenchClock = std::chrono::steady_clock;
+
+enum BenchPhase {
+  PHASE_PARSE,
+  PHASE_SYMBOLS,
+  PHASE_TYPES,
+  PHASE_VALUES,
+  // loading the analyzed tree back from `serialize_script()`'s output
+  PHASE_RELOAD,
+  PHASE_OPTIMIZE,
+  PHASE_LSO,
+  PHASE_CIL,
+  PHASE_MAX,
+};
+
+static const char * const PHASE_NAMES[PHASE_MAX] = {
+    "lex/parse",
+    "symbols",
+    "types",
+    "values",
+    "ast reload",
+    "optimize",
+    "lso compile",
+    "cil compile",
+};
+
+struct BenchScript {
+  std::string name;
+  std::string source;
+};
+
+struct PhaseTotals {
+  double seconds = 0.0;
+  // how many scripts actually made it to this phase
+  uint64_t scripts = 0;
+  uint64_t bytes = 0;
+};
+
+struct BenchResult {
+  PhaseTotals phases[PHASE_MAX] {};
+  // biggest the parser's arena got for any one script
+  size_t peak_arena_bytes = 0;
+};
+
+class PhaseTimer {
+  public:
+    PhaseTimer(PhaseTotals &totals, size_t bytes) : _mTotals(totals), _mBytes(bytes), _mStart(BenchClock::now()) {}
+    ~PhaseTimer() {
+      _mTotals.seconds += std::chrono::duration<double>(BenchClock::now() - _mStart).count();
+      ++_mTotals.scripts;
+      _mTotals.bytes += _mBytes;
+    }
+  private:
+    PhaseTotals &_mTotals;
+    size_t _mBytes;
+    BenchClock::time_point _mStart;
+};
+
+// Run a script through every phase, recording how long each took
+static void bench_script(ScopedScriptParser &parser, ScopedScriptParser &reload_parser,
+                         const BenchScript &script, BenchResult &result) {
+  size_t len = script.source.size();
+  parser.reset();
+  {
+    PhaseTimer timer(result.phases[PHASE_PARSE], len);
+    parser.parseLSLBytes(script.source.c_str(), (int)len);
+  }
+  auto *lsl_script = parser.script;
+  if (!lsl_script)
+    return;
+  {
+    PhaseTimer timer(result.phases[PHASE_SYMBOLS], len);
+    lsl_script->collectSymbols();
+  }
+  {
+    PhaseTimer timer(result.phases[PHASE_TYPES], len);
+    lsl_script->determineTypes();
+    lsl_script->recalculateReferenceData();
+  }
+  {
+    PhaseTimer timer(result.phases[PHASE_VALUES], len);
+    lsl_script->propagateValues();
+    lsl_script->finalPass();
+  }
+  // nothing after this point is meant to deal with broken scripts
+  if (!parser.logger.getErrors()) {
+    {
+      std::string serialized = serialize_script(lsl_script);
+      reload_parser.reset();
+      PhaseTimer timer(result.phases[PHASE_RELOAD], len);
+      reload_parser.loadSerialized(serialized.data(), serialized.size());
+    }
+    {
+      PhaseTimer timer(result.phases[PHASE_OPTIMIZE], len);
+      OptimizationOptions optimization_options {};
+      optimization_options.fold_constants = true;
+      optimization_options.prune_unused_locals = true;
+      optimization_options.prune_unused_globals = true;
+      optimization_options.prune_unused_functions = true;
+      lsl_script->optimize(optimization_options);
+    }
+    {
+      PhaseTimer timer(result.phases[PHASE_LSO], len);
+      LSOScriptCompiler lso_visitor(&parser.allocator);
+      lsl_script->visit(&lso_visitor);
+    }
+    {
+      PhaseTimer timer(result.phases[PHASE_CIL], len);
+      MonoScriptCompiler mono_visitor(&parser.allocator);
+      lsl_script->visit(&mono_visitor);
+    }
+  }
+  result.peak_arena_bytes = std::max(result.peak_arena_bytes, parser.allocator.getStats().bytes_reserved);
+}
+
+static BenchResult run_bench(const std::vector<BenchScript> &scripts, unsigned int iterations) {
+  ScopedScriptParser parser(nullptr);
+  ScopedScriptParser reload_parser(nullptr);
+  // warm up caches and the parser's arena
+  BenchResult warmup;
+  for (auto &script : scripts)
+    bench_script(parser, reload_parser, script, warmup);
+
+  BenchResult result;
+  for (unsigned int i = 0; i < iterations; ++i) {
+    for (auto &script : scripts)
+      bench_script(parser, reload_parser, script, result);
+  }
+  return result;
+}
+
+static size_t get_peak_rss_bytes() {
+#ifndef _WIN32
+  struct rusage usage {};
+  getrusage(RUSAGE_SELF, &usage);
+# ifdef __APPLE__
+  return (size_t)usage.ru_maxrss;
+# else
+  return (size_t)usage.ru_maxrss * 1024;
+# endif
+#else
+  return 0;
+#endif
+}
+
+static void print_result(const std::string &corpus_name, size_t num_scripts, size_t num_bytes,
+                         const BenchResult &result, bool csv) {
+  size_t peak_rss = get_peak_rss_bytes();
+  if (csv) {
+    for (int i = 0; i < PHASE_MAX; ++i) {
+      auto &phase = result.phases[i];
+      printf("\"%s\",%zu,%zu,%s,%.6f,%llu,%llu,%zu,%zu\n",
+             corpus_name.c_str(), num_scripts, num_bytes, PHASE_NAMES[i], phase.seconds * 1000.0,
+             (unsigned long long)phase.scripts, (unsigned long long)phase.bytes,
+             result.peak_arena_bytes, peak_rss);
+    }
+    return;
+  }
+  printf("%s: %zu scripts, %.1f KiB\n", corpus_name.c_str(), num_scripts, (double)num_bytes / 1024.0);
+  printf("  %-12s %12s %12s %12s\n", "phase", "ms", "scripts/sec", "MB/sec");
+  for (int i = 0; i < PHASE_MAX; ++i) {
+    auto &phase = result.phases[i];
+    if (!phase.scripts || phase.seconds <= 0.0) {
+      printf("  %-12s %12s %12s %12s\n", PHASE_NAMES[i], "-", "-", "-");
+      continue;
+    }
+    printf("  %-12s %12.3f %12.1f %12.2f\n",
+           PHASE_NAMES[i],
+           phase.seconds * 1000.0,
+           (double)phase.scripts / phase.seconds,
+           (double)phase.bytes / (1024.0 * 1024.0) / phase.seconds);
+  }
+  printf("  peak arena: %.1f KiB, peak RSS so far: %.1f MiB\n\n",
+         (double)result.peak_arena_bytes / 1024.0, (double)peak_rss / (1024.0 * 1024.0));
+}
+
+static std::vector<BenchScript> load_corpus(const fs::path &dir) {
+  std::vector<BenchScript> scripts;
+  std::error_code ec;
+  for (auto &entry : fs::recursive_directory_iterator(dir, ec)) {
+    if (!entry.is_regular_file() || entry.path().extension() != ".lsl")
+      continue;
+    // expected outputs for the conformance tests, not scripts to run
+    if (entry.path().string().find("expected") != std::string::npos)
+      continue;
+    std::ifstream f(entry.path(), std::ios::binary);
+    std::stringstream contents;
+    contents << f.rdbuf();
+    scripts.push_back({entry.path().string(), contents.str()});
+  }
+  // directory iteration order is unspecified, keep runs comparable.
+  std::sort(scripts.begin(), scripts.end(), [](const BenchScript &a, const BenchScript &b) {
+    return a.name < b.name;
+  });
+  return scripts;
+}
+
+// Grow the `dimension` axis of `shape` by `factor`, false if there's no such axis.
+static bool scale_shape(ScriptShape &shape, const std::string &dimension, uint32_t factor) {
+  if (dimension == "all") {
+    shape.globals *= factor;
+    shape.functions *= factor;
+    shape.states *= factor;
+  } else if (dimension == "globals") {
+    shape.globals *= factor;
+  } else if (dimension == "functions") {
+    shape.functions *= factor;
+  } else if (dimension == "states") {
+    shape.states *= factor;
+  } else if (dimension == "handlers") {
+    shape.handlers *= factor;
+  } else if (dimension == "depth") {
+    shape.nesting_depth *= factor;
+  } else if (dimension == "lists") {
+    shape.list_size *= factor;
+  } else if (dimension == "concat") {
+    shape.concat_length *= factor;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+int main(int argc, char **argv) {
+  cxxopts::Options options("tailslide-bench", "Measure throughput of each phase of the pipeline");
+  std::string default_corpus = __FILE__;
+  default_corpus.erase(default_corpus.find_last_of("\\/"));
+  default_corpus += "/../tests/scripts";
+
+  options.add_options()
+      ("help", "Show this message")
+      ("corpus", "Directory of scripts to benchmark", cxxopts::value<std::string>()->default_value(default_corpus))
+      ("i,iterations", "How many times to process each script", cxxopts::value<unsigned int>()->default_value("10"))
+      ("skip-corpus", "Only benchmark generated scripts")
+      ("skip-generated", "Only benchmark the corpus")
+      ("csv", "Print results as CSV, for plotting")
+  ;
+  options.add_options("Generated scripts")
+      ("scale", "What to grow in each step: all, globals, functions, states, handlers, depth, lists or concat",
+        cxxopts::value<std::string>()->default_value("all"))
+      ("steps", "How many sizes of script to generate", cxxopts::value<uint32_t>()->default_value("6"))
+      ("factor", "How much to grow the scaled dimension each step", cxxopts::value<uint32_t>()->default_value("2"))
+      ("globals", "Number of globals to start with", cxxopts::value<uint32_t>()->default_value("8"))
+      ("functions", "Number of functions to start with", cxxopts::value<uint32_t>()->default_value("8"))
+      ("states", "Number of states to start with", cxxopts::value<uint32_t>()->default_value("2"))
+      ("handlers", "Number of event handlers per state to start with", cxxopts::value<uint32_t>()->default_value("2"))
+      ("depth", "How deeply to nest control flow to start with", cxxopts::value<uint32_t>()->default_value("2"))
+      ("list-size", "Number of elements in list literals to start with", cxxopts::value<uint32_t>()->default_value("8"))
+      ("concat-length", "Number of operands in string concatenations to start with",
+        cxxopts::value<uint32_t>()->default_value("4"))
+      ("seed", "Random seed for generated scripts", cxxopts::value<uint32_t>()->default_value("1"))
+      ("emit-script", "Print the smallest generated script and exit")
+  ;
+
+  cxxopts::ParseResult vm;
+  try {
+    auto parse_result = options.parse(argc, argv);
+    vm = std::move(parse_result);
+  } catch (cxxopts::OptionException &e) {
+    std::cerr << e.what() << std::endl;
+    std::cerr << options.help() << std::endl;
+    return 1;
+  }
+  if (vm.count("help")) {
+    std::cerr << options.help({"", "Generated scripts"}) << std::endl;
+    return 0;
+  }
+
+  ScriptShape shape;
+  shape.globals = vm["globals"].as<uint32_t>();
+  shape.functions = vm["functions"].as<uint32_t>();
+  shape.states = vm["states"].as<uint32_t>();
+  shape.handlers = vm["handlers"].as<uint32_t>();
+  shape.nesting_depth = vm["depth"].as<uint32_t>();
+  shape.list_size = vm["list-size"].as<uint32_t>();
+  shape.concat_length = vm["concat-length"].as<uint32_t>();
+  shape.seed = vm["seed"].as<uint32_t>();
+
+  if (vm.count("emit-script")) {
+    std::cout << generate_lsl_script(shape);
+    return 0;
+  }
+
+  auto iterations = vm["iterations"].as<unsigned int>();
+  bool csv = vm.count("csv");
+  tailslide_init_builtins(nullptr);
+
+  if (csv)
+    printf("corpus,scripts,bytes,phase,ms,phase_scripts,phase_bytes,peak_arena_bytes,peak_rss_bytes\n");
+
+  if (!vm.count("skip-corpus")) {
+    auto scripts = load_corpus(vm["corpus"].as<std::string>());
+    if (scripts.empty()) {
+      fprintf(stderr, "no scripts found in %s\n", vm["corpus"].as<std::string>().c_str());
+      return 1;
+    }
+    size_t num_bytes = 0;
+    for (auto &script : scripts)
+      num_bytes += script.source.size();
+    print_result("corpus", scripts.size(), num_bytes, run_bench(scripts, iterations), csv);
+  }
+
+  if (!vm.count("skip-generated")) {
+    auto dimension = vm["scale"].as<std::string>();
+    auto steps = vm["steps"].as<uint32_t>();
+    auto factor = vm["factor"].as<uint32_t>();
+    size_t first_size = 0;
+    for (uint32_t step = 0; step < steps; ++step) {
+      if (step && !scale_shape(shape, dimension, factor)) {
+        fprintf(stderr, "can't scale unknown dimension %s\n", dimension.c_str());
+        return 1;
+      }
+      std::vector<BenchScript> scripts {{"generated", generate_lsl_script(shape)}};
+      size_t script_size = scripts[0].source.size();
+      if (!first_size)
+        first_size = script_size;
+      // bigger scripts take longer, keep the total time in check.
+      auto scaled_iterations = (unsigned int)std::max<size_t>(1, iterations * first_size / script_size);
+      std::string corpus_name = "generated (" + dimension + " x" + std::to_string(step ? factor : 1);
+      if (step)
+        corpus_name += "^" + std::to_string(step);
+      corpus_name += ")";
+      print_result(corpus_name, 1, script_size, run_bench(scripts, scaled_iterations), csv);
+    }
+  }
+  return 0;
+}
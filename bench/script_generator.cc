@@ -0,0 +1,247 @@
+#include <sstream>
+
+#include "script_generator.hh"
+
+namespace Tailslide {
+
+static const char * const GLOBAL_TYPES[] = {
+  "integer", "float", "string", "key", "vector", "rotation", "list",
+};
+static const uint32_t NUM_GLOBAL_TYPES = sizeof(GLOBAL_TYPES) / sizeof(GLOBAL_TYPES[0]);
+
+static const char * const RETURN_TYPES[] = {"integer", "float", "string", "list"};
+static const uint32_t NUM_RETURN_TYPES = sizeof(RETURN_TYPES) / sizeof(RETURN_TYPES[0]);
+
+// none of the parameter names may collide with the locals every body declares
+static const char * const EVENT_SIGNATURES[] = {
+  "state_entry()",
+  "touch_start(integer num_detected)",
+  "timer()",
+  "listen(integer channel, string name, key id, string message)",
+  "on_rez(integer start_param)",
+  "changed(integer change)",
+  "link_message(integer sender_num, integer num, string str, key id)",
+  "collision_start(integer num_detected)",
+  "dataserver(key queryid, string data)",
+  "http_response(key request_id, integer status, list metadata, string body)",
+  "run_time_permissions(integer perm)",
+  "sensor(integer num_detected)",
+  "no_sensor()",
+  "attach(key id)",
+  "money(key id, integer amount)",
+  "touch_end(integer num_detected)",
+  "state_exit()",
+};
+static const uint32_t NUM_EVENTS = sizeof(EVENT_SIGNATURES) / sizeof(EVENT_SIGNATURES[0]);
+
+class ScriptGenerator {
+  public:
+    explicit ScriptGenerator(const ScriptShape &shape) : _mShape(shape), _mRandState(shape.seed | 1) {}
+
+    std::string generate() {
+      for (uint32_t i = 0; i < _mShape.globals; ++i)
+        writeGlobal(i);
+      for (uint32_t i = 0; i < _mShape.functions; ++i)
+        writeFunction(i);
+      // scripts need at least a default state with one handler in it
+      uint32_t num_states = _mShape.states ? _mShape.states : 1;
+      for (uint32_t i = 0; i < num_states; ++i)
+        writeState(i, num_states);
+      return _mOut.str();
+    }
+
+  private:
+    // xorshift32, we want the same output on every platform.
+    uint32_t random(uint32_t bound) {
+      _mRandState ^= _mRandState << 13;
+      _mRandState ^= _mRandState >> 17;
+      _mRandState ^= _mRandState << 5;
+      return _mRandState % bound;
+    }
+
+    void indent() {
+      for (uint32_t i = 0; i < _mIndent; ++i)
+        _mOut << "  ";
+    }
+
+    void writeConstant(const char *type) {
+      switch (type[0]) {
+        case 'i': _mOut << random(100000); break;
+        case 'f': _mOut << random(1000) << "." << random(100); break;
+        case 's': _mOut << "\"str" << random(1000) << "\""; break;
+        case 'k': _mOut << "\"00000000-0000-0000-0000-" << 100000000000ULL + random(100000) << "\""; break;
+        case 'v': _mOut << "<" << random(256) << ", " << random(256) << ", " << random(4096) << ">"; break;
+        case 'r': _mOut << "<0, 0, 0." << random(1000) << ", 1>"; break;
+        default: break;
+      }
+    }
+
+    // `allow_locals` is false for global initializers, which must be constant
+    void writeList(bool allow_locals) {
+      _mOut << "[";
+      for (uint32_t i = 0; i < _mShape.list_size; ++i) {
+        if (i)
+          _mOut << ", ";
+        if (allow_locals && random(4) == 0) {
+          _mOut << (random(2) ? "i" : "s");
+          continue;
+        }
+        // lists can't hold lists
+        writeConstant(GLOBAL_TYPES[random(NUM_GLOBAL_TYPES - 1)]);
+      }
+      _mOut << "]";
+    }
+
+    void writeConcatenation() {
+      for (uint32_t i = 0; i < _mShape.concat_length; ++i) {
+        if (i)
+          _mOut << " + ";
+        switch (random(4)) {
+          case 0:
+            if (_mShape.globals) {
+              _mOut << "(string)g" << random(_mShape.globals);
+              break;
+            }
+            // fall through
+          case 1: _mOut << "(string)i"; break;
+          case 2: _mOut << "llGetSubString(s, 0, " << random(16) << ")"; break;
+          default: writeConstant("string"); break;
+        }
+      }
+      if (!_mShape.concat_length)
+        _mOut << "s";
+    }
+
+    void writeGlobal(uint32_t idx) {
+      const char *type = GLOBAL_TYPES[idx % NUM_GLOBAL_TYPES];
+      _mOut << type << " g" << idx << " = ";
+      if (type[0] == 'l')
+        writeList(false);
+      else
+        writeConstant(type);
+      _mOut << ";\n";
+    }
+
+    // every body has `i`, `b`, `s` and `l` in scope
+    void writeLocals(bool in_function) {
+      indent(); _mOut << "integer i = " << (in_function ? "a" : "0") << ";\n";
+      if (!in_function) {
+        indent(); _mOut << "float b = " << random(100) << ".5;\n";
+      }
+      indent(); _mOut << "string s = " << (in_function ? "c" : "\"\"") << ";\n";
+      indent(); _mOut << "list l = "; writeList(true); _mOut << ";\n";
+    }
+
+    void writeSimpleStatements() {
+      indent(); _mOut << "s = "; writeConcatenation(); _mOut << ";\n";
+      indent(); _mOut << "i += llStringLength(s) * " << random(16) << " + (integer)b;\n";
+      indent(); _mOut << "l += [i, s];\n";
+    }
+
+    void writeCall() {
+      if (!_mShape.functions)
+        return;
+      indent(); _mOut << "f" << random(_mShape.functions) << "(i, b, s);\n";
+    }
+
+    void writeNested(uint32_t depth) {
+      if (!depth) {
+        writeSimpleStatements();
+        return;
+      }
+      indent();
+      switch (random(4)) {
+        case 0:
+          _mOut << "if (i > " << random(100) << ") {\n";
+          ++_mIndent; writeNested(depth - 1); --_mIndent;
+          indent(); _mOut << "} else {\n";
+          ++_mIndent; writeSimpleStatements(); --_mIndent;
+          indent(); _mOut << "}\n";
+          break;
+        case 1:
+          _mOut << "while (i < " << random(100) << ") {\n";
+          ++_mIndent;
+          indent(); _mOut << "++i;\n";
+          writeNested(depth - 1);
+          --_mIndent;
+          indent(); _mOut << "}\n";
+          break;
+        case 2:
+          _mOut << "for (i = 0; i < llGetListLength(l); ++i) {\n";
+          ++_mIndent; writeNested(depth - 1); --_mIndent;
+          indent(); _mOut << "}\n";
+          break;
+        default:
+          _mOut << "do {\n";
+          ++_mIndent; writeNested(depth - 1); --_mIndent;
+          indent(); _mOut << "} while (--i > 0);\n";
+          break;
+      }
+    }
+
+    void writeFunction(uint32_t idx) {
+      const char *ret_type = RETURN_TYPES[idx % NUM_RETURN_TYPES];
+      _mOut << ret_type << " f" << idx << "(integer a, float b, string c) {\n";
+      _mIndent = 1;
+      writeLocals(true);
+      writeNested(_mShape.nesting_depth);
+      // only call functions defined before us so the call graph stays acyclic
+      if (idx) {
+        indent(); _mOut << "f" << random(idx) << "(i, b, s);\n";
+      }
+      indent(); _mOut << "return ";
+      switch (ret_type[0]) {
+        case 'i': _mOut << "i"; break;
+        case 'f': _mOut << "b * i"; break;
+        case 's': _mOut << "s"; break;
+        default: _mOut << "l"; break;
+      }
+      _mOut << ";\n}\n\n";
+      _mIndent = 0;
+    }
+
+    void writeState(uint32_t idx, uint32_t num_states) {
+      if (idx)
+        _mOut << "state s" << idx << " {\n";
+      else
+        _mOut << "default {\n";
+      uint32_t num_handlers = _mShape.handlers;
+      if (num_handlers < 1)
+        num_handlers = 1;
+      if (num_handlers > NUM_EVENTS)
+        num_handlers = NUM_EVENTS;
+      for (uint32_t i = 0; i < num_handlers; ++i) {
+        _mIndent = 1;
+        indent(); _mOut << EVENT_SIGNATURES[i] << " {\n";
+        _mIndent = 2;
+        writeLocals(false);
+        writeNested(_mShape.nesting_depth);
+        writeCall();
+        // chain the states together so they're all reachable
+        if (i == 0 && num_states > 1) {
+          uint32_t next_state = (idx + 1) % num_states;
+          indent(); _mOut << "if (i == " << random(100) << ") state ";
+          if (next_state)
+            _mOut << "s" << next_state;
+          else
+            _mOut << "default";
+          _mOut << ";\n";
+        }
+        _mIndent = 1;
+        indent(); _mOut << "}\n";
+      }
+      _mOut << "}\n\n";
+      _mIndent = 0;
+    }
+
+    const ScriptShape &_mShape;
+    std::stringstream _mOut;
+    uint32_t _mRandState;
+    uint32_t _mIndent = 0;
+};
+
+std::string generate_lsl_script(const ScriptShape &shape) {
+  return ScriptGenerator(shape).generate();
+}
+
+}
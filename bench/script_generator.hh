@@ -0,0 +1,30 @@
+#ifndef TAILSLIDE_SCRIPT_GENERATOR_HH
+#define TAILSLIDE_SCRIPT_GENERATOR_HH
+
+#include <cstdint>
+#include <string>
+
+namespace Tailslide {
+
+/// How big a generated script should be along each axis.
+struct ScriptShape {
+  uint32_t globals = 8;
+  uint32_t functions = 8;
+  // including `default`
+  uint32_t states = 2;
+  // per state, capped at the number of distinct events
+  uint32_t handlers = 2;
+  // how deeply control flow nests in each function and handler body
+  uint32_t nesting_depth = 2;
+  uint32_t list_size = 8;
+  // number of operands in each string concatenation
+  uint32_t concat_length = 4;
+  uint32_t seed = 1;
+};
+
+/// Make a valid script of the given shape. The same shape always gives the same script.
+std::string generate_lsl_script(const ScriptShape &shape);
+
+}
+
+#endif
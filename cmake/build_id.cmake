@@ -0,0 +1,31 @@
+# Hash libtailslide's sources into a build ID, see `tailslide_get_build_id()`.
+# Run as a script with SOURCE_DIR, COMPILER and OUTPUT defined. The output is
+# only touched when the ID changes, so nothing gets rebuilt needlessly.
+
+file(GLOB_RECURSE SOURCES RELATIVE "${SOURCE_DIR}"
+        "${SOURCE_DIR}/libtailslide/*.cc"
+        "${SOURCE_DIR}/libtailslide/*.hh"
+        "${SOURCE_DIR}/libtailslide/*.l"
+        "${SOURCE_DIR}/libtailslide/*.y")
+# glob order isn't guaranteed to be stable
+list(SORT SOURCES)
+
+# different compilers may well build the same sources into something that behaves differently
+set(BUILD_ID_INPUT "${COMPILER}\n")
+foreach (SOURCE ${SOURCES})
+  file(SHA256 "${SOURCE_DIR}/${SOURCE}" SOURCE_HASH)
+  string(APPEND BUILD_ID_INPUT "${SOURCE} ${SOURCE_HASH}\n")
+endforeach ()
+string(SHA256 BUILD_ID "${BUILD_ID_INPUT}")
+string(SUBSTRING "${BUILD_ID}" 0 16 BUILD_ID)
+
+file(WRITE "${OUTPUT}.tmp"
+        "// generated by cmake/build_id.cmake, don't edit\n"
+        "#include \"lslmini.hh\"\n\n"
+        "namespace Tailslide {\n\n"
+        "const char *tailslide_get_build_id() {\n"
+        "  return \"${BUILD_ID}\";\n"
+        "}\n\n"
+        "}\n")
+execute_process(COMMAND "${CMAKE_COMMAND}" -E copy_if_different "${OUTPUT}.tmp" "${OUTPUT}")
+file(REMOVE "${OUTPUT}.tmp")
@@ -22,21 +22,14 @@ extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
   try {
     auto *script = parser.parseLSLBytes((const char *)data, size);
     if (script) {
-      script->collectSymbols();
-      script->determineTypes();
-      script->recalculateReferenceData();
-      script->propagateValues();
-      script->finalPass();
+      // only lint up front if we're not going to optimize first
+      script->analyze(true, compile_lso || compile_cil);
       if (compile_lso) {
-        script->checkSymbols();
-        script->validateGlobals(true);
         if (!parser.logger.getErrors()) {
           Tailslide::LSOScriptCompiler visitor(&parser.allocator);
           script->visit(&visitor);
         }
       } else if (compile_cil) {
-        script->checkSymbols();
-        script->validateGlobals(true);
         if (!parser.logger.getErrors()) {
           Tailslide::MonoScriptCompiler visitor(&parser.allocator);
           script->visit(&visitor);
@@ -1,7 +1,36 @@
 import os.path
+import re
+import struct
+import sys
+from typing import List, NamedTuple, Optional, Tuple
 
 SCRIPT_PATH = os.path.dirname(os.path.realpath(__file__))
 BUILTINS_PATH = os.path.join(SCRIPT_PATH, "builtins.txt")
+# The build regenerates the table into its own directory when Python's available,
+# the checked in copy is only used when it isn't. Run without arguments to update that copy.
+DEFAULT_OUTPUT_PATH = os.path.join(SCRIPT_PATH, "libtailslide", "builtins_table.cc")
+
+LSL_TYPES = {
+    "void": "LST_NULL",
+    "integer": "LST_INTEGER",
+    "float": "LST_FLOATINGPOINT",
+    "string": "LST_STRING",
+    # key constants don't exist, and there are no key literals either.
+    "key": "LST_KEY",
+    "vector": "LST_VECTOR",
+    "rotation": "LST_QUATERNION",
+    "list": "LST_LIST",
+}
+
+
+class Builtin(NamedTuple):
+    name: str
+    symbol_type: str
+    type: str
+    params: Tuple[Tuple[str, str], ...] = ()
+    int_value: int = 0
+    float_values: Tuple[str, ...] = ()
+    str_value: Optional[str] = None
 
 
 def _escape_cstr_char(char: str):
@@ -14,26 +43,216 @@ def _escape_cstr_char(char: str):
     return char
 
 
+def _cstr(val: str):
+    return '"' + "".join(_escape_cstr_char(x) for x in val) + '"'
+
+
+def _parse_lsl_string(val: str) -> str:
+    """Same as `parse_string()` in strings.cc, minus the lexer-specific bits"""
+    assert val[0] == '"'
+    out = []
+    i = 1
+    while i < len(val) and val[i] != '"':
+        if val[i] == "\\":
+            i += 1
+            esc = val[i]
+            if esc == "n":
+                out.append("\n")
+            elif esc == "t":
+                # Tab escape really means "four spaces" in LSL.
+                out.append("    ")
+            else:
+                out.append(esc)
+        else:
+            out.append(val[i])
+        i += 1
+    return "".join(out)
+
+
+def _parse_int(val: str) -> int:
+    # matches how `sscanf()` with `%d` then `0x%x` would handle it
+    if val.lower().startswith("0x"):
+        num = int(val, 16)
+    else:
+        num = int(val)
+    return struct.unpack("<i", struct.pack("<I", num & 0xFFffFFff))[0]
+
+
+def _float_literal(val: str) -> str:
+    val = val.strip()
+    float(val)
+    if "." not in val and "e" not in val.lower():
+        val += ".0"
+    return val + "f"
+
+
+def _parse_builtin(line: str) -> Builtin:
+    if line.startswith("const "):
+        match = re.match(r"const\s+(\w+)\s+(\w+)\s*=\s*(.*)$", line)
+        type_name, name, value = match.groups()
+        value = value.strip()
+        # key constants are really just strings
+        if type_name == "key":
+            type_name = "string"
+        lsl_type = LSL_TYPES[type_name]
+        if lsl_type == "LST_INTEGER":
+            return Builtin(name, "SYM_VARIABLE", lsl_type, int_value=_parse_int(value))
+        if lsl_type == "LST_FLOATINGPOINT":
+            return Builtin(name, "SYM_VARIABLE", lsl_type, float_values=(_float_literal(value),))
+        if lsl_type in ("LST_VECTOR", "LST_QUATERNION"):
+            components = value.strip("<>").split(",")
+            return Builtin(name, "SYM_VARIABLE", lsl_type, float_values=tuple(_float_literal(x) for x in components))
+        if lsl_type == "LST_STRING":
+            return Builtin(name, "SYM_VARIABLE", lsl_type, str_value=_parse_lsl_string(value))
+        raise ValueError(f"Can't handle constant {line!r}")
+
+    tokens = [x for x in re.split(r"[ (),]+", line) if x]
+    if tokens[0] == "event":
+        symbol_type, ret_type = "SYM_EVENT", "void"
+    else:
+        symbol_type, ret_type = "SYM_FUNCTION", tokens[0]
+    name = tokens[1]
+    param_tokens = tokens[2:]
+    params = tuple((LSL_TYPES[t], n) for t, n in zip(param_tokens[::2], param_tokens[1::2]))
+    return Builtin(name, symbol_type, LSL_TYPES[ret_type], params=params)
+
+
+def hash_name(name: str, seed: int) -> int:
+    """FNV-1a, must match `hash_builtin_name()` in builtins_table.hh"""
+    h = (2166136261 ^ seed) & 0xFFffFFff
+    for c in name.encode("utf8"):
+        h ^= c
+        h = (h * 16777619) & 0xFFffFFff
+    return h
+
+
+def build_perfect_hash(names: List[str]) -> Tuple[List[int], List[int]]:
+    """
+    Hash and displace: names are split into buckets by their unseeded hash, then
+    each bucket gets a seed that puts all of its names into free slots.
+
+    Returns the seed for each bucket and the slot for each name.
+    """
+    num_slots = len(names)
+    num_buckets = max(1, num_slots // 4)
+    buckets: List[List[int]] = [[] for _ in range(num_buckets)]
+    for i, name in enumerate(names):
+        buckets[hash_name(name, 0) % num_buckets].append(i)
+
+    seeds = [0] * num_buckets
+    slots = [-1] * len(names)
+    taken = [False] * num_slots
+    # place the biggest buckets first while there's still lots of room
+    for bucket_idx in sorted(range(num_buckets), key=lambda x: -len(buckets[x])):
+        bucket = buckets[bucket_idx]
+        if not bucket:
+            continue
+        seed = 1
+        while True:
+            cand_slots = [hash_name(names[i], seed) % num_slots for i in bucket]
+            if len(set(cand_slots)) == len(cand_slots) and not any(taken[s] for s in cand_slots):
+                break
+            seed += 1
+            if seed > 0xFFff:
+                raise ValueError("Couldn't find a perfect hash, try more buckets")
+        seeds[bucket_idx] = seed
+        for name_idx, slot in zip(bucket, cand_slots):
+            slots[name_idx] = slot
+            taken[slot] = True
+    return seeds, slots
+
+
 def main():
+    builtins: List[Builtin] = []
     with open(BUILTINS_PATH) as f:
-        builtins_lines = tuple(f.readlines())
+        for line in f:
+            line = line.strip()
+            if not line or line.startswith("//"):
+                continue
+            builtins.append(_parse_builtin(line))
 
-    with open(os.path.join(SCRIPT_PATH, 'libtailslide', 'builtins_txt.cc'), 'w') as f:
-        f.write("""#ifdef _WIN32
+    names = [b.name for b in builtins]
+    if len(set(names)) != len(names):
+        raise ValueError("Builtin names must be unique")
+    seeds, slots = build_perfect_hash(names)
+    by_slot: List[Optional[Builtin]] = [None] * len(builtins)
+    for builtin, slot in zip(builtins, slots):
+        by_slot[slot] = builtin
+
+    params: List[Tuple[str, str]] = []
+    output_path = sys.argv[1] if len(sys.argv) > 1 else DEFAULT_OUTPUT_PATH
+    with open(output_path, 'w') as f:
+        f.write("""// Generated by generate_builtins_c.py from builtins.txt, don't edit by hand!
+#ifdef _WIN32
 #pragma execution_character_set("utf-8")
 #endif
+#include "builtins_table.hh"
+
 namespace Tailslide {
-const char *BUILTINS_TXT[] = {
+
 """)
-        for line in builtins_lines:
-            line = line.strip()
-            if not line:
-                continue
-            f.write('"')
-            f.write("".join(_escape_cstr_char(x) for x in line))
-            f.write('",\n')
+        entry_lines = []
+        for builtin in by_slot:
+            float_values = list(builtin.float_values) + ["0.0f"] * (4 - len(builtin.float_values))
+            str_value = "nullptr" if builtin.str_value is None else _cstr(builtin.str_value)
+            # can't write INT32_MIN as a plain literal
+            int_value = "INT32_MIN" if builtin.int_value == -2 ** 31 else str(builtin.int_value)
+            entry_lines.append(
+                f'    {{{_cstr(builtin.name)}, {builtin.symbol_type}, {builtin.type}, {len(params)}, '
+                f'{len(builtin.params)}, {int_value}, {{{", ".join(float_values)}}}, {str_value}}},\n'
+            )
+            params.extend(builtin.params)
+
+        f.write("static constexpr BuiltinParam BUILTIN_PARAMS[] = {\n")
+        for param_type, param_name in params:
+            f.write(f"    {{{_cstr(param_name)}, {param_type}}},\n")
+        f.write("};\n\n")
 
-        f.write("(char*)nullptr\n};\n}\n")
+        f.write("static constexpr BuiltinEntry BUILTIN_ENTRIES[] = {\n")
+        f.writelines(entry_lines)
+        f.write("};\n\n")
+
+        f.write("static constexpr uint16_t BUILTIN_HASH_SEEDS[] = {\n")
+        for i in range(0, len(seeds), 16):
+            f.write("    " + ", ".join(str(x) for x in seeds[i:i + 16]) + ",\n")
+        f.write("};\n\n")
+
+        f.write("""static constexpr size_t NUM_BUILTIN_ENTRIES = sizeof(BUILTIN_ENTRIES) / sizeof(BUILTIN_ENTRIES[0]);
+static constexpr size_t NUM_BUILTIN_HASH_SEEDS = sizeof(BUILTIN_HASH_SEEDS) / sizeof(BUILTIN_HASH_SEEDS[0]);
+
+static constexpr int find_builtin_entry_impl(const char *name) {
+  uint32_t seed = BUILTIN_HASH_SEEDS[hash_builtin_name(name, 0) % NUM_BUILTIN_HASH_SEEDS];
+  auto idx = (int)(hash_builtin_name(name, seed) % NUM_BUILTIN_ENTRIES);
+  // the hash only tells us where the name would be if it existed.
+  const char *entry_name = BUILTIN_ENTRIES[idx].name;
+  for (; *name && *name == *entry_name; ++name, ++entry_name);
+  return (*name == *entry_name) ? idx : -1;
+}
+
+static constexpr bool check_builtin_hashes() {
+  for (size_t i = 0; i < NUM_BUILTIN_ENTRIES; ++i) {
+    if (find_builtin_entry_impl(BUILTIN_ENTRIES[i].name) != (int)i)
+      return false;
+  }
+  return true;
+}
+static_assert(check_builtin_hashes(), "builtins_table.cc is out of sync with hash_builtin_name()");
+
+int find_builtin_entry(const char *name) {
+  return find_builtin_entry_impl(name);
+}
+
+const BuiltinEntry *get_builtin_entries(size_t *num_entries) {
+  *num_entries = NUM_BUILTIN_ENTRIES;
+  return BUILTIN_ENTRIES;
+}
+
+const BuiltinParam *get_builtin_params(const BuiltinEntry *entry) {
+  return BUILTIN_PARAMS + entry->first_param;
+}
+
+}
+""")
 
 
 if __name__ == "__main__":
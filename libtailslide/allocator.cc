@@ -1,14 +1,80 @@
+#include <stdexcept>
+
 #include "allocator.hh"
 
 namespace Tailslide {
 
 ScriptAllocator::~ScriptAllocator() {
-  for(auto &obj_ptr : _mTrackedObjects) {
-    delete obj_ptr;
+  releaseAll();
+  for(auto &block : _mBlocks) {
+    free(block.data);
+  }
+}
+
+void ScriptAllocator::releaseAll() {
+  _mAtoms.reset();
+  if (_mUseArena) {
+    // memory for these lives in the blocks, only run the destructors.
+    for(auto &obj_ptr : _mTrackedObjects) {
+      obj_ptr->~TrackableObject();
+    }
+  } else {
+    for(auto &obj_ptr : _mTrackedObjects) {
+      delete obj_ptr;
+    }
   }
+  _mTrackedObjects.clear();
   for(auto &obj_ptr : _mMallocs) {
     free(obj_ptr);
   }
+  _mMallocs.clear();
+  for(auto &block : _mLargeBlocks) {
+    free(block.data);
+  }
+  _mLargeBlocks.clear();
+}
+
+void ScriptAllocator::reset() {
+  releaseAll();
+  _mStats = {};
+  _mStats.bytes_reserved = _mBlocks.size() * ARENA_BLOCK_SIZE;
+  // rewind to the first block, later blocks get picked back up as it fills.
+  _mBlockIdx = 0;
+  _mBlockPos = 0;
+  if (!_mBlocks.empty()) {
+    _mBlock = _mBlocks[0].data;
+    _mBlockSize = _mBlocks[0].size;
+  }
+}
+
+ScriptAllocator::ArenaBlock &ScriptAllocator::newBlock(std::vector<ArenaBlock> &blocks, size_t size) {
+  // malloc()ed memory is suitably aligned for anything we'll place in it
+  char *data = (char *)malloc(size);
+  if (data == nullptr)
+    throw std::bad_alloc();
+  blocks.push_back({data, size});
+  _mStats.bytes_reserved += size;
+  return blocks.back();
+}
+
+void *ScriptAllocator::allocSlow(size_t size) {
+  _mStats.bytes_used += size;
+  // Large allocations get a block to themselves so we don't throw away
+  // whatever is left in the current block.
+  if (size > ARENA_BLOCK_SIZE / 4)
+    return newBlock(_mLargeBlocks, size).data;
+
+  if (_mBlock != nullptr && _mBlockIdx + 1 < _mBlocks.size()) {
+    // still have a block left over from before the last reset()
+    ++_mBlockIdx;
+  } else {
+    newBlock(_mBlocks, ARENA_BLOCK_SIZE);
+    _mBlockIdx = _mBlocks.size() - 1;
+  }
+  _mBlock = _mBlocks[_mBlockIdx].data;
+  _mBlockSize = _mBlocks[_mBlockIdx].size;
+  _mBlockPos = size;
+  return _mBlock;
 }
 
 }
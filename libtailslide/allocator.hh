@@ -1,11 +1,17 @@
 #ifndef ALLOCATOR_HH
 #define ALLOCATOR_HH
 
+#include <cassert>
+#include <cstddef>
 #include <functional>
+#include <new>
+#include <type_traits>
 #include <vector>
 #include <cstring>
 #include <cstdlib>
 
+#include "atoms.hh"
+
 namespace Tailslide {
 
 struct ScriptContext;
@@ -15,45 +21,128 @@ public:
   explicit TrackableObject(ScriptContext *ctx) { mContext = ctx;};
   virtual ~TrackableObject() = default;
   ScriptContext *mContext = nullptr;
+
+  // Whether the destructor may be skipped when the owning arena is torn down.
+  // Only set this on types whose members are all trivially destructible,
+  // subclasses inherit the setting!
+  static constexpr bool TRIVIAL_TEARDOWN = false;
+};
+
+struct ScriptAllocatorStats {
+    // number of arena blocks currently held
+    size_t blocks = 0;
+    // total size of all held arena blocks
+    size_t bytes_reserved = 0;
+    // bytes handed out, including alignment padding
+    size_t bytes_used = 0;
+    // number of objects created through `newTracked()`
+    size_t objects = 0;
+    // number of raw allocations made through `alloc()` or `copyStr()`
+    size_t strings = 0;
+    // number of objects that need their destructor called on teardown
+    size_t destructors = 0;
 };
 
 class ScriptAllocator {
 public:
-    ScriptAllocator() = default;
+    /// When `use_arena` is true objects and strings are bump-allocated out of large
+    /// blocks that are released all at once, otherwise every allocation goes to the heap.
+    explicit ScriptAllocator(bool use_arena=true) : _mUseArena(use_arena) {};
     virtual ~ScriptAllocator();
+    ScriptAllocator(const ScriptAllocator &other) = delete;
+    ScriptAllocator &operator=(const ScriptAllocator &other) = delete;
 
     void setContext(ScriptContext *context) { _mContext = context;};
+    /// Release everything allocated so far, keeping the regular arena blocks around
+    /// so the next script can be allocated without going back to the heap.
+    void reset();
 
     template<typename TClazz, typename... Args>
     inline TClazz * newTracked(Args&&... args) {
       static_assert(std::is_base_of<TrackableObject, TClazz>::value, "Must be based on LLTrackableObject");
-      auto *val = new TClazz(_mContext, std::forward<Args>(args)...);
-      _mTrackedObjects.emplace_back(val);
+      TClazz *val;
+      if (_mUseArena) {
+        val = new (allocRaw(sizeof(TClazz), alignof(TClazz))) TClazz(_mContext, std::forward<Args>(args)...);
+        // nothing to release, the memory goes away with the block.
+        if (!TClazz::TRIVIAL_TEARDOWN)
+          _mTrackedObjects.emplace_back(val);
+      } else {
+        val = new TClazz(_mContext, std::forward<Args>(args)...);
+        _mTrackedObjects.emplace_back(val);
+      }
+      ++_mStats.objects;
       return val;
     }
 
     char *alloc(size_t size) {
+      ++_mStats.strings;
+      if (_mUseArena)
+        return (char *)allocRaw(size, 1);
       char *val = (char *)malloc(size);
+      _mStats.bytes_used += size;
       _mMallocs.emplace_back(val);
       return val;
     }
 
     char *copyStr(const char *old_str) {
-      char *new_str = (char *)malloc(strlen(old_str) + 1);
-      if (new_str) {
-        strcpy(new_str, old_str);
-        trackMalloc(new_str);
-      }
+      size_t len = strlen(old_str) + 1;
+      char *new_str = alloc(len);
+      if (new_str)
+        memcpy(new_str, old_str, len);
       return new_str;
     }
 
+    /// Get the single shared copy of `str` for this allocator, see `AtomTable`
+    const char *intern(const char *str, size_t len) { return _mAtoms.intern(str, len); }
+    const char *intern(const char *str) { return _mAtoms.intern(str); }
+    AtomTable &getAtoms() { return _mAtoms; }
+
     void trackMalloc(void *alloced_data) {
       _mMallocs.emplace_back(alloced_data);
     }
+
+    bool usesArena() const { return _mUseArena; }
+    ScriptAllocatorStats getStats() const {
+      ScriptAllocatorStats stats = _mStats;
+      stats.blocks = _mBlocks.size() + _mLargeBlocks.size();
+      stats.destructors = _mUseArena ? _mTrackedObjects.size() : 0;
+      return stats;
+    }
+
+    // regular blocks, anything too big to share one gets its own block.
+    static constexpr size_t ARENA_BLOCK_SIZE = 64 * 1024;
+
 private:
+    struct ArenaBlock {
+      char *data;
+      size_t size;
+    };
+
+    void *allocRaw(size_t size, size_t align) {
+      assert(align <= alignof(std::max_align_t) && (align & (align - 1)) == 0);
+      size_t offset = (_mBlockPos + align - 1) & ~(align - 1);
+      if (_mBlock == nullptr || offset + size > _mBlockSize)
+        return allocSlow(size);
+      _mStats.bytes_used += offset + size - _mBlockPos;
+      _mBlockPos = offset + size;
+      return _mBlock + offset;
+    }
+    void *allocSlow(size_t size);
+    ArenaBlock &newBlock(std::vector<ArenaBlock> &blocks, size_t size);
+    void releaseAll();
+
     std::vector<TrackableObject *> _mTrackedObjects {};
     std::vector<void *> _mMallocs {};
+    std::vector<ArenaBlock> _mBlocks {};
+    std::vector<ArenaBlock> _mLargeBlocks {};
+    size_t _mBlockIdx = 0;
+    char *_mBlock = nullptr;
+    size_t _mBlockPos = 0;
+    size_t _mBlockSize = 0;
+    bool _mUseArena;
+    ScriptAllocatorStats _mStats {};
     ScriptContext *_mContext = nullptr;
+    AtomTable _mAtoms {this};
 };
 
 }
@@ -20,16 +20,30 @@ LSLIType LSLASTNode::getIType() {
   return _mType->getIType();
 }
 
-int LSLASTNode::getParentSlot() {
-  if (!_mParent)
-    return -1;
-  int idx = 0;
-  for (auto *child: *_mParent) {
-    if (child == this)
-      return idx;
-    ++idx;
+LSLASTNode *LSLASTNode::getChildSlow(int i) {
+  // walk from whichever end is closer
+  if (_mNumChildren - 1 - i < i - (INLINE_CHILD_SLOTS - 1)) {
+    LSLASTNode *c = _mChildrenTail;
+    for (int j = _mNumChildren - 1; j > i; --j)
+      c = c->_mPrev;
+    return c;
   }
-  return -1;
+  LSLASTNode *c = _mChildSlots[INLINE_CHILD_SLOTS - 1];
+  for (int j = INLINE_CHILD_SLOTS - 1; j < i; ++j)
+    c = c->_mNext;
+  return c;
+}
+
+void LSLASTNode::renumberChildren(LSLASTNode *child, int slot) {
+  for (; child != nullptr; child = child->_mNext, ++slot) {
+    child->_mParentSlot = slot;
+    if (slot < INLINE_CHILD_SLOTS)
+      _mChildSlots[slot] = child;
+    _mChildrenTail = child;
+  }
+  for (int i = slot; i < INLINE_CHILD_SLOTS; ++i)
+    _mChildSlots[i] = nullptr;
+  _mNumChildren = slot;
 }
 
 void LSLASTNode::addChildren(int num, va_list ap) {
@@ -73,17 +87,32 @@ void LSLASTNode::setParent(LSLASTNode *newparent) {
   }
 }
 
+bool LSLASTNode::isUsageTracked() const {
+  return mContext && mContext->usage_tracked && _mUsageEpoch == mContext->usage_epoch;
+}
+
+void LSLASTNode::setUsageCounted(bool counted) {
+  // builtins' static nodes don't belong to any script
+  if (mContext)
+    _mUsageEpoch = counted ? mContext->usage_epoch : 0;
+}
+
 void LSLASTNode::pushChild(LSLASTNode *child) {
   if (child == nullptr)
     return;
   child->setParent(this);
   if (_mChildren == nullptr) {
-    _mChildrenTail = _mChildren = child;
+    _mChildren = child;
   } else {
     _mChildrenTail->setNext(child);
-    _mChildrenTail = child;
   }
+  // `child` may be the head of a chain of siblings, this also finds the new tail.
+  renumberChildren(child, _mNumChildren);
   assert (child != this);
+  if (isUsageTracked()) {
+    for (auto *sibling = child; sibling != nullptr; sibling = sibling->_mNext)
+      track_subtree_usage(sibling);
+  }
 }
 
 LSLASTNode *LSLASTNode::takeChild(int child_num) {
@@ -96,6 +125,8 @@ LSLASTNode *LSLASTNode::takeChild(int child_num) {
 
 void LSLASTNode::removeChild(LSLASTNode *child) {
   if (child == nullptr) return;
+  if (isUsageTracked())
+    track_subtree_usage(child, true);
 
   LSLASTNode *prev_child = child->getPrev();
   LSLASTNode *next_child = child->getNext();
@@ -110,8 +141,10 @@ void LSLASTNode::removeChild(LSLASTNode *child) {
 
   if (next_child != nullptr)
     next_child->setPrev(prev_child);
-  else
-    _mChildrenTail = prev_child;
+
+  // everything after the removed child shifts up a slot
+  _mChildrenTail = prev_child;
+  renumberChildren(next_child, child->_mParentSlot);
 
   // must be done last so we don't change the parent of siblings
   child->setParent(nullptr);
@@ -134,9 +167,12 @@ void LSLASTNode::setPrev(LSLASTNode *newprev) {
 
 void LSLASTNode::replaceNode(LSLASTNode *old_node, LSLASTNode *replacement) {
   assert(replacement != nullptr && old_node != nullptr);
+  auto *parent = old_node->getParent();
+  bool usage_tracked = parent && parent->isUsageTracked();
+  if (usage_tracked)
+    track_subtree_usage(old_node, true);
   replacement->setPrev(old_node->getPrev());
   replacement->setNext(old_node->getNext());
-  auto *parent = old_node->getParent();
 
   if (parent != nullptr) {
     // first node, have to replace parent's _mChildren
@@ -147,14 +183,23 @@ void LSLASTNode::replaceNode(LSLASTNode *old_node, LSLASTNode *replacement) {
     if (parent->_mChildrenTail == old_node) {
       parent->_mChildrenTail = replacement;
     }
+    if (old_node->_mParentSlot < INLINE_CHILD_SLOTS) {
+      parent->_mChildSlots[old_node->_mParentSlot] = replacement;
+    }
   }
+  replacement->_mParentSlot = old_node->_mParentSlot;
   old_node->_mNext = nullptr;
   old_node->_mPrev = nullptr;
   old_node->setParent(nullptr);
   replacement->setParent(parent);
+  if (usage_tracked)
+    track_subtree_usage(replacement);
 }
 
 void LSLASTNode::visit(ASTVisitor *visitor) {
+  // builtins' static nodes don't belong to any script
+  if (mContext && mContext->profiler)
+    ++mContext->counters.nodes_visited;
   if (!visitor->isDepthFirst()) {
     // Use the node type and node subtype retvals to cast and choose
     // a more specific version of the visitor's visit methods to call.
@@ -180,18 +225,21 @@ void LSLASTNode::visit(ASTVisitor *visitor) {
 
 
 void LSLASTNode::propagateValues(bool create_heap_values) {
+  ScopedPass pass(mContext, "values");
   TailslideOperationBehavior behavior(mContext->allocator, create_heap_values);
   ConstantDeterminingVisitor visitor(&behavior, mContext->allocator);
   visit(&visitor);
 }
 
 void LSLASTNode::finalPass() {
+  ScopedPass pass(mContext, "final pass");
   FinalPassVisitor visitor;
   visit(&visitor);
 }
 
 // walk tree post-order and propagate types
 void LSLASTNode::determineTypes() {
+  ScopedPass pass(mContext, "types");
   TypeCheckVisitor visitor;
   visit(&visitor);
 }
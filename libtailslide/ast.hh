@@ -72,6 +72,7 @@ enum LSLNodeSubType {
 
 struct OptimizationOptions;
 class ASTVisitor;
+class StaticASTVisitorBase;
 
 template<class T>
 struct node_child_iterator {
@@ -129,6 +130,9 @@ class LSLASTNode : public TrackableObject {
     }
 
     ~LSLASTNode() override = default;
+    // nodes only hold pointers into the allocator and plain values.
+    // Don't give any node class members that need destruction!
+    static constexpr bool TRIVIAL_TEARDOWN = true;
 
     void addChildren(int num, va_list ap);
 
@@ -137,33 +141,24 @@ class LSLASTNode : public TrackableObject {
     LSLASTNode *getParent() { return _mParent; }
 
     LSLASTNode *getChild(int i) {
-      LSLASTNode *c = _mChildren;
-      while (i-- && c)
-        c = c->getNext();
-      return c;
+      if (i < 0 || i >= _mNumChildren)
+        return nullptr;
+      // fixed-arity nodes never have more children than we have slots for
+      if (i < INLINE_CHILD_SLOTS)
+        return _mChildSlots[i];
+      return getChildSlow(i);
     }
 
     void setChild(int i, LSLASTNode *new_val) {
-      LSLASTNode *c = _mChildren;
-      while (i-- && c) {
-        c = c->getNext();
-      }
+      LSLASTNode *c = getChild(i);
       assert(c);
       if (!new_val)
         new_val = newNullNode();
       LSLASTNode::replaceNode(c, new_val);
     }
 
-    int getNumChildren() const {
-      LSLASTNode *c = _mChildren;
-      int num = 0;
-      // empty children (NODE_NULL) are still considered valid.
-      while (c) {
-        c = c->getNext();
-        ++num;
-      }
-      return num;
-    };
+    // empty children (NODE_NULL) are still considered valid.
+    int getNumChildren() const { return _mNumChildren; };
 
     bool hasChildren() const {
       return _mChildren != nullptr;
@@ -179,7 +174,7 @@ class LSLASTNode : public TrackableObject {
     }
 
     /// Get our position within our parents' children
-    int getParentSlot();
+    int getParentSlot() const { return _mParent ? _mParentSlot : -1; }
 
     LSLASTNode *newNullNode();
 
@@ -196,10 +191,20 @@ class LSLASTNode : public TrackableObject {
     /* replace a node from the list of children with null, returning it */
     LSLASTNode *takeChild(int child_num);
 
+    // The most children any fixed-arity node has, the first children of
+    // list-like nodes also get slots.
+    static constexpr int INLINE_CHILD_SLOTS = 4;
+
     // replace an arbitrary node with another, setting
     // prev, next and parent as appropriate
     static void replaceNode(LSLASTNode *old_node, LSLASTNode *replacement);
 
+    // Whether symbol usage under this node is counted, see `ScriptContext::usage_tracked`.
+    // Attaching and detaching children keeps the counts up to date when it is.
+    bool isUsageTracked() const;
+    // Record whether this node's own usage is part of the script's current counts
+    void setUsageCounted(bool counted);
+
 
     void                setType(LSLType *type) { _mType = type;   }
     class LSLType *getType()                    { return _mType;    }
@@ -212,6 +217,9 @@ class LSLASTNode : public TrackableObject {
     /// passes                  ///
     // generic visitor functions
     void visit(ASTVisitor *visitor);
+    // statically dispatched visitors, see `StaticASTVisitor`
+    template<class TVisitor, typename std::enable_if<std::is_base_of<StaticASTVisitorBase, TVisitor>::value, int>::type = 0>
+    void visit(TVisitor *visitor) { visitor->visitNode(this); }
 
     // Convenience methods for common visitor uses
     void collectSymbols();
@@ -221,7 +229,9 @@ class LSLASTNode : public TrackableObject {
     void checkSymbols(); // look for unused symbols, etc
 
     /// symbol functions        ///
-    virtual LSLSymbol *lookupSymbol(const char *name, LSLSymbolType type );
+    LSLSymbol *lookupSymbol(const char *name, LSLSymbolType type );
+    // Same as `lookupSymbol()`, but `atom` must be the name as interned by `mContext->allocator`, if it was
+    virtual LSLSymbol *lookupAtom(const char *atom, LSLSymbolType type );
     void            defineSymbol(LSLSymbol *symbol );
     LSLSymbolTable *getSymbolTable() { return _mSymbolTable; }
     void setSymbolTable(LSLSymbolTable *table) {_mSymbolTable = table;}
@@ -239,8 +249,8 @@ class LSLASTNode : public TrackableObject {
 
     /// identification          ///
     virtual std::string getNodeName() { return "node";    };
-    virtual LSLNodeType  getNodeType() { return NODE_NODE; };
-    virtual LSLNodeSubType getNodeSubType() { return NODE_NO_SUB_TYPE; }
+    LSLNodeType getNodeType() const { return _mNodeType; };
+    LSLNodeSubType getNodeSubType() const { return _mNodeSubType; }
 
     /// constants ///
     virtual class LSLConstant  *getConstantValue()    { return _mConstantValue; };
@@ -259,6 +269,10 @@ class LSLASTNode : public TrackableObject {
     void setSynthesized(bool synthesized) { _mSynthesized = synthesized; };
 
   protected:
+    // Set by each node class' constructor. These are plain fields rather
+    // than virtual methods so visitors can cheaply dispatch on them.
+    LSLNodeType _mNodeType = NODE_NODE;
+    LSLNodeSubType _mNodeSubType = NODE_NO_SUB_TYPE;
     bool _mSynthesized = false;
     class LSLType          *_mType;
     LSLSymbolTable         *_mSymbolTable;
@@ -266,12 +280,25 @@ class LSLASTNode : public TrackableObject {
     bool                   _mConstantPrecluded = false;
 
   protected:
-    // head of the linked-list, only set for list-like nodes
+    // head of the children linked-list
     LSLASTNode *_mChildren = nullptr;
-    // only set for list-like nodes
+    // tail of the children linked-list
     LSLASTNode *_mChildrenTail = nullptr;
 
   private:
+    LSLASTNode *getChildSlow(int i);
+    // renumber children starting at `child`, which is at index `slot`
+    void renumberChildren(LSLASTNode *child, int slot);
+
+    // direct pointers to the first children so accessors needn't walk the list
+    LSLASTNode *_mChildSlots[INLINE_CHILD_SLOTS] {};
+    int _mNumChildren = 0;
+    // our index in our parent's list of children
+    int _mParentSlot = -1;
+    // matches `ScriptContext::usage_epoch` if our usage is counted, which
+    // is only the case while we're attached to the script.
+    uint32_t _mUsageEpoch = 0;
+
     YYLTYPE                      _mLoc {0};
 
     LSLASTNode *_mParent;
@@ -289,22 +316,21 @@ class LSLASTNode : public TrackableObject {
 
 class LSLASTNullNode : public LSLASTNode {
   public:
-    explicit LSLASTNullNode(ScriptContext *ctx): LSLASTNode(ctx) {};
+    explicit LSLASTNullNode(ScriptContext *ctx): LSLASTNode(ctx) { _mNodeType = NODE_NULL; };
     virtual std::string getNodeName() { return "null"; };
-    virtual LSLNodeType getNodeType() { return NODE_NULL; };
 };
 
 template<class T>
 class LSLASTNodeList : public LSLASTNode {
   static_assert(std::is_base_of<LSLASTNode, T>::value, "T Must derive from LSLASTNode!");
   public:
-    explicit LSLASTNodeList<T>(ScriptContext *ctx) : LSLASTNode(ctx, 0) {};
+    explicit LSLASTNodeList<T>(ScriptContext *ctx) : LSLASTNode(ctx, 0) { _mNodeType = NODE_AST_NODE_LIST; };
     LSLASTNodeList<T>(ScriptContext *ctx, class LSLASTNode *nodes ) : LSLASTNodeList(ctx) {
+      _mNodeType = NODE_AST_NODE_LIST;
       if (nodes)
         pushChild(nodes);
     };
     virtual std::string getNodeName() { return "ast node list"; }
-    virtual LSLNodeType getNodeType() { return NODE_AST_NODE_LIST; };
 
     node_child_iterator<T> begin() { return node_child_iterator<T>(static_cast<T*>(_mChildren)); }
     node_child_iterator<T> end()   { return node_child_iterator<T>(nullptr); }
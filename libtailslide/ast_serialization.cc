@@ -0,0 +1,1187 @@
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+#include "ast_serialization.hh"
+#include "portable_endian.hh"
+
+namespace Tailslide {
+
+static const char AST_MAGIC[4] = {'T', 'S', 'A', 'B'};
+// for unset strings and types
+static const uint32_t NO_STRING = 0xFFFFFFFF;
+static const uint8_t NO_ITYPE = 0xFF;
+
+// records are copied in and out as-is, make sure there's no padding.
+static_assert(sizeof(SerializedHeader) == 80);
+static_assert(sizeof(SerializedNode) == 64);
+static_assert(sizeof(SerializedSymbol) == 52);
+static_assert(sizeof(SerializedTable) == 24);
+
+enum SerializedHeaderFlags : uint32_t {
+  HF_AST_SANE = 1 << 0,
+  HF_USAGE_TRACKED = 1 << 1,
+};
+
+enum SerializedNodeFlags : uint32_t {
+  NF_STATIC = 1 << 0,
+  NF_SYNTHESIZED = 1 << 1,
+  NF_DECLARATION_ALLOWED = 1 << 2,
+  NF_CONSTANT_PRECLUDED = 1 << 3,
+  NF_RESULT_NEEDED = 1 << 4,
+  NF_WAS_NEGATED = 1 << 5,
+  NF_BREAK_LIKE = 1 << 6,
+  NF_CONTINUE_LIKE = 1 << 7,
+  NF_FOLDABLE = 1 << 8,
+};
+
+enum SerializedSymbolFlags : uint8_t {
+  SF_CONSTANT_PRECLUDED = 1 << 0,
+  SF_ALL_PATHS_RETURN = 1 << 1,
+  SF_HAS_JUMPS = 1 << 2,
+  SF_HAS_UNSTRUCTURED_JUMPS = 1 << 3,
+  // owned by the builtins table rather than the script, only the name and type are kept.
+  SF_SHARED_BUILTIN = 1 << 4,
+};
+
+enum SerializedTableFlags : uint32_t {
+  TF_REGISTERED = 1 << 0,
+};
+
+// Which shared constant a static node stands in for, kept in its first payload slot
+enum SerializedStaticKind : uint32_t {
+  STATIC_DEFAULT_VALUE = 1,
+  STATIC_ONE_VALUE,
+  STATIC_BUILTIN_CONSTANT,
+};
+
+// Converting to and from little-endian are the same operation
+static void swap_le(uint32_t &val) { val = htole32(val); }
+static void swap_le(int32_t &val) { val = (int32_t)htole32((uint32_t)val); }
+
+static void swap_le(SerializedSection &section) {
+  swap_le(section.offset);
+  swap_le(section.count);
+}
+
+static void swap_le(SerializedHeader &header) {
+  swap_le(header.version);
+  header.builtins_fingerprint = htole64(header.builtins_fingerprint);
+  swap_le(header.flags);
+  swap_le(header.root);
+  for (auto &val : header.loc)
+    swap_le(val);
+  swap_le(header.nodes);
+  swap_le(header.symbols);
+  swap_le(header.tables);
+  swap_le(header.refs);
+  swap_le(header.strings);
+}
+
+static void swap_le(SerializedNode &rec) {
+  swap_le(rec.flags);
+  swap_le(rec.first_child);
+  swap_le(rec.num_children);
+  swap_le(rec.constant_value);
+  swap_le(rec.symbol_table);
+  swap_le(rec.symbol);
+  for (auto &val : rec.loc)
+    swap_le(val);
+  for (auto &val : rec.payload)
+    swap_le(val);
+  swap_le(rec.reserved);
+}
+
+static void swap_le(SerializedSymbol &rec) {
+  swap_le(rec.name);
+  swap_le(rec.mangled_name);
+  for (auto &val : rec.loc)
+    swap_le(val);
+  swap_le(rec.function_decl);
+  swap_le(rec.var_decl);
+  swap_le(rec.label_decl);
+  swap_le(rec.constant_value);
+  swap_le(rec.references);
+  swap_le(rec.assignments);
+}
+
+static void swap_le(SerializedTable &rec) {
+  swap_le(rec.table_type);
+  swap_le(rec.flags);
+  swap_le(rec.first_symbol);
+  swap_le(rec.num_symbols);
+  swap_le(rec.first_label);
+  swap_le(rec.num_labels);
+}
+
+static void write_loc(int32_t *out, YYLTYPE *loc) {
+  out[0] = loc->first_line;
+  out[1] = loc->first_column;
+  out[2] = loc->last_line;
+  out[3] = loc->last_column;
+}
+
+static YYLTYPE read_loc(const int32_t *loc) {
+  return {loc[0], loc[1], loc[2], loc[3]};
+}
+
+static uint32_t float_bits(float val) {
+  uint32_t bits;
+  memcpy(&bits, &val, sizeof(bits));
+  return bits;
+}
+
+static float bits_float(uint32_t bits) {
+  float val;
+  memcpy(&val, &bits, sizeof(val));
+  return val;
+}
+
+
+class ScriptSerializer {
+  public:
+    explicit ScriptSerializer(LSLScript *script) : _mScript(script), _mContext(script->mContext) {}
+    std::string serialize();
+
+  private:
+    void indexTree(LSLASTNode *root);
+    void indexReferenced(LSLASTNode *node);
+    void indexSymbol(LSLSymbol *symbol);
+    void indexTable(LSLSymbolTable *table, bool registered);
+    // `index*()` everything the indexed nodes, symbols and tables refer to
+    void indexReferences();
+
+    uint32_t nodeRef(LSLASTNode *node);
+    uint32_t symbolRef(LSLSymbol *symbol);
+    uint32_t tableRef(LSLSymbolTable *table);
+    uint32_t addString(const char *str);
+    // event handlers' symbols are "builtin" too, but belong to the script
+    bool isSharedBuiltin(LSLSymbol *symbol);
+
+    SerializedNode makeNodeRecord(LSLASTNode *node);
+    bool makeStaticRecord(LSLASTNode *node, SerializedNode &rec);
+    SerializedSymbol makeSymbolRecord(LSLSymbol *symbol);
+    SerializedTable makeTableRecord(LSLSymbolTable *table, bool registered);
+
+    LSLScript *_mScript;
+    ScriptContext *_mContext;
+
+    std::vector<LSLASTNode *> _mNodes;
+    std::unordered_map<LSLASTNode *, uint32_t> _mNodeIndices;
+    std::vector<LSLSymbol *> _mSymbols;
+    std::unordered_map<LSLSymbol *, uint32_t> _mSymbolIndices;
+    std::vector<std::pair<LSLSymbolTable *, bool>> _mTables;
+    std::unordered_map<LSLSymbolTable *, uint32_t> _mTableIndices;
+    // builtin constant -> the name of its symbol, only filled in if needed
+    std::unordered_map<LSLASTNode *, const char *> _mBuiltinConstants;
+
+    std::vector<uint32_t> _mRefs;
+    std::string _mStrings;
+    std::unordered_map<std::string, uint32_t> _mStringOffsets;
+};
+
+void ScriptSerializer::indexTree(LSLASTNode *root) {
+  std::vector<LSLASTNode *> stack {root};
+  while (!stack.empty()) {
+    LSLASTNode *node = stack.back();
+    stack.pop_back();
+    // anything already indexed had its whole subtree indexed along with it
+    if (_mNodeIndices.count(node))
+      continue;
+    _mNodeIndices[node] = (uint32_t)_mNodes.size();
+    _mNodes.push_back(node);
+    // pre-order, so push the children last to first
+    for (int i = node->getNumChildren() - 1; i >= 0; --i)
+      stack.push_back(node->getChild(i));
+  }
+}
+
+void ScriptSerializer::indexReferenced(LSLASTNode *node) {
+  if (!node || _mNodeIndices.count(node))
+    return;
+  // May have been pruned from the tree but still be referred to, keep whatever
+  // tree it's part of around so it's the same shape when it comes back.
+  indexTree(node->isStatic() ? node : node->getRoot());
+}
+
+void ScriptSerializer::indexSymbol(LSLSymbol *symbol) {
+  if (!symbol || _mSymbolIndices.count(symbol))
+    return;
+  _mSymbolIndices[symbol] = (uint32_t)_mSymbols.size();
+  _mSymbols.push_back(symbol);
+}
+
+void ScriptSerializer::indexTable(LSLSymbolTable *table, bool registered) {
+  if (!table || _mTableIndices.count(table))
+    return;
+  _mTableIndices[table] = (uint32_t)_mTables.size();
+  _mTables.emplace_back(table, registered);
+}
+
+void ScriptSerializer::indexReferences() {
+  size_t node_pos = 0, symbol_pos = 0, table_pos = 0;
+  while (node_pos < _mNodes.size() || symbol_pos < _mSymbols.size() || table_pos < _mTables.size()) {
+    for (; node_pos < _mNodes.size(); ++node_pos) {
+      LSLASTNode *node = _mNodes[node_pos];
+      if (node->isStatic())
+        continue;
+      // the stored value, not whatever the node would compute.
+      indexReferenced(node->LSLASTNode::getConstantValue());
+      indexTable(node->getSymbolTable(), false);
+      if (node->getNodeType() == NODE_IDENTIFIER) {
+        indexSymbol(((LSLIdentifier *)node)->getSymbol());
+        indexSymbol(((LSLIdentifier *)node)->getEnclosingFunction());
+      }
+    }
+    for (; symbol_pos < _mSymbols.size(); ++symbol_pos) {
+      LSLSymbol *symbol = _mSymbols[symbol_pos];
+      // these are looked up by name when loading
+      if (isSharedBuiltin(symbol))
+        continue;
+      indexReferenced(symbol->getFunctionDecl());
+      indexReferenced(symbol->getVarDecl());
+      indexReferenced((LSLASTNode *)symbol->getLabelDecl());
+      indexReferenced(symbol->getConstantValue());
+    }
+    for (; table_pos < _mTables.size(); ++table_pos) {
+      LSLSymbolTable *table = _mTables[table_pos].first;
+      if (table == _mContext->builtins)
+        continue;
+      for (auto *symbol : table->getSymbols())
+        indexSymbol(symbol);
+      if (table->getTableType() == SYMTAB_FUNCTION) {
+        for (auto *label : table->getLabels())
+          indexReferenced((LSLASTNode *)label);
+      }
+    }
+  }
+}
+
+uint32_t ScriptSerializer::nodeRef(LSLASTNode *node) {
+  if (!node)
+    return 0;
+  return _mNodeIndices.at(node) + 1;
+}
+
+uint32_t ScriptSerializer::symbolRef(LSLSymbol *symbol) {
+  if (!symbol)
+    return 0;
+  return _mSymbolIndices.at(symbol) + 1;
+}
+
+uint32_t ScriptSerializer::tableRef(LSLSymbolTable *table) {
+  if (!table)
+    return 0;
+  return _mTableIndices.at(table) + 1;
+}
+
+uint32_t ScriptSerializer::addString(const char *str) {
+  if (!str)
+    return NO_STRING;
+  auto inserted = _mStringOffsets.emplace(str, (uint32_t)_mStrings.size());
+  if (inserted.second) {
+    _mStrings += str;
+    _mStrings += '\0';
+  }
+  return inserted.first->second;
+}
+
+bool ScriptSerializer::isSharedBuiltin(LSLSymbol *symbol) {
+  return symbol->getSubType() == SYM_BUILTIN
+      && _mContext->builtins->lookup(symbol->getName(), symbol->getSymbolType()) == symbol;
+}
+
+bool ScriptSerializer::makeStaticRecord(LSLASTNode *node, SerializedNode &rec) {
+  for (int i = 0; i < LST_MAX; ++i) {
+    LSLType *type = TYPE((LSLIType)i);
+    if (node == type->getDefaultValue()) {
+      rec.payload[0] = STATIC_DEFAULT_VALUE;
+      rec.payload[1] = i;
+      return true;
+    }
+    if (node == type->getOneValue()) {
+      rec.payload[0] = STATIC_ONE_VALUE;
+      rec.payload[1] = i;
+      return true;
+    }
+  }
+  if (_mBuiltinConstants.empty()) {
+    for (auto *symbol : _mContext->builtins->getSymbols()) {
+      if (auto *constant = symbol->getConstantValue())
+        _mBuiltinConstants[constant] = symbol->getName();
+    }
+  }
+  auto builtin_iter = _mBuiltinConstants.find(node);
+  if (builtin_iter != _mBuiltinConstants.end()) {
+    rec.payload[0] = STATIC_BUILTIN_CONSTANT;
+    rec.payload[1] = addString(builtin_iter->second);
+    return true;
+  }
+  return false;
+}
+
+SerializedNode ScriptSerializer::makeNodeRecord(LSLASTNode *node) {
+  SerializedNode rec {};
+  rec.node_type = node->getNodeType();
+  rec.sub_type = node->getNodeSubType();
+  rec.itype = node->getType() ? node->getIType() : NO_ITYPE;
+  write_loc(rec.loc, node->getLoc());
+
+  // Some static node we don't know how to refer to gets written out as a copy
+  if (node->isStatic() && makeStaticRecord(node, rec)) {
+    rec.flags = NF_STATIC;
+    return rec;
+  }
+
+  if (node->getSynthesized())
+    rec.flags |= NF_SYNTHESIZED;
+  if (node->getDeclarationAllowed())
+    rec.flags |= NF_DECLARATION_ALLOWED;
+  if (node->getConstantPrecluded())
+    rec.flags |= NF_CONSTANT_PRECLUDED;
+  rec.constant_value = nodeRef(node->LSLASTNode::getConstantValue());
+  rec.symbol_table = tableRef(node->getSymbolTable());
+
+  rec.first_child = (uint32_t)_mRefs.size();
+  rec.num_children = node->getNumChildren();
+  for (auto *child : *node)
+    _mRefs.push_back(nodeRef(child));
+
+  switch (node->getNodeType()) {
+    case NODE_IDENTIFIER: {
+      auto *ident = (LSLIdentifier *)node;
+      rec.symbol = symbolRef(ident->getSymbol());
+      rec.payload[0] = addString(ident->getName());
+      rec.payload[1] = symbolRef(ident->getEnclosingFunction());
+      break;
+    }
+    case NODE_CONSTANT: {
+      auto *constant = (LSLConstant *)node;
+      if (constant->wasNegated())
+        rec.flags |= NF_WAS_NEGATED;
+      switch (node->getNodeSubType()) {
+        case NODE_INTEGER_CONSTANT:
+          rec.payload[0] = (uint32_t)((LSLIntegerConstant *)node)->getValue();
+          break;
+        case NODE_FLOAT_CONSTANT: {
+          double val = ((LSLFloatConstant *)node)->getValue();
+          uint64_t bits;
+          memcpy(&bits, &val, sizeof(bits));
+          rec.payload[0] = (uint32_t)bits;
+          rec.payload[1] = (uint32_t)(bits >> 32);
+          break;
+        }
+        case NODE_STRING_CONSTANT:
+        case NODE_KEY_CONSTANT:
+          rec.payload[0] = addString(((LSLStringConstant *)node)->getValue());
+          break;
+        case NODE_VECTOR_CONSTANT: {
+          const Vector3 *val = ((LSLVectorConstant *)node)->getValue();
+          rec.payload[0] = float_bits(val->x);
+          rec.payload[1] = float_bits(val->y);
+          rec.payload[2] = float_bits(val->z);
+          break;
+        }
+        case NODE_QUATERNION_CONSTANT: {
+          const Quaternion *val = ((LSLQuaternionConstant *)node)->getValue();
+          rec.payload[0] = float_bits(val->x);
+          rec.payload[1] = float_bits(val->y);
+          rec.payload[2] = float_bits(val->z);
+          rec.payload[3] = float_bits(val->s);
+          break;
+        }
+        default:
+          break;
+      }
+      break;
+    }
+    case NODE_STATEMENT:
+      if (node->getNodeSubType() == NODE_JUMP_STATEMENT) {
+        auto *jump = (LSLJumpStatement *)node;
+        if (jump->getIsBreakLike())
+          rec.flags |= NF_BREAK_LIKE;
+        if (jump->getIsContinueLike())
+          rec.flags |= NF_CONTINUE_LIKE;
+      }
+      break;
+    case NODE_EXPRESSION: {
+      auto *expr = (LSLExpression *)node;
+      rec.operation = expr->getOperation();
+      if (expr->getResultNeeded())
+        rec.flags |= NF_RESULT_NEEDED;
+      if (node->getNodeSubType() == NODE_LVALUE_EXPRESSION && ((LSLLValueExpression *)node)->getIsFoldable())
+        rec.flags |= NF_FOLDABLE;
+      break;
+    }
+    default:
+      break;
+  }
+  return rec;
+}
+
+SerializedSymbol ScriptSerializer::makeSymbolRecord(LSLSymbol *symbol) {
+  SerializedSymbol rec {};
+  rec.name = addString(symbol->getName());
+  rec.itype = symbol->getType() ? symbol->getIType() : NO_ITYPE;
+  rec.symbol_type = (uint8_t)symbol->getSymbolType();
+  rec.sub_type = (uint8_t)symbol->getSubType();
+  rec.mangled_name = NO_STRING;
+  if (isSharedBuiltin(symbol)) {
+    rec.flags = SF_SHARED_BUILTIN;
+    return rec;
+  }
+
+  rec.mangled_name = addString(symbol->getMangledName());
+  write_loc(rec.loc, symbol->getLoc());
+  rec.function_decl = nodeRef(symbol->getFunctionDecl());
+  rec.var_decl = nodeRef(symbol->getVarDecl());
+  rec.label_decl = nodeRef((LSLASTNode *)symbol->getLabelDecl());
+  rec.constant_value = nodeRef(symbol->getConstantValue());
+  rec.references = symbol->getReferences();
+  rec.assignments = symbol->getAssignments();
+  if (symbol->getConstantPrecluded())
+    rec.flags |= SF_CONSTANT_PRECLUDED;
+  if (symbol->getAllPathsReturn())
+    rec.flags |= SF_ALL_PATHS_RETURN;
+  if (symbol->getHasJumps())
+    rec.flags |= SF_HAS_JUMPS;
+  if (symbol->getHasUnstructuredJumps())
+    rec.flags |= SF_HAS_UNSTRUCTURED_JUMPS;
+  return rec;
+}
+
+SerializedTable ScriptSerializer::makeTableRecord(LSLSymbolTable *table, bool registered) {
+  SerializedTable rec {};
+  if (table == _mContext->builtins) {
+    rec.table_type = SYMTAB_BUILTINS;
+    return rec;
+  }
+  rec.table_type = table->getTableType();
+  if (registered)
+    rec.flags |= TF_REGISTERED;
+  // Symbols come back out of the table in the order they were defined,
+  // the loader defines them in the same order to get the same table.
+  rec.first_symbol = (uint32_t)_mRefs.size();
+  for (auto *symbol : table->getSymbols())
+    _mRefs.push_back(symbolRef(symbol));
+  rec.num_symbols = (uint32_t)_mRefs.size() - rec.first_symbol;
+  rec.first_label = (uint32_t)_mRefs.size();
+  if (table->getTableType() == SYMTAB_FUNCTION) {
+    for (auto *label : table->getLabels())
+      _mRefs.push_back(nodeRef((LSLASTNode *)label));
+  }
+  rec.num_labels = (uint32_t)_mRefs.size() - rec.first_label;
+  return rec;
+}
+
+template<typename T>
+static SerializedSection append_records(std::string &out, std::vector<T> &records) {
+  // keep every section aligned for anyone reading records in place
+  out.resize((out.size() + 7) & ~(size_t)7, '\0');
+  SerializedSection section {(uint32_t)out.size(), (uint32_t)records.size()};
+  for (auto &rec : records)
+    swap_le(rec);
+  out.append((const char *)records.data(), records.size() * sizeof(T));
+  return section;
+}
+
+std::string ScriptSerializer::serialize() {
+  // tables must come back in the same order for `setMangledNames()`
+  for (auto *table : _mContext->table_manager->getTables())
+    indexTable(table, true);
+  indexTree(_mScript);
+  indexReferences();
+
+  std::vector<SerializedNode> nodes;
+  nodes.reserve(_mNodes.size());
+  for (auto *node : _mNodes)
+    nodes.push_back(makeNodeRecord(node));
+  std::vector<SerializedSymbol> symbols;
+  symbols.reserve(_mSymbols.size());
+  for (auto *symbol : _mSymbols)
+    symbols.push_back(makeSymbolRecord(symbol));
+  std::vector<SerializedTable> tables;
+  tables.reserve(_mTables.size());
+  for (auto &table : _mTables)
+    tables.push_back(makeTableRecord(table.first, table.second));
+
+  SerializedHeader header {};
+  memcpy(header.magic, AST_MAGIC, sizeof(AST_MAGIC));
+  header.version = AST_FORMAT_VERSION;
+  header.builtins_fingerprint = tailslide_get_builtins_fingerprint();
+  header.flags = _mContext->ast_sane ? HF_AST_SANE : 0;
+  if (_mContext->usage_tracked)
+    header.flags |= HF_USAGE_TRACKED;
+  header.root = nodeRef(_mScript);
+  write_loc(header.loc, &_mContext->glloc);
+
+  std::string out(sizeof(SerializedHeader), '\0');
+  header.nodes = append_records(out, nodes);
+  header.symbols = append_records(out, symbols);
+  header.tables = append_records(out, tables);
+  for (auto &ref : _mRefs)
+    swap_le(ref);
+  header.refs = append_records(out, _mRefs);
+  header.strings = {(uint32_t)out.size(), (uint32_t)_mStrings.size()};
+  out += _mStrings;
+
+  swap_le(header);
+  memcpy(&out[0], &header, sizeof(header));
+  return out;
+}
+
+std::string serialize_script(LSLScript *script) {
+  ScopedPass pass(script->mContext, "serialize");
+  return ScriptSerializer(script).serialize();
+}
+
+
+class ScriptDeserializer {
+  public:
+    ScriptDeserializer(ScriptContext *ctx, const char *buf, size_t buf_len)
+      : _mContext(ctx), _mAllocator(ctx->allocator), _mBuf(buf), _mBufLen(buf_len) {}
+    LSLScript *deserialize();
+
+  private:
+    bool readHeader();
+    bool checkSection(const SerializedSection &section, size_t record_size) const;
+    bool buildNodes();
+    LSLASTNode *createNode(const SerializedNode &rec, const std::vector<LSLASTNode *> &children);
+    LSLConstant *createConstant(const SerializedNode &rec, const std::vector<LSLASTNode *> &children);
+    LSLConstant *resolveStatic(const SerializedNode &rec);
+    bool buildTables();
+    bool buildSymbols();
+    bool fillTables();
+    bool fixupNodes();
+
+    // these all flag the data as invalid when given something out of bounds
+    SerializedNode getNodeRecord(uint32_t idx);
+    uint32_t getRef(uint32_t idx);
+    LSLASTNode *getNode(uint32_t ref);
+    LSLConstant *getConstant(uint32_t ref);
+    LSLSymbol *getSymbol(uint32_t ref);
+    LSLSymbolTable *getTable(uint32_t ref);
+    const char *getString(uint32_t offset);
+    LSLType *getType(uint8_t itype);
+    bool checkRange(uint32_t first, uint32_t count);
+
+    ScriptContext *_mContext;
+    ScriptAllocator *_mAllocator;
+    const char *_mBuf;
+    size_t _mBufLen;
+    SerializedHeader _mHeader {};
+    bool _mValid = true;
+
+    std::vector<LSLASTNode *> _mNodes;
+    std::vector<LSLSymbol *> _mSymbols;
+    std::vector<LSLSymbolTable *> _mTables;
+};
+
+template<typename T>
+static T read_record(const char *buf, const SerializedSection &section, uint32_t idx) {
+  T rec;
+  // records may not be aligned if the buffer itself isn't
+  memcpy(&rec, buf + section.offset + (size_t)idx * sizeof(T), sizeof(T));
+  swap_le(rec);
+  return rec;
+}
+
+bool ScriptDeserializer::checkSection(const SerializedSection &section, size_t record_size) const {
+  return (uint64_t)section.offset + (uint64_t)section.count * record_size <= _mBufLen;
+}
+
+bool ScriptDeserializer::readHeader() {
+  if (_mBufLen < sizeof(SerializedHeader))
+    return false;
+  memcpy(&_mHeader, _mBuf, sizeof(_mHeader));
+  swap_le(_mHeader);
+  if (memcmp(_mHeader.magic, AST_MAGIC, sizeof(AST_MAGIC)) != 0 || _mHeader.version != AST_FORMAT_VERSION)
+    return false;
+  if (_mHeader.builtins_fingerprint != tailslide_get_builtins_fingerprint())
+    return false;
+  return checkSection(_mHeader.nodes, sizeof(SerializedNode))
+      && checkSection(_mHeader.symbols, sizeof(SerializedSymbol))
+      && checkSection(_mHeader.tables, sizeof(SerializedTable))
+      && checkSection(_mHeader.refs, sizeof(uint32_t))
+      && checkSection(_mHeader.strings, 1);
+}
+
+SerializedNode ScriptDeserializer::getNodeRecord(uint32_t idx) {
+  return read_record<SerializedNode>(_mBuf, _mHeader.nodes, idx);
+}
+
+bool ScriptDeserializer::checkRange(uint32_t first, uint32_t count) {
+  if ((uint64_t)first + count > _mHeader.refs.count)
+    _mValid = false;
+  return _mValid;
+}
+
+uint32_t ScriptDeserializer::getRef(uint32_t idx) {
+  if (idx >= _mHeader.refs.count) {
+    _mValid = false;
+    return 0;
+  }
+  return read_record<uint32_t>(_mBuf, _mHeader.refs, idx);
+}
+
+LSLASTNode *ScriptDeserializer::getNode(uint32_t ref) {
+  if (ref > _mNodes.size()) {
+    _mValid = false;
+    return nullptr;
+  }
+  return ref ? _mNodes[ref - 1] : nullptr;
+}
+
+LSLConstant *ScriptDeserializer::getConstant(uint32_t ref) {
+  LSLASTNode *node = getNode(ref);
+  if (node && node->getNodeType() != NODE_CONSTANT) {
+    _mValid = false;
+    return nullptr;
+  }
+  return (LSLConstant *)node;
+}
+
+LSLSymbol *ScriptDeserializer::getSymbol(uint32_t ref) {
+  if (ref > _mSymbols.size()) {
+    _mValid = false;
+    return nullptr;
+  }
+  return ref ? _mSymbols[ref - 1] : nullptr;
+}
+
+LSLSymbolTable *ScriptDeserializer::getTable(uint32_t ref) {
+  if (ref > _mTables.size()) {
+    _mValid = false;
+    return nullptr;
+  }
+  return ref ? _mTables[ref - 1] : nullptr;
+}
+
+const char *ScriptDeserializer::getString(uint32_t offset) {
+  if (offset == NO_STRING)
+    return nullptr;
+  const char *strings = _mBuf + _mHeader.strings.offset;
+  if (offset >= _mHeader.strings.count || !memchr(strings + offset, '\0', _mHeader.strings.count - offset)) {
+    _mValid = false;
+    return nullptr;
+  }
+  return strings + offset;
+}
+
+LSLType *ScriptDeserializer::getType(uint8_t itype) {
+  if (itype == NO_ITYPE)
+    return nullptr;
+  if (itype >= LST_MAX) {
+    _mValid = false;
+    return nullptr;
+  }
+  return TYPE((LSLIType)itype);
+}
+
+// number of children a node of the given kind must have, -1 for list-like nodes
+// that may have any number, -2 if we don't know how to create it.
+static int get_node_arity(uint8_t node_type, uint8_t sub_type) {
+  switch (node_type) {
+    case NODE_NULL:
+    case NODE_IDENTIFIER:
+      return 0;
+    case NODE_AST_NODE_LIST:
+    case NODE_FUNCTION_DEC:
+    case NODE_EVENT_DEC:
+      return -1;
+    case NODE_SCRIPT:
+    case NODE_GLOBAL_VARIABLE:
+    case NODE_STATE:
+      return 2;
+    case NODE_GLOBAL_FUNCTION:
+    case NODE_EVENT_HANDLER:
+      return 3;
+    case NODE_CONSTANT:
+      switch (sub_type) {
+        case NODE_INTEGER_CONSTANT:
+        case NODE_FLOAT_CONSTANT:
+        case NODE_STRING_CONSTANT:
+        case NODE_KEY_CONSTANT:
+        case NODE_VECTOR_CONSTANT:
+        case NODE_QUATERNION_CONSTANT:
+          return 0;
+        case NODE_LIST_CONSTANT:
+          return -1;
+        default:
+          return -2;
+      }
+    case NODE_STATEMENT:
+      switch (sub_type) {
+        case NODE_NO_SUB_TYPE:
+        case NODE_COMPOUND_STATEMENT:
+          return -1;
+        case NODE_NOP_STATEMENT:
+          return 0;
+        case NODE_EXPRESSION_STATEMENT:
+        case NODE_RETURN_STATEMENT:
+        case NODE_LABEL:
+        case NODE_JUMP_STATEMENT:
+        case NODE_STATE_STATEMENT:
+          return 1;
+        case NODE_DO_STATEMENT:
+        case NODE_WHILE_STATEMENT:
+        case NODE_DECLARATION:
+          return 2;
+        case NODE_IF_STATEMENT:
+          return 3;
+        case NODE_FOR_STATEMENT:
+          return 4;
+        default:
+          return -2;
+      }
+    case NODE_EXPRESSION:
+      switch (sub_type) {
+        case NODE_NO_SUB_TYPE:
+        case NODE_LIST_EXPRESSION:
+          return -1;
+        case NODE_TYPECAST_EXPRESSION:
+        case NODE_BOOL_CONVERSION_EXPRESSION:
+        case NODE_PRINT_EXPRESSION:
+        case NODE_UNARY_EXPRESSION:
+        case NODE_PARENTHESIS_EXPRESSION:
+        case NODE_CONSTANT_EXPRESSION:
+          return 1;
+        case NODE_FUNCTION_EXPRESSION:
+        case NODE_LVALUE_EXPRESSION:
+        case NODE_BINARY_EXPRESSION:
+          return 2;
+        case NODE_VECTOR_EXPRESSION:
+          return 3;
+        case NODE_QUATERNION_EXPRESSION:
+          return 4;
+        default:
+          return -2;
+      }
+    default:
+      return -2;
+  }
+}
+
+LSLConstant *ScriptDeserializer::resolveStatic(const SerializedNode &rec) {
+  LSLConstant *constant = nullptr;
+  switch (rec.payload[0]) {
+    case STATIC_DEFAULT_VALUE:
+      if (rec.payload[1] < LST_MAX)
+        constant = TYPE((LSLIType)rec.payload[1])->getDefaultValue();
+      break;
+    case STATIC_ONE_VALUE:
+      if (rec.payload[1] < LST_MAX)
+        constant = TYPE((LSLIType)rec.payload[1])->getOneValue();
+      break;
+    case STATIC_BUILTIN_CONSTANT: {
+      const char *name = getString(rec.payload[1]);
+      if (!name)
+        break;
+      if (LSLSymbol *symbol = _mContext->builtins->lookup(name, SYM_VARIABLE))
+        constant = symbol->getConstantValue();
+      break;
+    }
+    default:
+      break;
+  }
+  if (!constant || rec.node_type != NODE_CONSTANT || rec.num_children)
+    _mValid = false;
+  return constant;
+}
+
+LSLConstant *ScriptDeserializer::createConstant(const SerializedNode &rec, const std::vector<LSLASTNode *> &children) {
+  switch (rec.sub_type) {
+    case NODE_INTEGER_CONSTANT:
+      return _mAllocator->newTracked<LSLIntegerConstant>((int)rec.payload[0]);
+    case NODE_FLOAT_CONSTANT: {
+      uint64_t bits = ((uint64_t)rec.payload[1] << 32) | rec.payload[0];
+      double val;
+      memcpy(&val, &bits, sizeof(val));
+      return _mAllocator->newTracked<LSLFloatConstant>(val);
+    }
+    case NODE_STRING_CONSTANT:
+    case NODE_KEY_CONSTANT: {
+      const char *str = getString(rec.payload[0]);
+      if (!str)
+        return nullptr;
+      str = _mAllocator->copyStr(str);
+      if (rec.sub_type == NODE_KEY_CONSTANT)
+        return _mAllocator->newTracked<LSLKeyConstant>(str);
+      return _mAllocator->newTracked<LSLStringConstant>(str);
+    }
+    case NODE_VECTOR_CONSTANT:
+      return _mAllocator->newTracked<LSLVectorConstant>(
+          bits_float(rec.payload[0]), bits_float(rec.payload[1]), bits_float(rec.payload[2]));
+    case NODE_QUATERNION_CONSTANT:
+      return _mAllocator->newTracked<LSLQuaternionConstant>(
+          bits_float(rec.payload[0]), bits_float(rec.payload[1]),
+          bits_float(rec.payload[2]), bits_float(rec.payload[3]));
+    case NODE_LIST_CONSTANT: {
+      auto *list = _mAllocator->newTracked<LSLListConstant>(nullptr);
+      for (auto *child : children) {
+        if (child->getNodeType() != NODE_CONSTANT)
+          return nullptr;
+        list->pushChild(child);
+      }
+      return list;
+    }
+    default:
+      return nullptr;
+  }
+}
+
+LSLASTNode *ScriptDeserializer::createNode(const SerializedNode &rec, const std::vector<LSLASTNode *> &children) {
+  int arity = get_node_arity(rec.node_type, rec.sub_type);
+  if (arity == -2 || (arity >= 0 && (uint32_t)arity != children.size()))
+    return nullptr;
+  auto *a = _mAllocator;
+  auto child = [&](size_t i) { return children[i]; };
+  auto expr = [&](size_t i) { return (LSLExpression *)children[i]; };
+  auto stmt = [&](size_t i) { return (LSLStatement *)children[i]; };
+  auto ident = [&](size_t i) { return (LSLIdentifier *)children[i]; };
+
+  LSLASTNode *node = nullptr;
+  switch (rec.node_type) {
+    case NODE_NULL:
+      return a->newTracked<LSLASTNullNode>();
+    case NODE_IDENTIFIER: {
+      const char *name = getString(rec.payload[0]);
+      if (!name)
+        return nullptr;
+      return a->newTracked<LSLIdentifier>(TYPE(LST_NULL), name);
+    }
+    case NODE_CONSTANT:
+      return createConstant(rec, children);
+    case NODE_SCRIPT:
+      return a->newTracked<LSLScript>((LSLASTNodeList<LSLASTNode> *)child(0), (LSLASTNodeList<LSLState> *)child(1));
+    case NODE_GLOBAL_VARIABLE:
+      return a->newTracked<LSLGlobalVariable>(ident(0), expr(1));
+    case NODE_GLOBAL_FUNCTION:
+      return a->newTracked<LSLGlobalFunction>(ident(0), (LSLFunctionDec *)child(1), stmt(2));
+    case NODE_STATE:
+      return a->newTracked<LSLState>(ident(0), (LSLASTNodeList<LSLEventHandler> *)child(1));
+    case NODE_EVENT_HANDLER:
+      return a->newTracked<LSLEventHandler>(ident(0), (LSLEventDec *)child(1), stmt(2));
+    // list-like nodes get their children pushed on below
+    case NODE_AST_NODE_LIST:
+      node = a->newTracked<LSLASTNodeList<LSLASTNode>>();
+      break;
+    case NODE_FUNCTION_DEC:
+      node = a->newTracked<LSLFunctionDec>(nullptr);
+      break;
+    case NODE_EVENT_DEC:
+      node = a->newTracked<LSLEventDec>(nullptr);
+      break;
+    case NODE_STATEMENT:
+      switch (rec.sub_type) {
+        case NODE_NO_SUB_TYPE:
+          node = a->newTracked<LSLStatement>(0);
+          break;
+        case NODE_COMPOUND_STATEMENT:
+          node = a->newTracked<LSLCompoundStatement>(nullptr);
+          break;
+        case NODE_NOP_STATEMENT:
+          return a->newTracked<LSLNopStatement>();
+        case NODE_EXPRESSION_STATEMENT:
+          return a->newTracked<LSLExpressionStatement>(expr(0));
+        case NODE_RETURN_STATEMENT:
+          return a->newTracked<LSLReturnStatement>(expr(0));
+        case NODE_LABEL:
+          return a->newTracked<LSLLabel>(ident(0));
+        case NODE_JUMP_STATEMENT:
+          return a->newTracked<LSLJumpStatement>(ident(0));
+        case NODE_STATE_STATEMENT:
+          return a->newTracked<LSLStateStatement>(ident(0));
+        case NODE_DO_STATEMENT:
+          return a->newTracked<LSLDoStatement>(stmt(0), expr(1));
+        case NODE_WHILE_STATEMENT:
+          return a->newTracked<LSLWhileStatement>(expr(0), stmt(1));
+        case NODE_DECLARATION:
+          return a->newTracked<LSLDeclaration>(ident(0), expr(1));
+        case NODE_IF_STATEMENT:
+          return a->newTracked<LSLIfStatement>(expr(0), stmt(1), stmt(2));
+        case NODE_FOR_STATEMENT:
+          return a->newTracked<LSLForStatement>(
+              (LSLASTNodeList<LSLExpression> *)child(0), expr(1), (LSLASTNodeList<LSLExpression> *)child(2), stmt(3));
+        default:
+          return nullptr;
+      }
+      break;
+    case NODE_EXPRESSION:
+      switch (rec.sub_type) {
+        case NODE_NO_SUB_TYPE:
+          node = a->newTracked<LSLExpression>();
+          break;
+        case NODE_LIST_EXPRESSION:
+          node = a->newTracked<LSLListExpression>(nullptr);
+          break;
+        case NODE_TYPECAST_EXPRESSION:
+          return a->newTracked<LSLTypecastExpression>(getType(rec.itype), expr(0));
+        case NODE_BOOL_CONVERSION_EXPRESSION:
+          return a->newTracked<LSLBoolConversionExpression>(expr(0));
+        case NODE_PRINT_EXPRESSION:
+          return a->newTracked<LSLPrintExpression>(expr(0));
+        case NODE_UNARY_EXPRESSION:
+          return a->newTracked<LSLUnaryExpression>(expr(0), (LSLOperator)rec.operation);
+        case NODE_PARENTHESIS_EXPRESSION:
+          return a->newTracked<LSLParenthesisExpression>(expr(0));
+        case NODE_CONSTANT_EXPRESSION:
+          if (child(0)->getNodeType() != NODE_CONSTANT)
+            return nullptr;
+          return a->newTracked<LSLConstantExpression>((LSLConstant *)child(0));
+        case NODE_FUNCTION_EXPRESSION:
+          return a->newTracked<LSLFunctionExpression>(ident(0), (LSLASTNodeList<LSLExpression> *)child(1));
+        case NODE_LVALUE_EXPRESSION:
+          return a->newTracked<LSLLValueExpression>(ident(0), ident(1));
+        case NODE_BINARY_EXPRESSION:
+          return a->newTracked<LSLBinaryExpression>(expr(0), (LSLOperator)rec.operation, expr(1));
+        case NODE_VECTOR_EXPRESSION:
+          return a->newTracked<LSLVectorExpression>(expr(0), expr(1), expr(2));
+        case NODE_QUATERNION_EXPRESSION:
+          return a->newTracked<LSLQuaternionExpression>(expr(0), expr(1), expr(2), expr(3));
+        default:
+          return nullptr;
+      }
+      break;
+    default:
+      return nullptr;
+  }
+  for (auto *list_child : children)
+    node->pushChild(list_child);
+  return node;
+}
+
+bool ScriptDeserializer::buildNodes() {
+  uint32_t num_nodes = _mHeader.nodes.count;
+  // Every node has at most one parent and static nodes have none, which
+  // also means the children we're given can't form a cycle through the root.
+  std::vector<bool> has_parent(num_nodes, false);
+  std::vector<bool> is_static(num_nodes, false);
+  for (uint32_t i = 0; i < num_nodes; ++i)
+    is_static[i] = (getNodeRecord(i).flags & NF_STATIC) != 0;
+  for (uint32_t i = 0; i < num_nodes; ++i) {
+    SerializedNode rec = getNodeRecord(i);
+    if (!checkRange(rec.first_child, rec.num_children))
+      return false;
+    for (uint32_t j = 0; j < rec.num_children; ++j) {
+      uint32_t child_ref = getRef(rec.first_child + j);
+      if (child_ref == 0 || child_ref > num_nodes || child_ref - 1 == i)
+        return false;
+      if (has_parent[child_ref - 1] || is_static[child_ref - 1])
+        return false;
+      has_parent[child_ref - 1] = true;
+    }
+  }
+
+  // Children have to be created before their parents, walk each tree post-order.
+  enum { NODE_UNVISITED, NODE_VISITING, NODE_BUILT };
+  std::vector<uint8_t> state(num_nodes, NODE_UNVISITED);
+  _mNodes.resize(num_nodes, nullptr);
+  std::vector<uint32_t> stack;
+  std::vector<LSLASTNode *> children;
+  for (uint32_t i = 0; i < num_nodes; ++i) {
+    if (state[i] != NODE_UNVISITED)
+      continue;
+    stack.push_back(i);
+    while (!stack.empty()) {
+      uint32_t idx = stack.back();
+      SerializedNode rec = getNodeRecord(idx);
+      if (state[idx] == NODE_UNVISITED) {
+        state[idx] = NODE_VISITING;
+        for (uint32_t j = 0; j < rec.num_children; ++j) {
+          uint32_t child_idx = getRef(rec.first_child + j) - 1;
+          // only possible if the children form a cycle
+          if (state[child_idx] == NODE_VISITING)
+            return false;
+          if (state[child_idx] == NODE_UNVISITED)
+            stack.push_back(child_idx);
+        }
+        continue;
+      }
+      stack.pop_back();
+      state[idx] = NODE_BUILT;
+
+      if (rec.flags & NF_STATIC) {
+        _mNodes[idx] = resolveStatic(rec);
+      } else {
+        children.clear();
+        for (uint32_t j = 0; j < rec.num_children; ++j)
+          children.push_back(_mNodes[getRef(rec.first_child + j) - 1]);
+        _mNodes[idx] = createNode(rec, children);
+      }
+      if (!_mNodes[idx] || !_mValid)
+        return false;
+    }
+  }
+  return true;
+}
+
+bool ScriptDeserializer::buildTables() {
+  _mTables.reserve(_mHeader.tables.count);
+  for (uint32_t i = 0; i < _mHeader.tables.count; ++i) {
+    auto rec = read_record<SerializedTable>(_mBuf, _mHeader.tables, i);
+    if (rec.table_type > SYMTAB_BUILTINS)
+      return false;
+    if (rec.table_type == SYMTAB_BUILTINS) {
+      _mTables.push_back(_mContext->builtins);
+      continue;
+    }
+    auto *table = _mAllocator->newTracked<LSLSymbolTable>((LSLSymbolTableType)rec.table_type);
+    if (rec.flags & TF_REGISTERED)
+      _mContext->table_manager->registerTable(table);
+    _mTables.push_back(table);
+  }
+  return true;
+}
+
+bool ScriptDeserializer::buildSymbols() {
+  _mSymbols.reserve(_mHeader.symbols.count);
+  for (uint32_t i = 0; i < _mHeader.symbols.count; ++i) {
+    auto rec = read_record<SerializedSymbol>(_mBuf, _mHeader.symbols, i);
+    const char *name = getString(rec.name);
+    if (!name || rec.symbol_type > SYM_EVENT || rec.sub_type > SYM_EVENT_PARAMETER)
+      return false;
+    if (rec.flags & SF_SHARED_BUILTIN) {
+      LSLSymbol *builtin = _mContext->builtins->lookup(name, (LSLSymbolType)rec.symbol_type);
+      if (!builtin)
+        return false;
+      _mSymbols.push_back(builtin);
+      continue;
+    }
+
+    LSLASTNode *function_decl = getNode(rec.function_decl);
+    LSLASTNode *label_decl = getNode(rec.label_decl);
+    if (function_decl) {
+      auto decl_type = function_decl->getNodeType();
+      if (decl_type != NODE_FUNCTION_DEC && decl_type != NODE_EVENT_DEC && decl_type != NODE_AST_NODE_LIST)
+        return false;
+    }
+    if (label_decl && label_decl->getNodeSubType() != NODE_LABEL)
+      return false;
+    YYLTYPE loc = read_loc(rec.loc);
+    auto *symbol = _mAllocator->newTracked<LSLSymbol>(
+        name, getType(rec.itype), (LSLSymbolType)rec.symbol_type, (LSLSymbolSubType)rec.sub_type, &loc,
+        (LSLParamList *)function_decl, getNode(rec.var_decl), (LSLLabel *)label_decl
+    );
+    symbol->setConstantValue(getConstant(rec.constant_value));
+    symbol->setConstantPrecluded(rec.flags & SF_CONSTANT_PRECLUDED);
+    symbol->setAllPathsReturn(rec.flags & SF_ALL_PATHS_RETURN);
+    symbol->setHasJumps(rec.flags & SF_HAS_JUMPS);
+    symbol->setHasUnstructuredJumps(rec.flags & SF_HAS_UNSTRUCTURED_JUMPS);
+    symbol->setTracking(rec.references, rec.assignments);
+    if (const char *mangled_name = getString(rec.mangled_name))
+      symbol->setMangledName(_mAllocator->copyStr(mangled_name));
+    _mSymbols.push_back(symbol);
+  }
+  return _mValid;
+}
+
+bool ScriptDeserializer::fillTables() {
+  for (uint32_t i = 0; i < _mHeader.tables.count; ++i) {
+    auto rec = read_record<SerializedTable>(_mBuf, _mHeader.tables, i);
+    LSLSymbolTable *table = _mTables[i];
+    if (table == _mContext->builtins)
+      continue;
+    if (!checkRange(rec.first_symbol, rec.num_symbols) || !checkRange(rec.first_label, rec.num_labels))
+      return false;
+    // see `ScriptSerializer::makeTableRecord()`
+    for (uint32_t j = 0; j < rec.num_symbols; ++j) {
+      LSLSymbol *symbol = getSymbol(getRef(rec.first_symbol + j));
+      if (!symbol || symbol->mContext != _mContext)
+        return false;
+      table->define(symbol);
+    }
+    if (!rec.num_labels)
+      continue;
+    if (rec.table_type != SYMTAB_FUNCTION)
+      return false;
+    std::vector<LSLLabel *> labels;
+    labels.reserve(rec.num_labels);
+    for (uint32_t j = 0; j < rec.num_labels; ++j) {
+      LSLASTNode *label = getNode(getRef(rec.first_label + j));
+      if (!label || label->getNodeSubType() != NODE_LABEL)
+        return false;
+      labels.push_back((LSLLabel *)label);
+    }
+    table->setLabels(labels);
+  }
+  return _mValid;
+}
+
+bool ScriptDeserializer::fixupNodes() {
+  for (uint32_t i = 0; i < _mHeader.nodes.count; ++i) {
+    auto rec = getNodeRecord(i);
+    if (rec.flags & NF_STATIC)
+      continue;
+    LSLASTNode *node = _mNodes[i];
+    YYLTYPE loc = read_loc(rec.loc);
+    node->setLoc(&loc);
+    node->setType(getType(rec.itype));
+    node->setSymbolTable(getTable(rec.symbol_table));
+    // clears the precluded flag, so must come first.
+    node->setConstantValue(getConstant(rec.constant_value));
+    node->setConstantPrecluded(rec.flags & NF_CONSTANT_PRECLUDED);
+    node->setSynthesized(rec.flags & NF_SYNTHESIZED);
+    node->setDeclarationAllowed(rec.flags & NF_DECLARATION_ALLOWED);
+    switch (node->getNodeType()) {
+      case NODE_IDENTIFIER:
+        ((LSLIdentifier *)node)->setSymbol(getSymbol(rec.symbol));
+        ((LSLIdentifier *)node)->setEnclosingFunction(getSymbol(rec.payload[1]));
+        break;
+      case NODE_CONSTANT:
+        ((LSLConstant *)node)->setWasNegated(rec.flags & NF_WAS_NEGATED);
+        break;
+      case NODE_STATEMENT:
+        if (node->getNodeSubType() == NODE_JUMP_STATEMENT) {
+          ((LSLJumpStatement *)node)->setIsBreakLike(rec.flags & NF_BREAK_LIKE);
+          ((LSLJumpStatement *)node)->setIsContinueLike(rec.flags & NF_CONTINUE_LIKE);
+        }
+        break;
+      case NODE_EXPRESSION:
+        ((LSLExpression *)node)->setOperation((LSLOperator)rec.operation);
+        ((LSLExpression *)node)->setResultNeeded(rec.flags & NF_RESULT_NEEDED);
+        if (node->getNodeSubType() == NODE_LVALUE_EXPRESSION)
+          ((LSLLValueExpression *)node)->setIsFoldable(rec.flags & NF_FOLDABLE);
+        break;
+      default:
+        break;
+    }
+  }
+  return _mValid;
+}
+
+LSLScript *ScriptDeserializer::deserialize() {
+  if (!readHeader())
+    return nullptr;
+  // Nodes first since everything else refers to them, then symbols because
+  // tables and nodes refer to those.
+  if (!buildNodes() || !buildTables() || !buildSymbols() || !fillTables() || !fixupNodes())
+    return nullptr;
+  LSLASTNode *root = getNode(_mHeader.root);
+  if (!_mValid || !root || root->getNodeType() != NODE_SCRIPT || root->getParent())
+    return nullptr;
+  _mContext->ast_sane = (_mHeader.flags & HF_AST_SANE) != 0;
+  _mContext->usage_tracked = (_mHeader.flags & HF_USAGE_TRACKED) != 0;
+  if (_mContext->usage_tracked) {
+    // the counts came along with the symbols, but only what's attached
+    // to the script was counted towards them.
+    ++_mContext->usage_epoch;
+    std::vector<LSLASTNode *> stack {root};
+    while (!stack.empty()) {
+      LSLASTNode *node = stack.back();
+      stack.pop_back();
+      node->setUsageCounted(true);
+      for (auto *child : *node)
+        stack.push_back(child);
+    }
+  }
+  _mContext->glloc = read_loc(_mHeader.loc);
+  return (LSLScript *)root;
+}
+
+LSLScript *deserialize_script(ScriptContext *ctx, const char *buf, size_t buf_len) {
+  ScopedPass pass(ctx, "deserialize");
+  return ScriptDeserializer(ctx, buf, buf_len).deserialize();
+}
+
+}
@@ -0,0 +1,102 @@
+#ifndef TAILSLIDE_AST_SERIALIZATION_HH
+#define TAILSLIDE_AST_SERIALIZATION_HH
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "lslmini.hh"
+
+namespace Tailslide {
+
+// bump whenever the layout of anything below changes
+const uint32_t AST_FORMAT_VERSION = 3;
+
+/*
+ * Binary form of an analyzed script. Everything is little-endian and refers to
+ * everything else by index or by byte offset from the start of the buffer, so a
+ * serialized script can be used straight out of an mmap()ed file.
+ *
+ * Node, symbol and table refs are the index of the record plus one, zero means none.
+ * Strings are referred to by their offset into the string section and are NUL-terminated.
+ * Static constants shared between scripts, like type default values, are referred to by
+ * what they are rather than copied so they come back as the same objects.
+ */
+
+struct SerializedSection {
+  uint32_t offset;
+  uint32_t count;
+};
+
+struct SerializedHeader {
+  char magic[4];
+  uint32_t version;
+  // builtin symbols are referred to by name, they must match the ones we serialized with.
+  uint64_t builtins_fingerprint;
+  uint32_t flags;
+  uint32_t root;
+  // the location new nodes will get, see `ScriptContext::glloc`
+  int32_t loc[4];
+  SerializedSection nodes;
+  SerializedSection symbols;
+  SerializedSection tables;
+  // uint32 refs, children and table entries are ranges of these
+  SerializedSection refs;
+  // count is in bytes
+  SerializedSection strings;
+};
+
+struct SerializedNode {
+  uint8_t node_type;
+  uint8_t sub_type;
+  uint8_t itype;
+  uint8_t operation;
+  uint32_t flags;
+  uint32_t first_child;
+  uint32_t num_children;
+  uint32_t constant_value;
+  uint32_t symbol_table;
+  uint32_t symbol;
+  int32_t loc[4];
+  // depends on the kind of node, constant values or an identifier's name
+  uint32_t payload[4];
+  uint32_t reserved;
+};
+
+struct SerializedSymbol {
+  uint32_t name;
+  uint32_t mangled_name;
+  uint8_t itype;
+  uint8_t symbol_type;
+  uint8_t sub_type;
+  uint8_t flags;
+  int32_t loc[4];
+  uint32_t function_decl;
+  uint32_t var_decl;
+  uint32_t label_decl;
+  uint32_t constant_value;
+  int32_t references;
+  int32_t assignments;
+};
+
+struct SerializedTable {
+  uint32_t table_type;
+  uint32_t flags;
+  uint32_t first_symbol;
+  uint32_t num_symbols;
+  uint32_t first_label;
+  uint32_t num_labels;
+};
+
+/// Write out `script` along with its symbol tables and constant values,
+/// usually after `analyze()` or `optimize()`.
+std::string serialize_script(LSLScript *script);
+
+/// Rebuild a script written by `serialize_script()` in `ctx`'s allocator.
+/// Returns nullptr if the data is malformed or was written with different builtins.
+/// Refs are bounds-checked, but the data is otherwise trusted to describe a sensible tree.
+LSLScript *deserialize_script(ScriptContext *ctx, const char *buf, size_t buf_len);
+
+}
+
+#endif
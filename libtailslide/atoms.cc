@@ -0,0 +1,79 @@
+#include <algorithm>
+
+#include "allocator.hh"
+#include "atoms.hh"
+
+namespace Tailslide {
+
+// FNV-1a
+uint32_t AtomTable::hashString(const char *str, size_t len) {
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < len; ++i) {
+    hash ^= (uint8_t)str[i];
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+size_t AtomTable::findSlot(const char *str, size_t len, uint32_t hash) const {
+  size_t mask = _mSlots.size() - 1;
+  for (size_t idx = hash & mask; ; idx = (idx + 1) & mask) {
+    const char *atom = _mSlots[idx];
+    if (atom == nullptr || atom == str)
+      return idx;
+    AtomHeader header = getHeader(atom);
+    if (header.hash == hash && header.length == len && !memcmp(atom, str, len))
+      return idx;
+  }
+}
+
+const char *AtomTable::intern(const char *str, size_t len) {
+  // keep the load factor under 1/2
+  if ((_mNumAtoms + 1) * 2 > _mSlots.size())
+    grow();
+
+  uint32_t hash = hashString(str, len);
+  size_t idx = findSlot(str, len, hash);
+  if (_mSlots[idx])
+    return _mSlots[idx];
+
+  AtomHeader header {hash, (uint32_t)len};
+  char *storage = _mAllocator->alloc(sizeof(AtomHeader) + len + 1);
+  memcpy(storage, &header, sizeof(AtomHeader));
+  char *atom = storage + sizeof(AtomHeader);
+  memcpy(atom, str, len);
+  atom[len] = '\0';
+  _mSlots[idx] = atom;
+  ++_mNumAtoms;
+  return atom;
+}
+
+const char *AtomTable::find(const char *str) const {
+  if (_mSlots.empty())
+    return nullptr;
+  size_t len = strlen(str);
+  return _mSlots[findSlot(str, len, hashString(str, len))];
+}
+
+void AtomTable::grow() {
+  std::vector<const char *> old_slots(_mSlots.empty() ? 64 : _mSlots.size() * 2, nullptr);
+  old_slots.swap(_mSlots);
+  size_t mask = _mSlots.size() - 1;
+  for (const char *atom : old_slots) {
+    if (!atom)
+      continue;
+    // no need to re-hash, atoms already know their hash.
+    size_t idx = getHash(atom) & mask;
+    while (_mSlots[idx])
+      idx = (idx + 1) & mask;
+    _mSlots[idx] = atom;
+  }
+}
+
+void AtomTable::reset() {
+  // keep the slots around for the next script
+  std::fill(_mSlots.begin(), _mSlots.end(), nullptr);
+  _mNumAtoms = 0;
+}
+
+}
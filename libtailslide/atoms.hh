@@ -0,0 +1,57 @@
+#ifndef TAILSLIDE_ATOMS_HH
+#define TAILSLIDE_ATOMS_HH
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace Tailslide {
+
+class ScriptAllocator;
+
+/// Interns strings so each distinct string is only stored once per allocator.
+/// Interned strings ("atoms") are plain NUL-terminated strings that may be
+/// compared and hashed by address alone, and remember the hash they were interned with.
+class AtomTable {
+  public:
+    explicit AtomTable(ScriptAllocator *allocator) : _mAllocator(allocator) {}
+    AtomTable(const AtomTable &other) = delete;
+    AtomTable &operator=(const AtomTable &other) = delete;
+
+    const char *intern(const char *str, size_t len);
+    const char *intern(const char *str) { return intern(str, strlen(str)); }
+    /// Get the atom for `str` without interning it, nullptr if it was never interned.
+    const char *find(const char *str) const;
+    /// Forget all atoms, their storage belongs to the allocator.
+    void reset();
+    size_t size() const { return _mNumAtoms; }
+
+    static uint32_t hashString(const char *str, size_t len);
+    static uint32_t getHash(const char *atom) { return getHeader(atom).hash; }
+    static uint32_t getLength(const char *atom) { return getHeader(atom).length; }
+
+  private:
+    // stored right before the string, which may not be aligned for it.
+    struct AtomHeader {
+      uint32_t hash;
+      uint32_t length;
+    };
+    static AtomHeader getHeader(const char *atom) {
+      AtomHeader header;
+      memcpy(&header, atom - sizeof(AtomHeader), sizeof(AtomHeader));
+      return header;
+    }
+
+    size_t findSlot(const char *str, size_t len, uint32_t hash) const;
+    void grow();
+
+    // open addressing with linear probing, size is always a power of 2.
+    std::vector<const char *> _mSlots {};
+    size_t _mNumAtoms = 0;
+    ScriptAllocator *_mAllocator;
+};
+
+}
+
+#endif
@@ -34,6 +34,7 @@ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <algorithm>
 #include <type_traits>
 #include <cstdint>
 #include <cstring>
@@ -136,6 +137,16 @@ class BitStream {
       memset(_mData + old_size, 0, size - old_size);
     }
 
+    /// Make sure at least `size` bytes are allocated without changing the stream's size,
+    /// for when roughly how much will be written is known up front.
+    void reserve(uint32_t size) {
+      if (_mReadOnly) {
+        throw std::runtime_error("Cannot reserve: is read-only!");
+      }
+      if (size > _mAllocSize)
+        preAlloc(size);
+    }
+
     /**
      * Create an identical copy of this BitStream
      *
@@ -208,8 +219,9 @@ class BitStream {
         return;
       }
 
-      uint32_t step = std::max(MIN_REALLOC, new_size - _mSize);
-      preAlloc(_mAllocSize + step);
+      // grow geometrically so a stream built up a few bytes at a time
+      // only reallocs O(log n) times.
+      preAlloc(std::max({new_size, _mAllocSize * 2, MIN_REALLOC}));
 
       _mSize = new_size;
       _mPos = std::min(new_size, _mPos);
@@ -280,6 +292,27 @@ class BitStream {
      */
     template<typename T>
     BitStream &operator<<(const T &data) {
+      if (_mEndianness == ENDIAN_BIG)
+        return writeValue<ENDIAN_BIG>(data);
+      return writeValue<ENDIAN_LITTLE>(data);
+    }
+
+    /**
+     * Read virtually any kind of data from the stream
+     *
+     * @note data is expected not to be a pointer. you might have to dereference it
+     */
+    template<typename T>
+    BitStream &operator>>(T &data) {
+      if (_mEndianness == ENDIAN_BIG)
+        return readValue<ENDIAN_BIG>(data);
+      return readValue<ENDIAN_LITTLE>(data);
+    }
+
+    /// Like `operator<<`, but with the byte order fixed at compile time
+    /// rather than checked on every write.
+    template<Endianness E, typename T>
+    BitStream &writeValue(const T &data) {
       static_assert(std::is_trivially_copyable<T>(), "Need a specialized serialized function for non-POD types");
 
       if (_mPos + sizeof(T) > size()) {
@@ -292,7 +325,7 @@ class BitStream {
         // Store data reinterpreted as an integral type of the appropriate size and byte-swap,
         // should optimize to a bswap instruction for the given integer width.
         SameSizedUInt<T> val = reinterpret_cast<const SameSizedUInt<T> &>(data);
-        if (_mEndianness == ENDIAN_BIG)
+        if constexpr (E == ENDIAN_BIG)
           val = tail_htobe(val);
         else
           val = tail_htole(val);
@@ -305,13 +338,9 @@ class BitStream {
       return *this;
     }
 
-    /**
-     * Read virtually any kind of data from the stream
-     *
-     * @note data is expected not to be a pointer. you might have to dereference it
-     */
-    template<typename T>
-    BitStream &operator>>(T &data) {
+    /// Like `operator>>`, but with the byte order fixed at compile time
+    template<Endianness E, typename T>
+    BitStream &readValue(T &data) {
       if (_mPos + sizeof(T) > size()) {
         throw std::runtime_error("Cannot read from BitStream: Already at the end.");
       }
@@ -322,7 +351,7 @@ class BitStream {
         // should optimize to a bswap instruction for the given integer width
         auto *val = reinterpret_cast<SameSizedUInt<T> *>(&_mData[_mPos]);
         auto &sized_data = reinterpret_cast<SameSizedUInt<T> &>(data);
-        if (_mEndianness == ENDIAN_BIG)
+        if constexpr (E == ENDIAN_BIG)
           sized_data = tail_betoh(*val);
         else
           sized_data = tail_letoh(*val);
@@ -1,14 +1,15 @@
 #include <cstdio>
 #include <cstring>
+#include <mutex>
+#include <vector>
 
+#include "builtins_table.hh"
 #include "lslmini.hh"
 #include "logger.hh"
 #include "strings.hh"
 
 namespace Tailslide {
 
-extern const char *BUILTINS_TXT[];
-
 // Keep builtins alive as long as the library is loaded
 static ScriptAllocator gStaticAllocator {};
 
@@ -95,8 +96,94 @@ static void init_default_values() {
   TYPE(LST_FLOATINGPOINT)->setOneValue(float_one);
 }
 
-// called once at startup, not thread-safe.
-void tailslide_init_builtins(const char *builtins_file) {
+// indexed the same way as the generated builtins table
+static std::vector<LSLSymbol *> gBuiltinSymbols;
+
+// changes whenever the set of builtins does, see `tailslide_get_builtins_fingerprint()`
+static uint64_t gBuiltinsFingerprint = 14695981039346656037ULL;
+
+// FNV-1a
+static void add_to_fingerprint(const void *data, size_t len) {
+  auto *bytes = (const uint8_t *)data;
+  for (size_t i = 0; i < len; ++i) {
+    gBuiltinsFingerprint ^= bytes[i];
+    gBuiltinsFingerprint *= 1099511628211ULL;
+  }
+}
+
+static void add_to_fingerprint(const char *str) {
+  // include the terminator so "ab" + "c" and "a" + "bc" differ.
+  if (str)
+    add_to_fingerprint(str, strlen(str) + 1);
+}
+
+static LSLConstant *make_builtin_constant(const BuiltinEntry &entry) {
+  LSLConstant *const_built;
+  switch (entry.type) {
+    case LST_INTEGER:
+      const_built = gStaticAllocator.newTracked<LSLIntegerConstant>(entry.int_value);
+      break;
+    case LST_FLOATINGPOINT:
+      const_built = gStaticAllocator.newTracked<LSLFloatConstant>(entry.float_values[0]);
+      break;
+    case LST_VECTOR: {
+      auto &v = entry.float_values;
+      const_built = gStaticAllocator.newTracked<LSLVectorConstant>(v[0], v[1], v[2]);
+      break;
+    }
+    case LST_QUATERNION: {
+      auto &v = entry.float_values;
+      const_built = gStaticAllocator.newTracked<LSLQuaternionConstant>(v[0], v[1], v[2], v[3]);
+      break;
+    }
+    case LST_STRING:
+      const_built = gStaticAllocator.newTracked<LSLStringConstant>(entry.str_value);
+      break;
+    default:
+      return nullptr;
+  }
+  const_built->markStatic();
+  return const_built;
+}
+
+// Build the builtins from the table generate_builtins_c.py made from builtins.txt.
+// Everything is already parsed and hashed, we only need to make the symbols.
+static void init_builtins_from_table() {
+  size_t num_entries;
+  const BuiltinEntry *entries = get_builtin_entries(&num_entries);
+  gBuiltinSymbols.resize(num_entries);
+
+  for (size_t i = 0; i < num_entries; ++i) {
+    const auto &entry = entries[i];
+    add_to_fingerprint(entry.name);
+    add_to_fingerprint(&entry.symbol_type, sizeof(entry.symbol_type));
+    add_to_fingerprint(&entry.type, sizeof(entry.type));
+    add_to_fingerprint(&entry.int_value, sizeof(entry.int_value));
+    add_to_fingerprint(entry.float_values, sizeof(entry.float_values));
+    add_to_fingerprint(entry.str_value);
+    LSLSymbol *sym;
+    if (entry.symbol_type == SYM_VARIABLE) {
+      sym = gStaticAllocator.newTracked<LSLSymbol>(entry.name, TYPE(entry.type), SYM_VARIABLE, SYM_BUILTIN);
+      sym->setConstantValue(make_builtin_constant(entry));
+    } else {
+      auto *dec = gStaticAllocator.newTracked<LSLFunctionDec>();
+      const BuiltinParam *params = get_builtin_params(&entry);
+      for (int j = 0; j < entry.num_params; ++j) {
+        add_to_fingerprint(params[j].name);
+        add_to_fingerprint(&params[j].type, sizeof(params[j].type));
+        dec->pushChild(gStaticAllocator.newTracked<LSLIdentifier>(TYPE(params[j].type), params[j].name));
+      }
+      sym = gStaticAllocator.newTracked<LSLSymbol>(
+          entry.name, TYPE(entry.type), entry.symbol_type, SYM_BUILTIN, dec
+      );
+    }
+    gBuiltinSymbols[i] = sym;
+    gBuiltinsSymbolTable.define(sym);
+  }
+  gBuiltinsSymbolTable.setPerfectHash(find_builtin_entry, gBuiltinSymbols.data());
+}
+
+void tailslide_load_builtins_file(const char *builtins_file, LSLSymbolTable *table, ScriptAllocator *allocator) {
   LSLFunctionDec *dec = nullptr;
   FILE *fp = nullptr;
   char buf[1025];
@@ -104,36 +191,28 @@ void tailslide_init_builtins(const char *builtins_file) {
   char *ret_type = nullptr;
   char *name = nullptr;
   char *ptype = nullptr, *pname = nullptr, *tokptr = nullptr, *value = nullptr;
-  int line = 0;
 
-  if (builtins_file) {
-    fp = fopen(builtins_file, "r");
-
-    if (fp == nullptr) {
-      snprintf(buf, 1024, "couldn't open %s", builtins_file);
-      perror(buf);
-      exit(EXIT_FAILURE);
-    }
+  fp = fopen(builtins_file, "r");
+  if (fp == nullptr) {
+    snprintf(buf, 1024, "couldn't open %s", builtins_file);
+    perror(buf);
+    exit(EXIT_FAILURE);
   }
-
-  init_default_values();
+  // no perfect hash for these, look them up by atom like any other symbol table.
+  table->setAtoms(&allocator->getAtoms());
 
   while (true) {
-    if (fp) {
-      if (fgets(buf, 1024, fp) == nullptr)
-        break;
-    } else {
-      if (BUILTINS_TXT[line] == nullptr)
-        break;
-      strncpy(buf, BUILTINS_TXT[line], 1024);
-      ++line;
-    }
+    if (fgets(buf, 1024, fp) == nullptr)
+      break;
 
     // skip blank lines and comment lines
     if (strncmp("//", buf, 2) == 0 || strncmp("\n", buf, 1) == 0)
       continue;
 
     strcpy(original, buf);
+    // only the global builtins are part of the fingerprint
+    if (table == &gBuiltinsSymbolTable)
+      add_to_fingerprint(original);
 
     ret_type = tailslide_strtok_r(buf, " (),", &tokptr);
 
@@ -162,8 +241,8 @@ void tailslide_init_builtins(const char *builtins_file) {
       } else {
         const_type = str_to_type(ret_type);
       }
-      auto *sym = gStaticAllocator.newTracked<LSLSymbol>(
-          gStaticAllocator.copyStr(name), const_type, SYM_VARIABLE, SYM_BUILTIN
+      auto *sym = allocator->newTracked<LSLSymbol>(
+          allocator->intern(name), const_type, SYM_VARIABLE, SYM_BUILTIN
       );
 
       while (*value == ' ') {
@@ -190,7 +269,7 @@ if(sscanf(value, (fmt), __VA_ARGS__) != num) { \
               const_val = const_val_hex;
             }
           }
-          auto const_built = gStaticAllocator.newTracked<LSLIntegerConstant>(const_val);
+          auto const_built = allocator->newTracked<LSLIntegerConstant>(const_val);
           const_built->markStatic();
           sym->setConstantValue(const_built);
           break;
@@ -198,7 +277,7 @@ if(sscanf(value, (fmt), __VA_ARGS__) != num) { \
         case LST_FLOATINGPOINT: {
           float const_val;
           CONST_SSCANF(1, "%f", &const_val);
-          auto const_built = gStaticAllocator.newTracked<LSLFloatConstant>(const_val);
+          auto const_built = allocator->newTracked<LSLFloatConstant>(const_val);
           const_built->markStatic();
           sym->setConstantValue(const_built);
           break;
@@ -206,7 +285,7 @@ if(sscanf(value, (fmt), __VA_ARGS__) != num) { \
         case LST_VECTOR: {
           float x, y, z;
           CONST_SSCANF(3, "<%f, %f, %f>", &x, &y, &z);
-          auto const_built = gStaticAllocator.newTracked<LSLVectorConstant>(x, y, z);
+          auto const_built = allocator->newTracked<LSLVectorConstant>(x, y, z);
           const_built->markStatic();
           sym->setConstantValue(const_built);
           break;
@@ -214,7 +293,7 @@ if(sscanf(value, (fmt), __VA_ARGS__) != num) { \
         case LST_QUATERNION: {
           float x, y, z, s;
           CONST_SSCANF(4, "<%f, %f, %f, %f>", &x, &y, &z, &s);
-          auto const_built = gStaticAllocator.newTracked<LSLQuaternionConstant>(x, y, z, s);
+          auto const_built = allocator->newTracked<LSLQuaternionConstant>(x, y, z, s);
           const_built->markStatic();
           sym->setConstantValue(const_built);
           break;
@@ -224,8 +303,8 @@ if(sscanf(value, (fmt), __VA_ARGS__) != num) { \
           if (value[0] != '"') {
             CONST_PARSE_FAIL();
           }
-          auto const_built = gStaticAllocator.newTracked<LSLStringConstant>(
-              parse_string(&gStaticAllocator, value)
+          auto const_built = allocator->newTracked<LSLStringConstant>(
+              parse_string(allocator, value)
           );
           const_built->markStatic();
           sym->setConstantValue(const_built);
@@ -238,7 +317,7 @@ if(sscanf(value, (fmt), __VA_ARGS__) != num) { \
 #undef CONST_PARSE_FAIL
 #undef CONST_SSCANF
 
-      gBuiltinsSymbolTable.define(sym);
+      table->define(sym);
 
     } else if (!strcmp(ret_type, "event")) {
       name = tailslide_strtok_r(nullptr, " (),", &tokptr);
@@ -249,17 +328,17 @@ if(sscanf(value, (fmt), __VA_ARGS__) != num) { \
         return;
       }
 
-      dec = gStaticAllocator.newTracked<LSLFunctionDec>();
+      dec = allocator->newTracked<LSLFunctionDec>();
       while ((ptype = tailslide_strtok_r(nullptr, " (),", &tokptr)) != nullptr) {
         if ((pname = tailslide_strtok_r(nullptr, " (),", &tokptr)) != nullptr) {
-          dec->pushChild(gStaticAllocator.newTracked<LSLIdentifier>(
-              str_to_type(ptype), gStaticAllocator.copyStr(pname))
+          dec->pushChild(allocator->newTracked<LSLIdentifier>(
+              str_to_type(ptype), allocator->copyStr(pname))
           );
         }
       }
 
-      gBuiltinsSymbolTable.define(gStaticAllocator.newTracked<LSLSymbol>(
-          gStaticAllocator.copyStr(name), str_to_type("void"), SYM_EVENT, SYM_BUILTIN, dec
+      table->define(allocator->newTracked<LSLSymbol>(
+          allocator->intern(name), str_to_type("void"), SYM_EVENT, SYM_BUILTIN, dec
       ));
     } else {
       name = tailslide_strtok_r(nullptr, " (),", &tokptr);
@@ -270,20 +349,44 @@ if(sscanf(value, (fmt), __VA_ARGS__) != num) { \
         return;
       }
 
-      dec = gStaticAllocator.newTracked<LSLFunctionDec>();
+      dec = allocator->newTracked<LSLFunctionDec>();
       while ((ptype = tailslide_strtok_r(nullptr, " (),", &tokptr)) != nullptr) {
         if ((pname = tailslide_strtok_r(nullptr, " (),", &tokptr)) != nullptr) {
-          dec->pushChild(gStaticAllocator.newTracked<LSLIdentifier>(
-              str_to_type(ptype), gStaticAllocator.copyStr(pname)
+          dec->pushChild(allocator->newTracked<LSLIdentifier>(
+              str_to_type(ptype), allocator->copyStr(pname)
           ));
         }
       }
 
-      gBuiltinsSymbolTable.define(gStaticAllocator.newTracked<LSLSymbol>(
-          gStaticAllocator.copyStr(name), str_to_type(ret_type), SYM_FUNCTION, SYM_BUILTIN, dec
+      table->define(allocator->newTracked<LSLSymbol>(
+          allocator->intern(name), str_to_type(ret_type), SYM_FUNCTION, SYM_BUILTIN, dec
       ));
     }
   }
+  fclose(fp);
+}
+
+static void init_builtins(const char *builtins_file) {
+  init_default_values();
+  if (builtins_file)
+    tailslide_load_builtins_file(builtins_file, &gBuiltinsSymbolTable, &gStaticAllocator);
+  else
+    init_builtins_from_table();
+
+  // Scripts only ever read from the builtins from here on out, possibly
+  // from many threads at once.
+  gBuiltinsSymbolTable.freeze();
+  freeze_builtin_symbol_ids();
+}
+
+uint64_t tailslide_get_builtins_fingerprint() {
+  return gBuiltinsFingerprint;
+}
+
+// Safe to call from multiple threads, only the first call does anything.
+void tailslide_init_builtins(const char *builtins_file) {
+  static std::once_flag init_flag;
+  std::call_once(init_flag, init_builtins, builtins_file);
 }
 
 }
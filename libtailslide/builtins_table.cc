@@ -0,0 +1,2174 @@
+// Generated by generate_builtins_c.py from builtins.txt, don't edit by hand!
+#ifdef _WIN32
+#pragma execution_character_set("utf-8")
+#endif
+#include "builtins_table.hh"
+
+namespace Tailslide {
+
+static constexpr BuiltinParam BUILTIN_PARAMS[] = {
+    {"src", LST_LIST},
+    {"index", LST_INTEGER},
+    {"id", LST_KEY},
+    {"id", LST_KEY},
+    {"pos", LST_VECTOR},
+    {"sim_wide", LST_INTEGER},
+    {"face", LST_INTEGER},
+    {"position", LST_VECTOR},
+    {"environment", LST_STRING},
+    {"track_no", LST_INTEGER},
+    {"day_length", LST_INTEGER},
+    {"day_offset", LST_INTEGER},
+    {"id", LST_KEY},
+    {"method", LST_STRING},
+    {"body", LST_STRING},
+    {"avatar", LST_KEY},
+    {"hours", LST_FLOATINGPOINT},
+    {"id", LST_KEY},
+    {"anim", LST_STRING},
+    {"name", LST_STRING},
+    {"id", LST_KEY},
+    {"accept", LST_INTEGER},
+    {"attach_point", LST_INTEGER},
+    {"target", LST_KEY},
+    {"folder", LST_STRING},
+    {"inventory", LST_LIST},
+    {"a", LST_INTEGER},
+    {"b", LST_INTEGER},
+    {"c", LST_INTEGER},
+    {"avatar", LST_KEY},
+    {"message", LST_STRING},
+    {"chat_channel", LST_INTEGER},
+    {"src", LST_STRING},
+    {"keyframes", LST_LIST},
+    {"options", LST_LIST},
+    {"channel", LST_INTEGER},
+    {"msg", LST_STRING},
+    {"number", LST_INTEGER},
+    {"number", LST_INTEGER},
+    {"dest", LST_LIST},
+    {"src", LST_LIST},
+    {"start", LST_INTEGER},
+    {"pos", LST_VECTOR},
+    {"mag", LST_FLOATINGPOINT},
+    {"type", LST_STRING},
+    {"values", LST_LIST},
+    {"json", LST_STRING},
+    {"specifiers", LST_LIST},
+    {"query", LST_LIST},
+    {"add", LST_INTEGER},
+    {"rot", LST_QUATERNION},
+    {"link", LST_INTEGER},
+    {"offset", LST_VECTOR},
+    {"rot", LST_QUATERNION},
+    {"param", LST_INTEGER},
+    {"vec", LST_VECTOR},
+    {"offset", LST_VECTOR},
+    {"rot", LST_QUATERNION},
+    {"torque", LST_VECTOR},
+    {"local", LST_INTEGER},
+    {"pin", LST_INTEGER},
+    {"avatar", LST_KEY},
+    {"channel", LST_INTEGER},
+    {"msg", LST_STRING},
+    {"pos", LST_VECTOR},
+    {"params", LST_LIST},
+    {"name", LST_STRING},
+    {"run", LST_INTEGER},
+    {"point", LST_VECTOR},
+    {"options", LST_LIST},
+    {"target", LST_VECTOR},
+    {"tau", LST_FLOATINGPOINT},
+    {"target", LST_KEY},
+    {"channel", LST_INTEGER},
+    {"msg", LST_STRING},
+    {"agent", LST_KEY},
+    {"reason", LST_INTEGER},
+    {"offset", LST_VECTOR},
+    {"event_type", LST_INTEGER},
+    {"channel", LST_KEY},
+    {"message_id", LST_KEY},
+    {"sender", LST_STRING},
+    {"idata", LST_INTEGER},
+    {"sdata", LST_STRING},
+    {"id", LST_KEY},
+    {"target", LST_KEY},
+    {"name", LST_STRING},
+    {"running", LST_INTEGER},
+    {"start_param", LST_INTEGER},
+    {"pos", LST_VECTOR},
+    {"val", LST_FLOATINGPOINT},
+    {"item", LST_STRING},
+    {"mask", LST_INTEGER},
+    {"number", LST_INTEGER},
+    {"limit", LST_INTEGER},
+    {"angular_velocity", LST_VECTOR},
+    {"local", LST_INTEGER},
+    {"url", LST_STRING},
+    {"parameters", LST_LIST},
+    {"body", LST_STRING},
+    {"id", LST_KEY},
+    {"id", LST_KEY},
+    {"amount", LST_INTEGER},
+    {"target", LST_QUATERNION},
+    {"strength", LST_FLOATINGPOINT},
+    {"damping", LST_FLOATINGPOINT},
+    {"type", LST_INTEGER},
+    {"reserved", LST_LIST},
+    {"u", LST_FLOATINGPOINT},
+    {"v", LST_FLOATINGPOINT},
+    {"face", LST_INTEGER},
+    {"val", LST_FLOATINGPOINT},
+    {"param", LST_INTEGER},
+    {"value", LST_FLOATINGPOINT},
+    {"force", LST_VECTOR},
+    {"local", LST_INTEGER},
+    {"number", LST_INTEGER},
+    {"buoyancy", LST_FLOATINGPOINT},
+    {"src", LST_LIST},
+    {"address", LST_STRING},
+    {"subject", LST_STRING},
+    {"channel", LST_KEY},
+    {"number", LST_INTEGER},
+    {"active", LST_INTEGER},
+    {"anim_state", LST_STRING},
+    {"anim", LST_STRING},
+    {"str1", LST_STRING},
+    {"str2", LST_STRING},
+    {"k", LST_STRING},
+    {"impact_sprite", LST_STRING},
+    {"rules", LST_LIST},
+    {"mouselook", LST_INTEGER},
+    {"num_detected", LST_INTEGER},
+    {"linknumber", LST_INTEGER},
+    {"color", LST_VECTOR},
+    {"face", LST_INTEGER},
+    {"src", LST_LIST},
+    {"index", LST_INTEGER},
+    {"src", LST_LIST},
+    {"index", LST_INTEGER},
+    {"pos", LST_VECTOR},
+    {"id", LST_KEY},
+    {"cmd", LST_INTEGER},
+    {"options", LST_LIST},
+    {"name", LST_STRING},
+    {"rot", LST_QUATERNION},
+    {"radius", LST_FLOATINGPOINT},
+    {"number", LST_INTEGER},
+    {"name", LST_STRING},
+    {"name", LST_STRING},
+    {"name", LST_STRING},
+    {"id", LST_KEY},
+    {"type", LST_INTEGER},
+    {"range", LST_FLOATINGPOINT},
+    {"arc", LST_FLOATINGPOINT},
+    {"src", LST_LIST},
+    {"item", LST_STRING},
+    {"pos", LST_VECTOR},
+    {"simulator", LST_STRING},
+    {"data", LST_INTEGER},
+    {"url", LST_STRING},
+    {"face", LST_INTEGER},
+    {"pos", LST_VECTOR},
+    {"dir", LST_VECTOR},
+    {"theta", LST_FLOATINGPOINT},
+    {"status", LST_INTEGER},
+    {"link", LST_INTEGER},
+    {"linknumber", LST_INTEGER},
+    {"v", LST_VECTOR},
+    {"num_detected", LST_INTEGER},
+    {"k", LST_STRING},
+    {"v", LST_STRING},
+    {"checked", LST_INTEGER},
+    {"original_value", LST_STRING},
+    {"num_detected", LST_INTEGER},
+    {"name", LST_STRING},
+    {"line", LST_INTEGER},
+    {"number", LST_INTEGER},
+    {"avatar", LST_KEY},
+    {"pos", LST_VECTOR},
+    {"params", LST_LIST},
+    {"str", LST_STRING},
+    {"key", LST_STRING},
+    {"password", LST_STRING},
+    {"json", LST_STRING},
+    {"specifiers", LST_LIST},
+    {"value", LST_STRING},
+    {"str", LST_STRING},
+    {"key", LST_STRING},
+    {"value", LST_STRING},
+    {"password", LST_STRING},
+    {"number", LST_INTEGER},
+    {"start", LST_VECTOR},
+    {"end", LST_VECTOR},
+    {"params", LST_LIST},
+    {"flags", LST_INTEGER},
+    {"gravity_multiplier", LST_FLOATINGPOINT},
+    {"restitution", LST_FLOATINGPOINT},
+    {"friction", LST_FLOATINGPOINT},
+    {"density", LST_FLOATINGPOINT},
+    {"sound", LST_STRING},
+    {"volume", LST_FLOATINGPOINT},
+    {"id", LST_KEY},
+    {"impulse", LST_VECTOR},
+    {"ang_impulse", LST_VECTOR},
+    {"local", LST_INTEGER},
+    {"start", LST_VECTOR},
+    {"end", LST_VECTOR},
+    {"radius", LST_FLOATINGPOINT},
+    {"params", LST_LIST},
+    {"src", LST_LIST},
+    {"start", LST_INTEGER},
+    {"end", LST_INTEGER},
+    {"inventory", LST_STRING},
+    {"pos", LST_VECTOR},
+    {"vel", LST_VECTOR},
+    {"rot", LST_QUATERNION},
+    {"param", LST_INTEGER},
+    {"src", LST_LIST},
+    {"stride", LST_INTEGER},
+    {"ascending", LST_INTEGER},
+    {"offset", LST_VECTOR},
+    {"linknumber", LST_INTEGER},
+    {"rules", LST_LIST},
+    {"sound", LST_STRING},
+    {"volume", LST_FLOATINGPOINT},
+    {"agent", LST_KEY},
+    {"global_coordinates", LST_VECTOR},
+    {"region_coordinates", LST_VECTOR},
+    {"look_at", LST_VECTOR},
+    {"str", LST_STRING},
+    {"simname", LST_STRING},
+    {"pos", LST_VECTOR},
+    {"look_at", LST_VECTOR},
+    {"src", LST_STRING},
+    {"sound", LST_STRING},
+    {"price", LST_INTEGER},
+    {"quick_pay_buttons", LST_LIST},
+    {"rules", LST_LIST},
+    {"link", LST_INTEGER},
+    {"face", LST_INTEGER},
+    {"params", LST_LIST},
+    {"id", LST_KEY},
+    {"command", LST_LIST},
+    {"sound", LST_STRING},
+    {"volume", LST_FLOATINGPOINT},
+    {"val", LST_FLOATINGPOINT},
+    {"volume", LST_FLOATINGPOINT},
+    {"val", LST_FLOATINGPOINT},
+    {"desc", LST_STRING},
+    {"offset", LST_VECTOR},
+    {"pos", LST_VECTOR},
+    {"points", LST_LIST},
+    {"options", LST_LIST},
+    {"position", LST_VECTOR},
+    {"params", LST_LIST},
+    {"src", LST_STRING},
+    {"nonce", LST_INTEGER},
+    {"id", LST_KEY},
+    {"object", LST_KEY},
+    {"agent", LST_KEY},
+    {"text", LST_STRING},
+    {"color", LST_VECTOR},
+    {"alpha", LST_FLOATINGPOINT},
+    {"action", LST_INTEGER},
+    {"name", LST_STRING},
+    {"center", LST_VECTOR},
+    {"radius", LST_VECTOR},
+    {"options", LST_LIST},
+    {"face", LST_INTEGER},
+    {"params", LST_LIST},
+    {"sound", LST_STRING},
+    {"volume", LST_FLOATINGPOINT},
+    {"linknumber", LST_INTEGER},
+    {"alpha", LST_FLOATINGPOINT},
+    {"face", LST_INTEGER},
+    {"number", LST_INTEGER},
+    {"number", LST_INTEGER},
+    {"sender_num", LST_INTEGER},
+    {"num", LST_INTEGER},
+    {"str", LST_STRING},
+    {"id", LST_KEY},
+    {"face", LST_INTEGER},
+    {"id", LST_KEY},
+    {"url", LST_STRING},
+    {"src", LST_STRING},
+    {"start", LST_INTEGER},
+    {"end", LST_INTEGER},
+    {"item", LST_STRING},
+    {"mask", LST_INTEGER},
+    {"value", LST_INTEGER},
+    {"fwd", LST_VECTOR},
+    {"left", LST_VECTOR},
+    {"up", LST_VECTOR},
+    {"src", LST_LIST},
+    {"start", LST_INTEGER},
+    {"end", LST_INTEGER},
+    {"id", LST_KEY},
+    {"source", LST_STRING},
+    {"pattern", LST_STRING},
+    {"inventory", LST_KEY},
+    {"pos", LST_VECTOR},
+    {"request_id", LST_KEY},
+    {"header", LST_STRING},
+    {"src", LST_STRING},
+    {"trim_type", LST_INTEGER},
+    {"particles", LST_INTEGER},
+    {"scale", LST_FLOATINGPOINT},
+    {"vel", LST_FLOATINGPOINT},
+    {"lifetime", LST_FLOATINGPOINT},
+    {"arc", LST_FLOATINGPOINT},
+    {"texture", LST_STRING},
+    {"offset", LST_VECTOR},
+    {"q", LST_QUATERNION},
+    {"destination", LST_KEY},
+    {"amount", LST_INTEGER},
+    {"src", LST_LIST},
+    {"separator", LST_STRING},
+    {"queue", LST_INTEGER},
+    {"address", LST_STRING},
+    {"subject", LST_STRING},
+    {"message", LST_STRING},
+    {"number", LST_INTEGER},
+    {"id", LST_KEY},
+    {"number", LST_INTEGER},
+    {"pos", LST_VECTOR},
+    {"src", LST_LIST},
+    {"index", LST_INTEGER},
+    {"number", LST_INTEGER},
+    {"start_param", LST_INTEGER},
+    {"link", LST_INTEGER},
+    {"eye", LST_VECTOR},
+    {"at", LST_VECTOR},
+    {"pos", LST_VECTOR},
+    {"number", LST_INTEGER},
+    {"pos", LST_VECTOR},
+    {"agent_id", LST_KEY},
+    {"link", LST_INTEGER},
+    {"json", LST_STRING},
+    {"id", LST_KEY},
+    {"status", LST_INTEGER},
+    {"value", LST_INTEGER},
+    {"agent", LST_KEY},
+    {"scaling_factor", LST_FLOATINGPOINT},
+    {"num_detected", LST_INTEGER},
+    {"link", LST_INTEGER},
+    {"request_id", LST_KEY},
+    {"status", LST_INTEGER},
+    {"metadata", LST_LIST},
+    {"body", LST_STRING},
+    {"link", LST_INTEGER},
+    {"face", LST_INTEGER},
+    {"params", LST_LIST},
+    {"type", LST_INTEGER},
+    {"number", LST_INTEGER},
+    {"agent", LST_KEY},
+    {"src", LST_STRING},
+    {"start", LST_INTEGER},
+    {"end", LST_INTEGER},
+    {"param", LST_INTEGER},
+    {"rot", LST_QUATERNION},
+    {"agent_id", LST_KEY},
+    {"transition", LST_FLOATINGPOINT},
+    {"params", LST_LIST},
+    {"queryid", LST_KEY},
+    {"data", LST_STRING},
+    {"avatar", LST_KEY},
+    {"message", LST_STRING},
+    {"buttons", LST_LIST},
+    {"chat_channel", LST_INTEGER},
+    {"num_detected", LST_INTEGER},
+    {"destination", LST_KEY},
+    {"inventory", LST_STRING},
+    {"time", LST_STRING},
+    {"address", LST_STRING},
+    {"subj", LST_STRING},
+    {"message", LST_STRING},
+    {"num_left", LST_INTEGER},
+    {"avatar", LST_KEY},
+    {"channel", LST_KEY},
+    {"message_id", LST_KEY},
+    {"sdata", LST_STRING},
+    {"idata", LST_INTEGER},
+    {"user", LST_KEY},
+    {"message", LST_STRING},
+    {"rot", LST_QUATERNION},
+    {"error", LST_FLOATINGPOINT},
+    {"point", LST_VECTOR},
+    {"options", LST_LIST},
+    {"particles", LST_INTEGER},
+    {"scale", LST_FLOATINGPOINT},
+    {"vel", LST_FLOATINGPOINT},
+    {"lifetime", LST_FLOATINGPOINT},
+    {"arc", LST_FLOATINGPOINT},
+    {"texture", LST_STRING},
+    {"offset", LST_VECTOR},
+    {"link", LST_INTEGER},
+    {"face", LST_INTEGER},
+    {"v", LST_VECTOR},
+    {"pos", LST_VECTOR},
+    {"category", LST_INTEGER},
+    {"sim_wide", LST_INTEGER},
+    {"pattern", LST_STRING},
+    {"start", LST_INTEGER},
+    {"count", LST_INTEGER},
+    {"val", LST_FLOATINGPOINT},
+    {"number", LST_INTEGER},
+    {"channel", LST_KEY},
+    {"dest", LST_STRING},
+    {"idata", LST_INTEGER},
+    {"sdata", LST_STRING},
+    {"anim_state", LST_STRING},
+    {"id", LST_KEY},
+    {"val", LST_FLOATINGPOINT},
+    {"number", LST_INTEGER},
+    {"operation", LST_INTEGER},
+    {"src", LST_LIST},
+    {"side", LST_INTEGER},
+    {"texture", LST_STRING},
+    {"face", LST_INTEGER},
+    {"val", LST_FLOATINGPOINT},
+    {"q", LST_QUATERNION},
+    {"params", LST_LIST},
+    {"key", LST_STRING},
+    {"password", LST_STRING},
+    {"id", LST_KEY},
+    {"action", LST_INTEGER},
+    {"brush", LST_INTEGER},
+    {"rot", LST_QUATERNION},
+    {"id", LST_KEY},
+    {"link", LST_INTEGER},
+    {"code", LST_INTEGER},
+    {"src", LST_LIST},
+    {"index", LST_INTEGER},
+    {"face", LST_INTEGER},
+    {"axis", LST_VECTOR},
+    {"spinrate", LST_FLOATINGPOINT},
+    {"gain", LST_FLOATINGPOINT},
+    {"src", LST_LIST},
+    {"start", LST_INTEGER},
+    {"end", LST_INTEGER},
+    {"stride", LST_INTEGER},
+    {"sound", LST_STRING},
+    {"volume", LST_FLOATINGPOINT},
+    {"queue", LST_INTEGER},
+    {"loop", LST_INTEGER},
+    {"tnum", LST_INTEGER},
+    {"targetrot", LST_QUATERNION},
+    {"ourrot", LST_QUATERNION},
+    {"detect", LST_INTEGER},
+    {"v1", LST_VECTOR},
+    {"v2", LST_VECTOR},
+    {"key", LST_STRING},
+    {"value", LST_STRING},
+    {"type", LST_INTEGER},
+    {"pass", LST_INTEGER},
+    {"q", LST_QUATERNION},
+    {"id", LST_KEY},
+    {"data", LST_INTEGER},
+    {"target", LST_VECTOR},
+    {"strength", LST_FLOATINGPOINT},
+    {"damping", LST_FLOATINGPOINT},
+    {"url", LST_STRING},
+    {"particles", LST_INTEGER},
+    {"scale", LST_FLOATINGPOINT},
+    {"vel", LST_FLOATINGPOINT},
+    {"lifetime", LST_FLOATINGPOINT},
+    {"arc", LST_FLOATINGPOINT},
+    {"bounce", LST_INTEGER},
+    {"texture", LST_STRING},
+    {"offset", LST_VECTOR},
+    {"bounce_offset", LST_FLOATINGPOINT},
+    {"num_detected", LST_INTEGER},
+    {"scale", LST_VECTOR},
+    {"v", LST_VECTOR},
+    {"val", LST_STRING},
+    {"index", LST_INTEGER},
+    {"controls", LST_INTEGER},
+    {"accept", LST_INTEGER},
+    {"pass_on", LST_INTEGER},
+    {"linknum", LST_INTEGER},
+    {"tnum", LST_INTEGER},
+    {"targetpos", LST_VECTOR},
+    {"ourpos", LST_VECTOR},
+    {"number", LST_INTEGER},
+    {"src", LST_LIST},
+    {"test", LST_LIST},
+    {"number", LST_INTEGER},
+    {"avatar", LST_KEY},
+    {"srgb", LST_VECTOR},
+    {"src", LST_STRING},
+    {"sound", LST_STRING},
+    {"perm", LST_INTEGER},
+    {"color", LST_VECTOR},
+    {"face", LST_INTEGER},
+    {"y", LST_FLOATINGPOINT},
+    {"x", LST_FLOATINGPOINT},
+    {"sound", LST_STRING},
+    {"volume", LST_FLOATINGPOINT},
+    {"experience_id", LST_KEY},
+    {"offset", LST_VECTOR},
+    {"item", LST_STRING},
+    {"u", LST_FLOATINGPOINT},
+    {"v", LST_FLOATINGPOINT},
+    {"face", LST_INTEGER},
+    {"v1", LST_VECTOR},
+    {"v2", LST_VECTOR},
+    {"sec", LST_FLOATINGPOINT},
+    {"avatar", LST_KEY},
+    {"message", LST_STRING},
+    {"url", LST_STRING},
+    {"action", LST_INTEGER},
+    {"key", LST_STRING},
+    {"value", LST_STRING},
+    {"k", LST_STRING},
+    {"v", LST_STRING},
+    {"offset", LST_VECTOR},
+    {"id", LST_KEY},
+    {"params", LST_LIST},
+    {"mode", LST_INTEGER},
+    {"face", LST_INTEGER},
+    {"sizex", LST_INTEGER},
+    {"sizey", LST_INTEGER},
+    {"start", LST_FLOATINGPOINT},
+    {"length", LST_FLOATINGPOINT},
+    {"rate", LST_FLOATINGPOINT},
+    {"key", LST_STRING},
+    {"owner", LST_KEY},
+    {"scope", LST_INTEGER},
+    {"offset", LST_VECTOR},
+    {"flags", LST_INTEGER},
+    {"damage", LST_FLOATINGPOINT},
+    {"inventory", LST_STRING},
+    {"pos", LST_VECTOR},
+    {"vel", LST_VECTOR},
+    {"rot", LST_QUATERNION},
+    {"param", LST_INTEGER},
+    {"json", LST_STRING},
+    {"specifiers", LST_LIST},
+    {"name", LST_STRING},
+    {"angle", LST_FLOATINGPOINT},
+    {"face", LST_INTEGER},
+    {"anim", LST_STRING},
+    {"source", LST_VECTOR},
+    {"radius", LST_FLOATINGPOINT},
+    {"options", LST_LIST},
+    {"impact_sound", LST_STRING},
+    {"impact_volume", LST_FLOATINGPOINT},
+    {"color", LST_VECTOR},
+    {"link", LST_INTEGER},
+    {"mode", LST_INTEGER},
+    {"face", LST_INTEGER},
+    {"sizex", LST_INTEGER},
+    {"sizey", LST_INTEGER},
+    {"start", LST_FLOATINGPOINT},
+    {"length", LST_FLOATINGPOINT},
+    {"rate", LST_FLOATINGPOINT},
+    {"name", LST_STRING},
+    {"rules", LST_LIST},
+    {"face", LST_INTEGER},
+    {"params", LST_LIST},
+    {"anim", LST_STRING},
+    {"mask", LST_INTEGER},
+    {"change", LST_INTEGER},
+    {"pos", LST_VECTOR},
+    {"channel", LST_INTEGER},
+    {"msg", LST_STRING},
+    {"str1", LST_STRING},
+    {"str2", LST_STRING},
+    {"a", LST_QUATERNION},
+    {"b", LST_QUATERNION},
+    {"theta", LST_FLOATINGPOINT},
+    {"dst", LST_STRING},
+    {"position", LST_INTEGER},
+    {"src", LST_STRING},
+    {"val", LST_INTEGER},
+    {"number", LST_INTEGER},
+    {"axis", LST_VECTOR},
+    {"angle", LST_FLOATINGPOINT},
+    {"channel", LST_INTEGER},
+    {"name", LST_STRING},
+    {"id", LST_KEY},
+    {"msg", LST_STRING},
+    {"pos", LST_VECTOR},
+    {"options", LST_LIST},
+    {"start", LST_INTEGER},
+    {"count", LST_INTEGER},
+    {"type", LST_INTEGER},
+    {"title", LST_STRING},
+    {"url", LST_STRING},
+    {"params", LST_LIST},
+    {"anim", LST_STRING},
+    {"value", LST_INTEGER},
+    {"id", LST_KEY},
+    {"avatar", LST_KEY},
+    {"target", LST_INTEGER},
+    {"header", LST_STRING},
+    {"body", LST_STRING},
+    {"src", LST_STRING},
+    {"separators", LST_LIST},
+    {"spacers", LST_LIST},
+    {"avatar", LST_KEY},
+    {"linknum", LST_INTEGER},
+    {"num", LST_INTEGER},
+    {"str", LST_STRING},
+    {"id", LST_KEY},
+    {"base", LST_FLOATINGPOINT},
+    {"exponent", LST_FLOATINGPOINT},
+    {"channel", LST_INTEGER},
+    {"msg", LST_STRING},
+    {"options", LST_LIST},
+    {"target", LST_KEY},
+    {"parent", LST_INTEGER},
+    {"destination", LST_KEY},
+    {"amount", LST_INTEGER},
+    {"str1", LST_STRING},
+    {"str2", LST_STRING},
+    {"height", LST_FLOATINGPOINT},
+    {"water", LST_INTEGER},
+    {"tau", LST_FLOATINGPOINT},
+    {"target", LST_KEY},
+    {"options", LST_LIST},
+    {"force", LST_VECTOR},
+    {"torque", LST_VECTOR},
+    {"local", LST_INTEGER},
+    {"text", LST_STRING},
+    {"linknumber", LST_INTEGER},
+    {"texture", LST_STRING},
+    {"face", LST_INTEGER},
+    {"name", LST_STRING},
+    {"item", LST_STRING},
+    {"id", LST_KEY},
+    {"level", LST_INTEGER},
+    {"edge", LST_INTEGER},
+    {"offset", LST_VECTOR},
+    {"rot", LST_QUATERNION},
+    {"agent_id", LST_KEY},
+    {"transition", LST_FLOATINGPOINT},
+    {"environment", LST_STRING},
+    {"val", LST_FLOATINGPOINT},
+    {"q", LST_QUATERNION},
+    {"velocity", LST_VECTOR},
+    {"local", LST_INTEGER},
+    {"avatar", LST_KEY},
+    {"landmark", LST_STRING},
+    {"position", LST_VECTOR},
+    {"look_at", LST_VECTOR},
+    {"avatar", LST_KEY},
+    {"hours", LST_FLOATINGPOINT},
+    {"attach_point", LST_INTEGER},
+    {"sound", LST_STRING},
+    {"volume", LST_FLOATINGPOINT},
+    {"top_north_east", LST_VECTOR},
+    {"bottom_south_west", LST_VECTOR},
+    {"side", LST_INTEGER},
+    {"flags", LST_INTEGER},
+    {"msg", LST_STRING},
+    {"offset", LST_VECTOR},
+    {"mask", LST_INTEGER},
+    {"value", LST_INTEGER},
+    {"height", LST_FLOATINGPOINT},
+    {"water", LST_INTEGER},
+    {"tau", LST_FLOATINGPOINT},
+    {"src", LST_LIST},
+    {"stride", LST_INTEGER},
+    {"linknumber", LST_INTEGER},
+    {"rules", LST_LIST},
+    {"offset", LST_VECTOR},
+    {"k", LST_STRING},
+    {"dest", LST_LIST},
+    {"src", LST_LIST},
+    {"start", LST_INTEGER},
+    {"end", LST_INTEGER},
+    {"name", LST_STRING},
+    {"id", LST_KEY},
+    {"type", LST_INTEGER},
+    {"range", LST_FLOATINGPOINT},
+    {"arc", LST_FLOATINGPOINT},
+    {"rate", LST_FLOATINGPOINT},
+    {"id", LST_KEY},
+    {"request_id", LST_KEY},
+    {"content_type", LST_INTEGER},
+    {"val", LST_STRING},
+    {"channel", LST_INTEGER},
+    {"name", LST_STRING},
+    {"id", LST_KEY},
+    {"message", LST_STRING},
+    {"request_id", LST_KEY},
+    {"status", LST_INTEGER},
+    {"body", LST_STRING},
+    {"force", LST_VECTOR},
+    {"local", LST_INTEGER},
+    {"name", LST_STRING},
+    {"action", LST_INTEGER},
+    {"id", LST_KEY},
+    {"text", LST_STRING},
+    {"objects", LST_LIST},
+    {"linknumber", LST_INTEGER},
+    {"rules", LST_LIST},
+    {"agent", LST_KEY},
+    {"name", LST_STRING},
+    {"force", LST_VECTOR},
+    {"local", LST_INTEGER},
+    {"stat_type", LST_INTEGER},
+    {"linknumber", LST_INTEGER},
+    {"url", LST_STRING},
+    {"agent", LST_KEY},
+    {"alpha", LST_FLOATINGPOINT},
+    {"face", LST_INTEGER},
+    {"delay", LST_FLOATINGPOINT},
+    {"target", LST_KEY},
+    {"name", LST_STRING},
+    {"pin", LST_INTEGER},
+    {"running", LST_INTEGER},
+    {"start_param", LST_INTEGER},
+    {"theta", LST_FLOATINGPOINT},
+    {"src", LST_STRING},
+    {"src", LST_LIST},
+    {"index", LST_INTEGER},
+    {"val", LST_FLOATINGPOINT},
+    {"position", LST_VECTOR},
+    {"range", LST_FLOATINGPOINT},
+    {"particles", LST_INTEGER},
+    {"scale", LST_FLOATINGPOINT},
+    {"vel", LST_FLOATINGPOINT},
+    {"lifetime", LST_FLOATINGPOINT},
+    {"arc", LST_FLOATINGPOINT},
+    {"texture", LST_STRING},
+    {"offset", LST_VECTOR},
+    {"src", LST_LIST},
+    {"index", LST_INTEGER},
+    {"name", LST_STRING},
+    {"src", LST_STRING},
+    {"separators", LST_LIST},
+    {"spacers", LST_LIST},
+    {"agent", LST_KEY},
+    {"perm", LST_INTEGER},
+    {"flags", LST_INTEGER},
+    {"scope", LST_INTEGER},
+    {"options", LST_LIST},
+    {"linknumber", LST_INTEGER},
+    {"rules", LST_LIST},
+    {"num_detected", LST_INTEGER},
+    {"url", LST_STRING},
+    {"sound", LST_STRING},
+    {"volume", LST_FLOATINGPOINT},
+    {"id", LST_KEY},
+    {"sec", LST_FLOATINGPOINT},
+    {"id", LST_KEY},
+    {"success", LST_INTEGER},
+    {"data", LST_STRING},
+    {"agent", LST_KEY},
+    {"str", LST_STRING},
+    {"src", LST_STRING},
+    {"face", LST_INTEGER},
+    {"number", LST_INTEGER},
+    {"object_id", LST_KEY},
+    {"number", LST_INTEGER},
+    {"anim_state", LST_STRING},
+    {"name", LST_STRING},
+    {"target", LST_KEY},
+    {"options", LST_LIST},
+    {"key", LST_STRING},
+    {"id", LST_KEY},
+    {"params", LST_LIST},
+    {"pass", LST_INTEGER},
+    {"start", LST_INTEGER},
+    {"count", LST_INTEGER},
+};
+
+static constexpr BuiltinEntry BUILTIN_ENTRIES[] = {
+    {"SKY_RAYLEIGH_CONFIG", SYM_VARIABLE, LST_INTEGER, 0, 0, 18, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"VEHICLE_FLAG_HOVER_UP_ONLY", SYM_VARIABLE, LST_INTEGER, 0, 0, 32, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"AGENT_AWAY", SYM_VARIABLE, LST_INTEGER, 0, 0, 64, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llList2Rot", SYM_FUNCTION, LST_QUATERNION, 0, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"STATUS_ROTATE_X", SYM_VARIABLE, LST_INTEGER, 2, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llKey2Name", SYM_FUNCTION, LST_STRING, 2, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"VEHICLE_LINEAR_MOTOR_DIRECTION", SYM_VARIABLE, LST_INTEGER, 3, 0, 18, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"attach", SYM_EVENT, LST_NULL, 3, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"VEHICLE_TYPE_CAR", SYM_VARIABLE, LST_INTEGER, 4, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"LINK_ALL_CHILDREN", SYM_VARIABLE, LST_INTEGER, 4, 0, -3, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"KFM_REVERSE", SYM_VARIABLE, LST_INTEGER, 4, 0, 3, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetParcelMaxPrims", SYM_FUNCTION, LST_INTEGER, 4, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_TYPE_RING", SYM_VARIABLE, LST_INTEGER, 6, 0, 6, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetDayOffset", SYM_FUNCTION, LST_INTEGER, 6, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CAMERA_BEHINDNESS_LAG", SYM_VARIABLE, LST_INTEGER, 6, 0, 9, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PUBLIC_CHANNEL", SYM_VARIABLE, LST_INTEGER, 6, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetTextureOffset", SYM_FUNCTION, LST_VECTOR, 6, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"INVENTORY_TEXTURE", SYM_VARIABLE, LST_INTEGER, 7, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PARCEL_COUNT_TOTAL", SYM_VARIABLE, LST_INTEGER, 7, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"HTTP_BODY_TRUNCATED", SYM_VARIABLE, LST_INTEGER, 7, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llReplaceEnvironment", SYM_FUNCTION, LST_INTEGER, 7, 5, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"SIT_INVALID_AGENT", SYM_VARIABLE, LST_INTEGER, 12, 0, -4, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CONTENT_TYPE_ATOM", SYM_VARIABLE, LST_INTEGER, 12, 0, 4, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_HUD_BOTTOM", SYM_VARIABLE, LST_INTEGER, 12, 0, 37, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PARCEL_FLAG_ALLOW_TERRAFORM", SYM_VARIABLE, LST_INTEGER, 12, 0, 16, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"XP_ERROR_MATURITY_EXCEEDED", SYM_VARIABLE, LST_INTEGER, 12, 0, 16, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"http_request", SYM_EVENT, LST_NULL, 12, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CONTENT_TYPE_XML", SYM_VARIABLE, LST_INTEGER, 15, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetCameraRot", SYM_FUNCTION, LST_QUATERNION, 15, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CONTENT_TYPE_TEXT", SYM_VARIABLE, LST_INTEGER, 15, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llAddToLandPassList", SYM_FUNCTION, LST_NULL, 15, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetAnimation", SYM_FUNCTION, LST_STRING, 17, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"SKY_PLANET", SYM_VARIABLE, LST_INTEGER, 18, 0, 10, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_MATERIAL_RUBBER", SYM_VARIABLE, LST_INTEGER, 18, 0, 6, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"STATUS_DIE_AT_EDGE", SYM_VARIABLE, LST_INTEGER, 18, 0, 128, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llStopObjectAnimation", SYM_FUNCTION, LST_NULL, 18, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llCollisionFilter", SYM_FUNCTION, LST_NULL, 19, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_BUMP_WOOD", SYM_VARIABLE, LST_INTEGER, 22, 0, 3, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"TOUCH_INVALID_VECTOR", SYM_VARIABLE, LST_VECTOR, 22, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"RAD_TO_DEG", SYM_VARIABLE, LST_FLOATINGPOINT, 22, 0, 0, {57.2957795f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PARCEL_FLAG_USE_ACCESS_GROUP", SYM_VARIABLE, LST_INTEGER, 22, 0, 256, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llAttachToAvatarTemp", SYM_FUNCTION, LST_NULL, 22, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_TEMP_ON_REZ", SYM_VARIABLE, LST_INTEGER, 23, 0, 23, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"VEHICLE_ANGULAR_DEFLECTION_EFFICIENCY", SYM_VARIABLE, LST_INTEGER, 23, 0, 32, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGiveInventoryList", SYM_FUNCTION, LST_NULL, 23, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PSYS_PART_END_ALPHA", SYM_VARIABLE, LST_INTEGER, 26, 0, 4, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llModPow", SYM_FUNCTION, LST_INTEGER, 26, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetPermissions", SYM_FUNCTION, LST_INTEGER, 29, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llTextBox", SYM_FUNCTION, LST_NULL, 29, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"WATER_WAVE_DIRECTION", SYM_VARIABLE, LST_INTEGER, 32, 0, 106, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llToLower", SYM_FUNCTION, LST_STRING, 32, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetKeyframedMotion", SYM_FUNCTION, LST_NULL, 33, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"RCERR_SIM_PERF_LOW", SYM_VARIABLE, LST_INTEGER, 35, 0, -2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"XP_ERROR_QUOTA_EXCEEDED", SYM_VARIABLE, LST_INTEGER, 35, 0, 11, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"DATA_NAME", SYM_VARIABLE, LST_INTEGER, 35, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llLinksetDataReset", SYM_FUNCTION, LST_NULL, 35, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PURSUIT_INTERCEPT", SYM_VARIABLE, LST_INTEGER, 35, 0, 4, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"AGENT_LIST_PARCEL_OWNER", SYM_VARIABLE, LST_INTEGER, 35, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_FULLBRIGHT", SYM_VARIABLE, LST_INTEGER, 35, 0, 20, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSay", SYM_FUNCTION, LST_NULL, 35, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetRegionName", SYM_FUNCTION, LST_STRING, 37, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"RC_GET_ROOT_KEY", SYM_VARIABLE, LST_INTEGER, 37, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llDetectedPos", SYM_FUNCTION, LST_VECTOR, 37, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"INVENTORY_CLOTHING", SYM_VARIABLE, LST_INTEGER, 38, 0, 5, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llDetectedTouchUV", SYM_FUNCTION, LST_VECTOR, 38, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_TYPE_SCULPT", SYM_VARIABLE, LST_INTEGER, 39, 0, 7, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"SCRIPTED", SYM_VARIABLE, LST_INTEGER, 39, 0, 8, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_FACE_REAR", SYM_VARIABLE, LST_INTEGER, 39, 0, 49, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llListInsertList", SYM_FUNCTION, LST_LIST, 39, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetParcelPrimOwners", SYM_FUNCTION, LST_LIST, 42, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llRequestURL", SYM_FUNCTION, LST_KEY, 43, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llFrand", SYM_FUNCTION, LST_FLOATINGPOINT, 43, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"RC_REJECT_TYPES", SYM_VARIABLE, LST_INTEGER, 44, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llList2Json", SYM_FUNCTION, LST_STRING, 44, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_TYPE_CYLINDER", SYM_VARIABLE, LST_INTEGER, 46, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CONTROL_ROT_LEFT", SYM_VARIABLE, LST_INTEGER, 46, 0, 256, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"LAND_LEVEL", SYM_VARIABLE, LST_INTEGER, 46, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_BUMP_BARK", SYM_VARIABLE, LST_INTEGER, 46, 0, 4, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llJsonValueType", SYM_FUNCTION, LST_STRING, 46, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llParcelMediaQuery", SYM_FUNCTION, LST_LIST, 48, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_LLARM", SYM_VARIABLE, LST_INTEGER, 49, 0, 21, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_RLLEG", SYM_VARIABLE, LST_INTEGER, 49, 0, 24, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llAllowInventoryDrop", SYM_FUNCTION, LST_NULL, 49, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_TOTAL_INVENTORY_COUNT", SYM_VARIABLE, LST_INTEGER, 50, 0, 31, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"VEHICLE_ANGULAR_DEFLECTION_TIMESCALE", SYM_VARIABLE, LST_INTEGER, 50, 0, 33, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"VEHICLE_VERTICAL_ATTRACTION_TIMESCALE", SYM_VARIABLE, LST_INTEGER, 50, 0, 37, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_MOUTH", SYM_VARIABLE, LST_INTEGER, 50, 0, 11, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"AVOID_CHARACTERS", SYM_VARIABLE, LST_INTEGER, 50, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"SKY_GLOW", SYM_VARIABLE, LST_INTEGER, 50, 0, 6, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetLocalRot", SYM_FUNCTION, LST_NULL, 50, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ESTATE_ACCESS_ALLOWED_GROUP_ADD", SYM_VARIABLE, LST_INTEGER, 51, 0, 16, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_BUMP_CHECKER", SYM_VARIABLE, LST_INTEGER, 51, 0, 6, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llLinkSitTarget", SYM_FUNCTION, LST_NULL, 51, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PSYS_PART_FOLLOW_VELOCITY_MASK", SYM_VARIABLE, LST_INTEGER, 54, 0, 32, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetVehicleVectorParam", SYM_FUNCTION, LST_NULL, 54, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CHARACTER_RADIUS", SYM_VARIABLE, LST_INTEGER, 56, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetLocalRot", SYM_FUNCTION, LST_QUATERNION, 56, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGroundContour", SYM_FUNCTION, LST_VECTOR, 56, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"AGENT_FLYING", SYM_VARIABLE, LST_INTEGER, 57, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llRot2Axis", SYM_FUNCTION, LST_VECTOR, 57, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"LINKSETDATA_EPROTECTED", SYM_VARIABLE, LST_INTEGER, 58, 0, 3, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetTorque", SYM_FUNCTION, LST_NULL, 58, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"not_at_target", SYM_EVENT, LST_NULL, 60, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PARCEL_MEDIA_COMMAND_AUTO_ALIGN", SYM_VARIABLE, LST_INTEGER, 60, 0, 9, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"REMOTE_DATA_REPLY", SYM_VARIABLE, LST_INTEGER, 60, 0, 3, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CAMERA_FOCUS_OFFSET", SYM_VARIABLE, LST_INTEGER, 60, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_SHINY_NONE", SYM_VARIABLE, LST_INTEGER, 60, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"REGION_FLAG_SANDBOX", SYM_VARIABLE, LST_INTEGER, 60, 0, 256, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetRemoteScriptAccessPin", SYM_FUNCTION, LST_NULL, 60, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llRemoveFromLandBanList", SYM_FUNCTION, LST_NULL, 61, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llWhisper", SYM_FUNCTION, LST_NULL, 62, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"JSON_FALSE", SYM_VARIABLE, LST_STRING, 64, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, "﷗"},
+    {"llGetEnvironment", SYM_FUNCTION, LST_LIST, 64, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CHANGED_SCALE", SYM_VARIABLE, LST_INTEGER, 66, 0, 8, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CHARACTER_AVOIDANCE_MODE", SYM_VARIABLE, LST_INTEGER, 66, 0, 5, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"DEBUG_CHANNEL", SYM_VARIABLE, LST_INTEGER, 66, 0, 2147483647, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetScriptState", SYM_FUNCTION, LST_NULL, 66, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetClosestNavPoint", SYM_FUNCTION, LST_LIST, 68, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llMoveToTarget", SYM_FUNCTION, LST_NULL, 70, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"state_entry", SYM_EVENT, LST_NULL, 72, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llRegionSayTo", SYM_FUNCTION, LST_NULL, 72, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"experience_permissions_denied", SYM_EVENT, LST_NULL, 75, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_RWING", SYM_VARIABLE, LST_INTEGER, 77, 0, 46, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetMemoryLimit", SYM_FUNCTION, LST_INTEGER, 77, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_ROT_LOCAL", SYM_VARIABLE, LST_INTEGER, 77, 0, 29, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetAccel", SYM_FUNCTION, LST_VECTOR, 77, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"KFM_CMD_STOP", SYM_VARIABLE, LST_INTEGER, 77, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetCameraEyeOffset", SYM_FUNCTION, LST_NULL, 77, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_RENDER_WEIGHT", SYM_VARIABLE, LST_INTEGER, 78, 0, 24, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ENV_NOT_EXPERIENCE", SYM_VARIABLE, LST_INTEGER, 78, 0, -1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"remote_data", SYM_EVENT, LST_NULL, 78, 6, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSameGroup", SYM_FUNCTION, LST_INTEGER, 84, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"STRING_TRIM_HEAD", SYM_VARIABLE, LST_INTEGER, 85, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PARCEL_MEDIA_COMMAND_TIME", SYM_VARIABLE, LST_INTEGER, 85, 0, 6, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llRemoteLoadScript", SYM_FUNCTION, LST_NULL, 85, 4, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"HTTP_MIMETYPE", SYM_VARIABLE, LST_INTEGER, 89, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OPT_CHARACTER", SYM_VARIABLE, LST_INTEGER, 89, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CONTROL_LEFT", SYM_VARIABLE, LST_INTEGER, 89, 0, 4, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CHANGED_ALLOWED_DROP", SYM_VARIABLE, LST_INTEGER, 89, 0, 64, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"land_collision_start", SYM_EVENT, LST_NULL, 89, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llLog", SYM_FUNCTION, LST_FLOATINGPOINT, 90, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_PRIM_EQUIVALENCE", SYM_VARIABLE, LST_INTEGER, 91, 0, 13, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_MEDIA_PARAM_MAX", SYM_VARIABLE, LST_INTEGER, 91, 0, 14, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetInventoryPermMask", SYM_FUNCTION, LST_INTEGER, 91, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetObjectName", SYM_FUNCTION, LST_STRING, 93, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llDetectedLinkNumber", SYM_FUNCTION, LST_INTEGER, 93, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"DATA_SIM_STATUS", SYM_VARIABLE, LST_INTEGER, 94, 0, 6, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_SIZE", SYM_VARIABLE, LST_INTEGER, 94, 0, 7, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CLICK_ACTION_PLAY", SYM_VARIABLE, LST_INTEGER, 94, 0, 5, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"STRING_TRIM", SYM_VARIABLE, LST_INTEGER, 94, 0, 3, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PARCEL_MEDIA_COMMAND_LOOP_SET", SYM_VARIABLE, LST_INTEGER, 94, 0, 13, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"AGENT_MOUSELOOK", SYM_VARIABLE, LST_INTEGER, 94, 0, 8, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"SKY_GAMMA", SYM_VARIABLE, LST_INTEGER, 94, 0, 5, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PU_FAILURE_INVALID_GOAL", SYM_VARIABLE, LST_INTEGER, 94, 0, 3, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PSYS_PART_TARGET_POS_MASK", SYM_VARIABLE, LST_INTEGER, 94, 0, 64, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetMemoryLimit", SYM_FUNCTION, LST_INTEGER, 94, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_POS", SYM_VARIABLE, LST_INTEGER, 95, 0, 3, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"HTTP_USER_AGENT", SYM_VARIABLE, LST_INTEGER, 95, 0, 7, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetAngularVelocity", SYM_FUNCTION, LST_NULL, 95, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PARCEL_DETAILS_GROUP", SYM_VARIABLE, LST_INTEGER, 97, 0, 3, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"IMG_USE_BAKED_HAIR", SYM_VARIABLE, LST_STRING, 97, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, "09aac1fb-6bce-0bee-7d44-caac6dbb6c63"},
+    {"llHTTPRequest", SYM_FUNCTION, LST_KEY, 97, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"STATUS_RETURN_AT_EDGE", SYM_VARIABLE, LST_INTEGER, 100, 0, 256, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"KFM_COMMAND", SYM_VARIABLE, LST_INTEGER, 100, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"TYPE_FLOAT", SYM_VARIABLE, LST_INTEGER, 100, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"TOUCH_INVALID_TEXCOORD", SYM_VARIABLE, LST_VECTOR, 100, 0, 0, {-1.0f, -1.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_SCRIPT_MEMORY", SYM_VARIABLE, LST_INTEGER, 100, 0, 11, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_CHIN", SYM_VARIABLE, LST_INTEGER, 100, 0, 12, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetAgentSize", SYM_FUNCTION, LST_VECTOR, 100, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CHANGED_TELEPORT", SYM_VARIABLE, LST_INTEGER, 101, 0, 512, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_MASS", SYM_VARIABLE, LST_INTEGER, 101, 0, 43, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"AGENT_IN_AIR", SYM_VARIABLE, LST_INTEGER, 101, 0, 256, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"money", SYM_EVENT, LST_NULL, 101, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_MEDIA_WHITELIST", SYM_VARIABLE, LST_INTEGER, 103, 0, 12, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llRotLookAt", SYM_FUNCTION, LST_NULL, 103, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"path_update", SYM_EVENT, LST_NULL, 106, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_REYE", SYM_VARIABLE, LST_INTEGER, 108, 0, 16, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_LEYE", SYM_VARIABLE, LST_INTEGER, 108, 0, 15, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CONTROL_FWD", SYM_VARIABLE, LST_INTEGER, 108, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CAMERA_ACTIVE", SYM_VARIABLE, LST_INTEGER, 108, 0, 12, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_PATHFINDING_TYPE", SYM_VARIABLE, LST_INTEGER, 108, 0, 20, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llScaleTexture", SYM_FUNCTION, LST_NULL, 108, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"LAND_MEDIUM_BRUSH", SYM_VARIABLE, LST_INTEGER, 111, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"VEHICLE_FLAG_MOUSELOOK_BANK", SYM_VARIABLE, LST_INTEGER, 111, 0, 256, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llAsin", SYM_FUNCTION, LST_FLOATINGPOINT, 111, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetVehicleFloatParam", SYM_FUNCTION, LST_NULL, 112, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llApplyImpulse", SYM_FUNCTION, LST_NULL, 114, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llIntegerToBase64", SYM_FUNCTION, LST_STRING, 116, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetBuoyancy", SYM_FUNCTION, LST_NULL, 117, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGenerateKey", SYM_FUNCTION, LST_KEY, 118, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"INVENTORY_OBJECT", SYM_VARIABLE, LST_INTEGER, 118, 0, 6, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CONTENT_TYPE_XHTML", SYM_VARIABLE, LST_INTEGER, 118, 0, 3, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_BUMP_SUCTION", SYM_VARIABLE, LST_INTEGER, 118, 0, 16, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"MASK_GROUP", SYM_VARIABLE, LST_INTEGER, 118, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetSunRotation", SYM_FUNCTION, LST_QUATERNION, 118, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetListLength", SYM_FUNCTION, LST_INTEGER, 118, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_ALPHA_MODE_BLEND", SYM_VARIABLE, LST_INTEGER, 119, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_DESC", SYM_VARIABLE, LST_INTEGER, 119, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetNextEmail", SYM_FUNCTION, LST_NULL, 119, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llCloseRemoteDataChannel", SYM_FUNCTION, LST_NULL, 121, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetLinkNumber", SYM_FUNCTION, LST_INTEGER, 122, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"SIT_INVALID_OBJECT", SYM_VARIABLE, LST_INTEGER, 122, 0, -7, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llListenControl", SYM_FUNCTION, LST_NULL, 122, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetAnimationOverride", SYM_FUNCTION, LST_NULL, 124, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llXorBase64Strings", SYM_FUNCTION, LST_STRING, 126, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ENV_NO_EXPERIENCE_PERMISSION", SYM_VARIABLE, LST_INTEGER, 128, 0, -2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llReadKeyValue", SYM_FUNCTION, LST_KEY, 128, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llCollisionSprite", SYM_FUNCTION, LST_NULL, 129, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetPrimitiveParams", SYM_FUNCTION, LST_NULL, 130, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llForceMouselook", SYM_FUNCTION, LST_NULL, 131, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetOmega", SYM_FUNCTION, LST_VECTOR, 132, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetGeometricCenter", SYM_FUNCTION, LST_VECTOR, 132, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PSYS_SRC_BURST_RATE", SYM_VARIABLE, LST_INTEGER, 132, 0, 13, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"XP_ERROR_STORE_DISABLED", SYM_VARIABLE, LST_INTEGER, 132, 0, 12, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ERR_PARCEL_PERMISSIONS", SYM_VARIABLE, LST_INTEGER, 132, 0, -2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_RHAND", SYM_VARIABLE, LST_INTEGER, 132, 0, 6, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"touch_start", SYM_EVENT, LST_NULL, 132, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetLinkColor", SYM_FUNCTION, LST_NULL, 133, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PSYS_SRC_BURST_PART_COUNT", SYM_VARIABLE, LST_INTEGER, 136, 0, 15, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"TWO_PI", SYM_VARIABLE, LST_FLOATINGPOINT, 136, 0, 0, {6.2831853f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PROFILE_SCRIPT_MEMORY", SYM_VARIABLE, LST_INTEGER, 136, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_SHINY_MEDIUM", SYM_VARIABLE, LST_INTEGER, 136, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_LHAND_RING1", SYM_VARIABLE, LST_INTEGER, 136, 0, 41, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llAvatarOnSitTarget", SYM_FUNCTION, LST_KEY, 136, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"LINKSETDATA_OK", SYM_VARIABLE, LST_INTEGER, 136, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llList2Float", SYM_FUNCTION, LST_FLOATINGPOINT, 136, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PSYS_SRC_ANGLE_BEGIN", SYM_VARIABLE, LST_INTEGER, 138, 0, 22, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PSYS_PART_RIBBON_MASK", SYM_VARIABLE, LST_INTEGER, 138, 0, 1024, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"TRAVERSAL_TYPE_FAST", SYM_VARIABLE, LST_INTEGER, 138, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ENV_NO_PERMISSIONS", SYM_VARIABLE, LST_INTEGER, 138, 0, -9, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PAYMENT_INFO_ON_FILE", SYM_VARIABLE, LST_INTEGER, 138, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_LFOOT", SYM_VARIABLE, LST_INTEGER, 138, 0, 7, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PARCEL_FLAG_ALLOW_SCRIPTS", SYM_VARIABLE, LST_INTEGER, 138, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llList2String", SYM_FUNCTION, LST_STRING, 138, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_TYPE_BOX", SYM_VARIABLE, LST_INTEGER, 140, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetRegionPos", SYM_FUNCTION, LST_INTEGER, 140, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llRequestDisplayName", SYM_FUNCTION, LST_KEY, 141, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"STATUS_WHITELIST_FAILED", SYM_VARIABLE, LST_INTEGER, 142, 0, 2001, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llExecCharacterCmd", SYM_FUNCTION, LST_NULL, 142, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llRequestUserKey", SYM_FUNCTION, LST_KEY, 144, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llRot2Angle", SYM_FUNCTION, LST_FLOATINGPOINT, 145, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetStartParameter", SYM_FUNCTION, LST_INTEGER, 146, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"TYPE_INVALID", SYM_VARIABLE, LST_INTEGER, 146, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetSoundRadius", SYM_FUNCTION, LST_NULL, 146, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"VEHICLE_LINEAR_MOTOR_DECAY_TIMESCALE", SYM_VARIABLE, LST_INTEGER, 147, 0, 31, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OPT_AVATAR", SYM_VARIABLE, LST_INTEGER, 147, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PARCEL_DETAILS_ID", SYM_VARIABLE, LST_INTEGER, 147, 0, 5, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_BUMP_NONE", SYM_VARIABLE, LST_INTEGER, 147, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_SCRIPT_TIME", SYM_VARIABLE, LST_INTEGER, 147, 0, 12, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llDetectedVel", SYM_FUNCTION, LST_VECTOR, 147, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_UNKNOWN_DETAIL", SYM_VARIABLE, LST_INTEGER, 148, 0, -1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetInventoryType", SYM_FUNCTION, LST_INTEGER, 148, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_VELOCITY", SYM_VARIABLE, LST_INTEGER, 149, 0, 5, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetFreeURLs", SYM_FUNCTION, LST_INTEGER, 149, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetScriptState", SYM_FUNCTION, LST_INTEGER, 149, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"INVENTORY_LANDMARK", SYM_VARIABLE, LST_INTEGER, 150, 0, 3, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSensor", SYM_FUNCTION, LST_NULL, 150, 5, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_HUD_TOP_LEFT", SYM_VARIABLE, LST_INTEGER, 155, 0, 34, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PARCEL_DETAILS_DESC", SYM_VARIABLE, LST_INTEGER, 155, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llList2CSV", SYM_FUNCTION, LST_STRING, 155, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llRemoveInventory", SYM_FUNCTION, LST_NULL, 156, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"STATUS_MALFORMED_PARAMS", SYM_VARIABLE, LST_INTEGER, 157, 0, 1000, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_FLEXIBLE", SYM_VARIABLE, LST_INTEGER, 157, 0, 21, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PSYS_SRC_OMEGA", SYM_VARIABLE, LST_INTEGER, 157, 0, 21, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"VEHICLE_FLAG_HOVER_WATER_ONLY", SYM_VARIABLE, LST_INTEGER, 157, 0, 4, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_ALPHA_MODE_MASK", SYM_VARIABLE, LST_INTEGER, 157, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PERMISSION_REMAP_CONTROLS", SYM_VARIABLE, LST_INTEGER, 157, 0, 8, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"land_collision", SYM_EVENT, LST_NULL, 157, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"LINKSETDATA_UPDATE", SYM_VARIABLE, LST_INTEGER, 158, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"DATA_SIM_RATING", SYM_VARIABLE, LST_INTEGER, 158, 0, 7, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_HIND_LFOOT", SYM_VARIABLE, LST_INTEGER, 158, 0, 54, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llRequestSimulatorData", SYM_FUNCTION, LST_KEY, 158, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PSYS_SRC_MAX_AGE", SYM_VARIABLE, LST_INTEGER, 160, 0, 19, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llEscapeURL", SYM_FUNCTION, LST_STRING, 160, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"IMG_USE_BAKED_AUX2", SYM_VARIABLE, LST_STRING, 161, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, "03642e83-2bd1-4eb9-34b4-4c47ed586d2d"},
+    {"PERMISSION_TRACK_CAMERA", SYM_VARIABLE, LST_INTEGER, 161, 0, 1024, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetTexture", SYM_FUNCTION, LST_STRING, 161, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSensorRemove", SYM_FUNCTION, LST_NULL, 162, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_RETURN_REGION", SYM_VARIABLE, LST_INTEGER, 162, 0, 4, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llEdgeOfWorld", SYM_FUNCTION, LST_INTEGER, 162, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSin", SYM_FUNCTION, LST_FLOATINGPOINT, 164, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_MEDIA_MAX_WHITELIST_SIZE", SYM_VARIABLE, LST_INTEGER, 165, 0, 1024, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetStatus", SYM_FUNCTION, LST_INTEGER, 165, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"SKY_DOME", SYM_VARIABLE, LST_INTEGER, 166, 0, 4, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetLinkNumberOfSides", SYM_FUNCTION, LST_INTEGER, 166, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PARCEL_FLAG_ALLOW_CREATE_OBJECTS", SYM_VARIABLE, LST_INTEGER, 167, 0, 64, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_OMEGA", SYM_VARIABLE, LST_INTEGER, 167, 0, 29, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PU_FAILURE_UNREACHABLE", SYM_VARIABLE, LST_INTEGER, 167, 0, 4, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CHARACTER_MAX_TURN_RADIUS", SYM_VARIABLE, LST_INTEGER, 167, 0, 10, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetLinkName", SYM_FUNCTION, LST_STRING, 167, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CHARACTER_CMD_STOP", SYM_VARIABLE, LST_INTEGER, 168, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llVecMag", SYM_FUNCTION, LST_FLOATINGPOINT, 168, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CONTROL_ROT_RIGHT", SYM_VARIABLE, LST_INTEGER, 169, 0, 512, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"XP_ERROR_UNKNOWN_ERROR", SYM_VARIABLE, LST_INTEGER, 169, 0, 10, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"SKY_TRACKS", SYM_VARIABLE, LST_INTEGER, 169, 0, 15, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_LWING", SYM_VARIABLE, LST_INTEGER, 169, 0, 45, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"VEHICLE_FLAG_LIMIT_ROLL_ONLY", SYM_VARIABLE, LST_INTEGER, 169, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PARCEL_FLAG_ALLOW_ALL_OBJECT_ENTRY", SYM_VARIABLE, LST_INTEGER, 169, 0, 134217728, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ZERO_VECTOR", SYM_VARIABLE, LST_VECTOR, 169, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"KFM_PING_PONG", SYM_VARIABLE, LST_INTEGER, 169, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"VEHICLE_FLAG_NO_DEFLECTION_UP", SYM_VARIABLE, LST_INTEGER, 169, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_OWNER", SYM_VARIABLE, LST_INTEGER, 169, 0, 6, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_HUD_BOTTOM_RIGHT", SYM_VARIABLE, LST_INTEGER, 169, 0, 38, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_NAME", SYM_VARIABLE, LST_INTEGER, 169, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_MEDIA_ALT_IMAGE_ENABLE", SYM_VARIABLE, LST_INTEGER, 169, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ERR_RUNTIME_PERMISSIONS", SYM_VARIABLE, LST_INTEGER, 169, 0, -4, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"sensor", SYM_EVENT, LST_NULL, 169, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llUpdateKeyValue", SYM_FUNCTION, LST_KEY, 170, 4, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"collision_start", SYM_EVENT, LST_NULL, 174, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetNotecardLine", SYM_FUNCTION, LST_KEY, 175, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CAMERA_POSITION", SYM_VARIABLE, LST_INTEGER, 177, 0, 13, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PARCEL_MEDIA_COMMAND_LOOP", SYM_VARIABLE, LST_INTEGER, 177, 0, 3, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"JSON_INVALID", SYM_VARIABLE, LST_STRING, 177, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, "﷐"},
+    {"CHARACTER_LENGTH", SYM_VARIABLE, LST_INTEGER, 177, 0, 3, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PARCEL_MEDIA_COMMAND_SIZE", SYM_VARIABLE, LST_INTEGER, 177, 0, 11, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_ROOT", SYM_VARIABLE, LST_INTEGER, 177, 0, 18, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CONTROL_BACK", SYM_VARIABLE, LST_INTEGER, 177, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llTargetRemove", SYM_FUNCTION, LST_NULL, 177, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PARCEL_DETAILS_SCRIPT_DANGER", SYM_VARIABLE, LST_INTEGER, 178, 0, 13, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_MATERIAL", SYM_VARIABLE, LST_INTEGER, 178, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llReleaseCamera", SYM_FUNCTION, LST_NULL, 178, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ZERO_ROTATION", SYM_VARIABLE, LST_QUATERNION, 179, 0, 0, {0.0f, 0.0f, 0.0f, 1.0f}, nullptr},
+    {"ATTACH_FACE_LEAR", SYM_VARIABLE, LST_INTEGER, 179, 0, 48, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"AGENT_ALWAYS_RUN", SYM_VARIABLE, LST_INTEGER, 179, 0, 4096, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetParcelDetails", SYM_FUNCTION, LST_LIST, 179, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"LAND_LOWER", SYM_VARIABLE, LST_INTEGER, 181, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"FRICTION", SYM_VARIABLE, LST_INTEGER, 181, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PSYS_PART_EMISSIVE_MASK", SYM_VARIABLE, LST_INTEGER, 181, 0, 256, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llStringLength", SYM_FUNCTION, LST_INTEGER, 181, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PARCEL_MEDIA_COMMAND_UNLOAD", SYM_VARIABLE, LST_INTEGER, 182, 0, 8, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llLinksetDataReadProtected", SYM_FUNCTION, LST_STRING, 182, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"TYPE_INTEGER", SYM_VARIABLE, LST_INTEGER, 184, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llJsonSetValue", SYM_FUNCTION, LST_STRING, 184, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CLICK_ACTION_TOUCH", SYM_VARIABLE, LST_INTEGER, 187, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_RLARM", SYM_VARIABLE, LST_INTEGER, 187, 0, 19, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"LAND_SMALL_BRUSH", SYM_VARIABLE, LST_INTEGER, 187, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"WANDER_PAUSE_AT_WAYPOINTS", SYM_VARIABLE, LST_INTEGER, 187, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llStringToBase64", SYM_FUNCTION, LST_STRING, 187, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_SHINY_LOW", SYM_VARIABLE, LST_INTEGER, 188, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CAMERA_POSITION_LOCKED", SYM_VARIABLE, LST_INTEGER, 188, 0, 21, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_MEDIA_MAX_HEIGHT_PIXELS", SYM_VARIABLE, LST_INTEGER, 188, 0, 2048, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llLinksetDataWriteProtected", SYM_FUNCTION, LST_INTEGER, 188, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_RETURN_PARCEL", SYM_VARIABLE, LST_INTEGER, 191, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llDetectedName", SYM_FUNCTION, LST_STRING, 191, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llCastRay", SYM_FUNCTION, LST_LIST, 192, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_MEDIA_PERM_NONE", SYM_VARIABLE, LST_INTEGER, 195, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetPhysicsMaterial", SYM_FUNCTION, LST_NULL, 195, 5, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CHANGED_INVENTORY", SYM_VARIABLE, LST_INTEGER, 200, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"no_sensor", SYM_EVENT, LST_NULL, 200, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_ALPHA_MODE", SYM_VARIABLE, LST_INTEGER, 200, 0, 38, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llLoopSound", SYM_FUNCTION, LST_NULL, 200, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llPushObject", SYM_FUNCTION, LST_NULL, 202, 4, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetStaticPath", SYM_FUNCTION, LST_LIST, 206, 4, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetUsedMemory", SYM_FUNCTION, LST_INTEGER, 210, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llList2List", SYM_FUNCTION, LST_LIST, 210, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"TYPE_KEY", SYM_VARIABLE, LST_INTEGER, 213, 0, 4, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llRezObject", SYM_FUNCTION, LST_NULL, 213, 5, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ENV_NO_ENVIRONMENT", SYM_VARIABLE, LST_INTEGER, 218, 0, -3, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetTime", SYM_FUNCTION, LST_FLOATINGPOINT, 218, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"AGENT_SITTING", SYM_VARIABLE, LST_INTEGER, 218, 0, 16, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetRegionTimeDilation", SYM_FUNCTION, LST_FLOATINGPOINT, 218, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_ATTACHED_SLOTS_AVAILABLE", SYM_VARIABLE, LST_INTEGER, 218, 0, 35, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CHARACTER_CMD_JUMP", SYM_VARIABLE, LST_INTEGER, 218, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PARCEL_COUNT_OTHER", SYM_VARIABLE, LST_INTEGER, 218, 0, 3, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llListSort", SYM_FUNCTION, LST_LIST, 218, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGroundNormal", SYM_FUNCTION, LST_VECTOR, 221, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"IMG_USE_BAKED_AUX3", SYM_VARIABLE, LST_STRING, 222, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, "edd51b77-fc10-ce7a-4b3d-011dfc349e4f"},
+    {"TP_ROUTING_BLOCKED", SYM_VARIABLE, LST_INTEGER, 222, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llLinkParticleSystem", SYM_FUNCTION, LST_NULL, 222, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"STATUS_BLOCK_GRAB_OBJECT", SYM_VARIABLE, LST_INTEGER, 224, 0, 1024, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PERMISSION_TRIGGER_ANIMATION", SYM_VARIABLE, LST_INTEGER, 224, 0, 16, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_MATERIAL_LIGHT", SYM_VARIABLE, LST_INTEGER, 224, 0, 7, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_MATERIAL_FLESH", SYM_VARIABLE, LST_INTEGER, 224, 0, 4, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetSimulatorHostname", SYM_FUNCTION, LST_STRING, 224, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_MEDIA_AUTO_SCALE", SYM_VARIABLE, LST_INTEGER, 224, 0, 6, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_PHYSICS_SHAPE_CONVEX", SYM_VARIABLE, LST_INTEGER, 224, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PSYS_PART_BLEND_FUNC_DEST", SYM_VARIABLE, LST_INTEGER, 224, 0, 25, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"REGION_FLAG_RESTRICT_PUSHOBJECT", SYM_VARIABLE, LST_INTEGER, 224, 0, 4194304, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llPlaySoundSlave", SYM_FUNCTION, LST_NULL, 224, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"LINK_SET", SYM_VARIABLE, LST_INTEGER, 226, 0, -1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llTeleportAgentGlobalCoords", SYM_FUNCTION, LST_NULL, 226, 4, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llBase64ToString", SYM_FUNCTION, LST_STRING, 230, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"STATUS_ROTATE_Y", SYM_VARIABLE, LST_INTEGER, 231, 0, 4, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llMapDestination", SYM_FUNCTION, LST_NULL, 231, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSHA256String", SYM_FUNCTION, LST_STRING, 234, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CAMERA_BEHINDNESS_ANGLE", SYM_VARIABLE, LST_INTEGER, 235, 0, 8, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSoundPreload", SYM_FUNCTION, LST_NULL, 235, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"LOOP", SYM_VARIABLE, LST_INTEGER, 236, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetPayPrice", SYM_FUNCTION, LST_NULL, 236, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetTimestamp", SYM_FUNCTION, LST_STRING, 238, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_PHYSICS", SYM_VARIABLE, LST_INTEGER, 238, 0, 21, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llParticleSystem", SYM_FUNCTION, LST_NULL, 238, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetLinkMedia", SYM_FUNCTION, LST_INTEGER, 239, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetUsername", SYM_FUNCTION, LST_STRING, 242, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llParcelMediaCommandList", SYM_FUNCTION, LST_NULL, 243, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetFreeMemory", SYM_FUNCTION, LST_INTEGER, 244, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llLoopSoundSlave", SYM_FUNCTION, LST_NULL, 244, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"KFM_ROTATION", SYM_VARIABLE, LST_INTEGER, 246, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llRound", SYM_FUNCTION, LST_INTEGER, 246, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"timer", SYM_EVENT, LST_NULL, 247, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llAdjustSoundVolume", SYM_FUNCTION, LST_NULL, 247, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ESTATE_ACCESS_ALLOWED_AGENT_ADD", SYM_VARIABLE, LST_INTEGER, 248, 0, 4, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSqrt", SYM_FUNCTION, LST_FLOATINGPOINT, 248, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PARCEL_FLAG_LOCAL_SOUND_ONLY", SYM_VARIABLE, LST_INTEGER, 249, 0, 32768, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"VEHICLE_TYPE_BOAT", SYM_VARIABLE, LST_INTEGER, 249, 0, 3, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetObjectDesc", SYM_FUNCTION, LST_NULL, 249, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"REGION_FLAG_BLOCK_TERRAFORM", SYM_VARIABLE, LST_INTEGER, 250, 0, 64, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_SPECULAR", SYM_VARIABLE, LST_INTEGER, 250, 0, 36, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llWater", SYM_FUNCTION, LST_FLOATINGPOINT, 250, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetLandOwnerAt", SYM_FUNCTION, LST_KEY, 251, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llPatrolPoints", SYM_FUNCTION, LST_NULL, 252, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"REMOTE_DATA_REQUEST", SYM_VARIABLE, LST_INTEGER, 254, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_PROJECTOR", SYM_VARIABLE, LST_INTEGER, 254, 0, 42, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ENV_INVALID_AGENT", SYM_VARIABLE, LST_INTEGER, 254, 0, -4, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"LINKSETDATA_DELETE", SYM_VARIABLE, LST_INTEGER, 254, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetEnvironment", SYM_FUNCTION, LST_INTEGER, 254, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_TEMP_ON_REZ", SYM_VARIABLE, LST_INTEGER, 256, 0, 4, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_DESC", SYM_VARIABLE, LST_INTEGER, 256, 0, 28, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"LIST_STAT_MAX", SYM_VARIABLE, LST_INTEGER, 256, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetRegionTimeOfDay", SYM_FUNCTION, LST_FLOATINGPOINT, 256, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llMD5String", SYM_FUNCTION, LST_STRING, 256, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetObjectMass", SYM_FUNCTION, LST_FLOATINGPOINT, 258, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"LINK_ALL_OTHERS", SYM_VARIABLE, LST_INTEGER, 259, 0, -2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PSYS_SRC_BURST_RADIUS", SYM_VARIABLE, LST_INTEGER, 259, 0, 16, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetBoundingBox", SYM_FUNCTION, LST_LIST, 259, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetRegionCorner", SYM_FUNCTION, LST_VECTOR, 260, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PU_EVADE_SPOTTED", SYM_VARIABLE, LST_INTEGER, 260, 0, 8, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_TEXT_COLOR", SYM_VARIABLE, LST_INTEGER, 260, 0, 48, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CLICK_ACTION_OPEN", SYM_VARIABLE, LST_INTEGER, 260, 0, 4, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_LEAR", SYM_VARIABLE, LST_INTEGER, 260, 0, 13, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"experience_permissions", SYM_EVENT, LST_NULL, 260, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"RCERR_CAST_TIME_EXCEEDED", SYM_VARIABLE, LST_INTEGER, 261, 0, -3, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PATROL_PAUSE_AT_WAYPOINTS", SYM_VARIABLE, LST_INTEGER, 261, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetText", SYM_FUNCTION, LST_NULL, 261, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ENV_THROTTLE", SYM_VARIABLE, LST_INTEGER, 264, 0, -8, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"STATUS_NOT_FOUND", SYM_VARIABLE, LST_INTEGER, 264, 0, 1003, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"TEXTURE_PLYWOOD", SYM_VARIABLE, LST_STRING, 264, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, "89556747-24cb-43ed-920b-47caed15465f"},
+    {"llSetClickAction", SYM_FUNCTION, LST_NULL, 264, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_BUMP_TILE", SYM_VARIABLE, LST_INTEGER, 265, 0, 8, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_HOLE_CIRCLE", SYM_VARIABLE, LST_INTEGER, 265, 0, 16, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PERMISSION_CONTROL_CAMERA", SYM_VARIABLE, LST_INTEGER, 265, 0, 2048, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"SKY_MIE_CONFIG", SYM_VARIABLE, LST_INTEGER, 265, 0, 17, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llResetOtherScript", SYM_FUNCTION, LST_NULL, 265, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llWanderWithin", SYM_FUNCTION, LST_NULL, 266, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetUnixTime", SYM_FUNCTION, LST_INTEGER, 269, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_REZZER_KEY", SYM_VARIABLE, LST_INTEGER, 269, 0, 32, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_TYPE", SYM_VARIABLE, LST_INTEGER, 269, 0, 9, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"XP_ERROR_INVALID_PARAMETERS", SYM_VARIABLE, LST_INTEGER, 269, 0, 3, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"DATA_BORN", SYM_VARIABLE, LST_INTEGER, 269, 0, 3, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"FALSE", SYM_VARIABLE, LST_INTEGER, 269, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PARCEL_FLAG_ALLOW_LANDMARK", SYM_VARIABLE, LST_INTEGER, 269, 0, 8, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CAMERA_FOCUS_LAG", SYM_VARIABLE, LST_INTEGER, 269, 0, 6, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PARCEL_DETAILS_FLAGS", SYM_VARIABLE, LST_INTEGER, 269, 0, 12, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetParcelMusicURL", SYM_FUNCTION, LST_STRING, 269, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PI_BY_TWO", SYM_VARIABLE, LST_FLOATINGPOINT, 269, 0, 0, {1.57079633f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetPrimMediaParams", SYM_FUNCTION, LST_INTEGER, 269, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llPlaySound", SYM_FUNCTION, LST_NULL, 271, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetLinkAlpha", SYM_FUNCTION, LST_NULL, 273, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ENVIRONMENT_DAYINFO", SYM_VARIABLE, LST_INTEGER, 276, 0, 200, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CLICK_ACTION_BUY", SYM_VARIABLE, LST_INTEGER, 276, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetRegionMoonDirection", SYM_FUNCTION, LST_VECTOR, 276, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llDetectedKey", SYM_FUNCTION, LST_KEY, 276, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"LAND_NOISE", SYM_VARIABLE, LST_INTEGER, 277, 0, 4, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PURSUIT_GOAL_TOLERANCE", SYM_VARIABLE, LST_INTEGER, 277, 0, 5, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llOpenRemoteDataChannel", SYM_FUNCTION, LST_NULL, 277, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llDetectedTouchBinormal", SYM_FUNCTION, LST_VECTOR, 277, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_LEFT_PEC", SYM_VARIABLE, LST_INTEGER, 278, 0, 29, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PARCEL_COUNT_OWNER", SYM_VARIABLE, LST_INTEGER, 278, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_NOSE", SYM_VARIABLE, LST_INTEGER, 278, 0, 17, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"link_message", SYM_EVENT, LST_NULL, 278, 4, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llClearPrimMedia", SYM_FUNCTION, LST_INTEGER, 282, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PERM_MODIFY", SYM_VARIABLE, LST_INTEGER, 283, 0, 16384, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ALL_SIDES", SYM_VARIABLE, LST_INTEGER, 283, 0, -1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"INVENTORY_GESTURE", SYM_VARIABLE, LST_INTEGER, 283, 0, 21, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llRequestSecureURL", SYM_FUNCTION, LST_KEY, 283, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"object_rez", SYM_EVENT, LST_NULL, 283, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PARCEL_FLAG_RESTRICT_PUSHOBJECT", SYM_VARIABLE, LST_INTEGER, 284, 0, 2097152, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llUnescapeURL", SYM_FUNCTION, LST_STRING, 284, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"GCNP_RADIUS", SYM_VARIABLE, LST_INTEGER, 285, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llDeleteSubString", SYM_FUNCTION, LST_STRING, 285, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetInventoryPermMask", SYM_FUNCTION, LST_NULL, 288, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llAxes2Rot", SYM_FUNCTION, LST_QUATERNION, 291, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PSYS_PART_BF_DEST_COLOR", SYM_VARIABLE, LST_INTEGER, 294, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llDeleteSubList", SYM_FUNCTION, LST_LIST, 294, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"JSON_OBJECT", SYM_VARIABLE, LST_STRING, 297, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, "﷑"},
+    {"llGetAgentInfo", SYM_FUNCTION, LST_INTEGER, 297, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSubStringIndex", SYM_FUNCTION, LST_INTEGER, 298, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGodLikeRezObject", SYM_FUNCTION, LST_NULL, 300, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"LIST_STAT_SUM", SYM_VARIABLE, LST_INTEGER, 302, 0, 6, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetHTTPHeader", SYM_FUNCTION, LST_STRING, 302, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PSYS_PART_BF_ONE", SYM_VARIABLE, LST_INTEGER, 304, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llStringTrim", SYM_FUNCTION, LST_STRING, 304, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetEnergy", SYM_FUNCTION, LST_FLOATINGPOINT, 306, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llMakeFire", SYM_FUNCTION, LST_NULL, 306, 7, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"LINKSETDATA_NOTFOUND", SYM_VARIABLE, LST_INTEGER, 313, 0, 4, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetKey", SYM_FUNCTION, LST_KEY, 313, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_TEXT", SYM_VARIABLE, LST_INTEGER, 313, 0, 26, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"XP_ERROR_NONE", SYM_VARIABLE, LST_INTEGER, 313, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llRot2Left", SYM_FUNCTION, LST_VECTOR, 313, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"LINKSETDATA_ENOKEY", SYM_VARIABLE, LST_INTEGER, 314, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llTransferLindenDollars", SYM_FUNCTION, LST_KEY, 314, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PARCEL_FLAG_USE_BAN_LIST", SYM_VARIABLE, LST_INTEGER, 316, 0, 1024, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llDumpList2String", SYM_FUNCTION, LST_STRING, 316, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"REGION_FLAG_DISABLE_COLLISIONS", SYM_VARIABLE, LST_INTEGER, 318, 0, 4096, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"HTTP_PRAGMA_NO_CACHE", SYM_VARIABLE, LST_INTEGER, 318, 0, 6, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetSoundQueueing", SYM_FUNCTION, LST_NULL, 318, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"AGENT_LIST_REGION", SYM_VARIABLE, LST_INTEGER, 319, 0, 4, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llEmail", SYM_FUNCTION, LST_NULL, 319, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llDetectedRot", SYM_FUNCTION, LST_QUATERNION, 322, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llLinksetDataAvailable", SYM_FUNCTION, LST_INTEGER, 323, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetOwnerKey", SYM_FUNCTION, LST_KEY, 323, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"RC_REJECT_AGENTS", SYM_VARIABLE, LST_INTEGER, 324, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"STATUS_CAST_SHADOWS", SYM_VARIABLE, LST_INTEGER, 324, 0, 512, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PSYS_PART_BF_SOURCE_ALPHA", SYM_VARIABLE, LST_INTEGER, 324, 0, 7, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llDetectedType", SYM_FUNCTION, LST_INTEGER, 324, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"STATUS_BOUNDS_ERROR", SYM_VARIABLE, LST_INTEGER, 325, 0, 1002, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"REGION_FLAG_BLOCK_FLYOVER", SYM_VARIABLE, LST_INTEGER, 325, 0, 134217728, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PARCEL_MEDIA_COMMAND_AGENT", SYM_VARIABLE, LST_INTEGER, 325, 0, 7, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetPos", SYM_FUNCTION, LST_NULL, 325, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"AGENT_CROUCHING", SYM_VARIABLE, LST_INTEGER, 326, 0, 1024, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_PHYSICS_COST", SYM_VARIABLE, LST_INTEGER, 326, 0, 16, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ESTATE_ACCESS_BANNED_AGENT_ADD", SYM_VARIABLE, LST_INTEGER, 326, 0, 64, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"LAND_LARGE_BRUSH", SYM_VARIABLE, LST_INTEGER, 326, 0, 3, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetTimeOfDay", SYM_FUNCTION, LST_FLOATINGPOINT, 326, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_TEXGEN_DEFAULT", SYM_VARIABLE, LST_INTEGER, 326, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llList2Integer", SYM_FUNCTION, LST_INTEGER, 326, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"KFM_CMD_PAUSE", SYM_VARIABLE, LST_INTEGER, 328, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CLICK_ACTION_NONE", SYM_VARIABLE, LST_INTEGER, 328, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_MEDIA_AUTO_LOOP", SYM_VARIABLE, LST_INTEGER, 328, 0, 4, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_MEDIA_PERMS_CONTROL", SYM_VARIABLE, LST_INTEGER, 328, 0, 14, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_CREATION_TIME", SYM_VARIABLE, LST_INTEGER, 328, 0, 36, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"MASK_BASE", SYM_VARIABLE, LST_INTEGER, 328, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"IMG_USE_BAKED_EYES", SYM_VARIABLE, LST_STRING, 328, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, "52cc6bb6-2ee5-e632-d3ad-50197b1dcb8a"},
+    {"llDataSizeKeyValue", SYM_FUNCTION, LST_KEY, 328, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llDetectedTouchFace", SYM_FUNCTION, LST_INTEGER, 328, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PSYS_PART_END_SCALE", SYM_VARIABLE, LST_INTEGER, 329, 0, 6, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PARCEL_MEDIA_COMMAND_TYPE", SYM_VARIABLE, LST_INTEGER, 329, 0, 10, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llLinksetDataCountKeys", SYM_FUNCTION, LST_INTEGER, 329, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OPT_MATERIAL_VOLUME", SYM_VARIABLE, LST_INTEGER, 329, 0, 5, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetRot", SYM_FUNCTION, LST_QUATERNION, 329, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetObjectDesc", SYM_FUNCTION, LST_STRING, 329, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PU_FAILURE_PARCEL_UNREACHABLE", SYM_VARIABLE, LST_INTEGER, 329, 0, 11, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PARCEL_DETAILS_NAME", SYM_VARIABLE, LST_INTEGER, 329, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"on_rez", SYM_EVENT, LST_NULL, 329, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"TEXTURE_MEDIA", SYM_VARIABLE, LST_STRING, 330, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, "8b5fec65-8d8d-9dc5-cda8-8fdf2716e361"},
+    {"llSetLinkCamera", SYM_FUNCTION, LST_NULL, 330, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PERMISSION_OVERRIDE_ANIMATIONS", SYM_VARIABLE, LST_INTEGER, 333, 0, 32768, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetParcelFlags", SYM_FUNCTION, LST_INTEGER, 333, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llRotTargetRemove", SYM_FUNCTION, LST_NULL, 334, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_MEDIA_AUTO_PLAY", SYM_VARIABLE, LST_INTEGER, 335, 0, 5, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"AVOID_DYNAMIC_OBSTACLES", SYM_VARIABLE, LST_INTEGER, 335, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CAMERA_DISTANCE", SYM_VARIABLE, LST_INTEGER, 335, 0, 7, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OPT_STATIC_OBSTACLE", SYM_VARIABLE, LST_INTEGER, 335, 0, 4, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llScriptDanger", SYM_FUNCTION, LST_INTEGER, 335, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_SLICE", SYM_VARIABLE, LST_INTEGER, 336, 0, 35, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSitOnLink", SYM_FUNCTION, LST_INTEGER, 336, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PSYS_PART_START_GLOW", SYM_VARIABLE, LST_INTEGER, 338, 0, 26, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PSYS_SRC_TARGET_KEY", SYM_VARIABLE, LST_INTEGER, 338, 0, 20, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PARCEL_DETAILS_AREA", SYM_VARIABLE, LST_INTEGER, 338, 0, 4, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_HEAD", SYM_VARIABLE, LST_INTEGER, 338, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"KFM_MODE", SYM_VARIABLE, LST_INTEGER, 338, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_FACE_TONGUE", SYM_VARIABLE, LST_INTEGER, 338, 0, 52, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llJson2List", SYM_FUNCTION, LST_LIST, 338, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetAnimationList", SYM_FUNCTION, LST_LIST, 339, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetStatus", SYM_FUNCTION, LST_NULL, 340, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llDie", SYM_FUNCTION, LST_NULL, 342, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CHANGED_LINK", SYM_VARIABLE, LST_INTEGER, 342, 0, 32, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PSYS_PART_START_ALPHA", SYM_VARIABLE, LST_INTEGER, 342, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"LAND_SMOOTH", SYM_VARIABLE, LST_INTEGER, 342, 0, 3, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"SQRT2", SYM_VARIABLE, LST_FLOATINGPOINT, 342, 0, 0, {1.41421356f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PSYS_SRC_OUTERANGLE", SYM_VARIABLE, LST_INTEGER, 342, 0, 11, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PERMISSION_RETURN_OBJECTS", SYM_VARIABLE, LST_INTEGER, 342, 0, 65536, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"AGENT_WALKING", SYM_VARIABLE, LST_INTEGER, 342, 0, 128, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"VEHICLE_BUOYANCY", SYM_VARIABLE, LST_INTEGER, 342, 0, 27, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"STRING_TRIM_TAIL", SYM_VARIABLE, LST_INTEGER, 342, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PARCEL_MEDIA_COMMAND_PAUSE", SYM_VARIABLE, LST_INTEGER, 342, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetAttachedList", SYM_FUNCTION, LST_LIST, 342, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"WATER_NORMAL_SCALE", SYM_VARIABLE, LST_INTEGER, 343, 0, 104, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PSYS_SRC_PATTERN", SYM_VARIABLE, LST_INTEGER, 343, 0, 9, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PERMISSION_TELEPORT", SYM_VARIABLE, LST_INTEGER, 343, 0, 4096, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llScaleByFactor", SYM_FUNCTION, LST_INTEGER, 343, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"touch_end", SYM_EVENT, LST_NULL, 344, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"HTTP_BODY_MAXLENGTH", SYM_VARIABLE, LST_INTEGER, 345, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OPT_EXCLUSION_VOLUME", SYM_VARIABLE, LST_INTEGER, 345, 0, 6, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llAvatarOnLinkSitTarget", SYM_FUNCTION, LST_KEY, 345, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"HORIZONTAL", SYM_VARIABLE, LST_INTEGER, 346, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"http_response", SYM_EVENT, LST_NULL, 346, 4, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_NORMAL", SYM_VARIABLE, LST_INTEGER, 350, 0, 37, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PING_PONG", SYM_VARIABLE, LST_INTEGER, 350, 0, 8, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"LINKSETDATA_EMEMORY", SYM_VARIABLE, LST_INTEGER, 350, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"JSON_NUMBER", SYM_VARIABLE, LST_STRING, 350, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, "﷓"},
+    {"llGetLinkMedia", SYM_FUNCTION, LST_LIST, 350, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PAY_HIDE", SYM_VARIABLE, LST_INTEGER, 353, 0, -1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetRegionFPS", SYM_FUNCTION, LST_FLOATINGPOINT, 353, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PERMISSION_TAKE_CONTROLS", SYM_VARIABLE, LST_INTEGER, 353, 0, 4, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PSYS_PART_INTERP_SCALE_MASK", SYM_VARIABLE, LST_INTEGER, 353, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"XP_ERROR_NOT_PERMITTED", SYM_VARIABLE, LST_INTEGER, 353, 0, 4, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llDetachFromAvatar", SYM_FUNCTION, LST_NULL, 353, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PSYS_PART_END_GLOW", SYM_VARIABLE, LST_INTEGER, 353, 0, 27, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetInventoryName", SYM_FUNCTION, LST_STRING, 353, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_MEDIA_PERM_GROUP", SYM_VARIABLE, LST_INTEGER, 355, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"SKY_TEXTURE_DEFAULTS", SYM_VARIABLE, LST_INTEGER, 355, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"RESTITUTION", SYM_VARIABLE, LST_INTEGER, 355, 0, 4, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_CAST_SHADOWS", SYM_VARIABLE, LST_INTEGER, 355, 0, 24, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_MEDIA_HOME_URL", SYM_VARIABLE, LST_INTEGER, 355, 0, 3, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"LIST_STAT_NUM_COUNT", SYM_VARIABLE, LST_INTEGER, 355, 0, 8, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llAgentInExperience", SYM_FUNCTION, LST_INTEGER, 355, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetSubString", SYM_FUNCTION, LST_STRING, 356, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetVehicleRotationParam", SYM_FUNCTION, LST_NULL, 359, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetAgentEnvironment", SYM_FUNCTION, LST_INTEGER, 361, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"DEG_TO_RAD", SYM_VARIABLE, LST_FLOATINGPOINT, 364, 0, 0, {0.017453293f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PU_EVADE_HIDDEN", SYM_VARIABLE, LST_INTEGER, 364, 0, 7, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PARCEL_MEDIA_COMMAND_TEXTURE", SYM_VARIABLE, LST_INTEGER, 364, 0, 4, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"RC_GET_LINK_NUM", SYM_VARIABLE, LST_INTEGER, 364, 0, 4, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PU_FAILURE_OTHER", SYM_VARIABLE, LST_INTEGER, 364, 0, 1000000, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_POSITION", SYM_VARIABLE, LST_INTEGER, 364, 0, 6, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"REGION_FLAG_FIXED_SUN", SYM_VARIABLE, LST_INTEGER, 364, 0, 16, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"dataserver", SYM_EVENT, LST_NULL, 364, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"INVENTORY_NONE", SYM_VARIABLE, LST_INTEGER, 366, 0, -1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llDialog", SYM_FUNCTION, LST_NULL, 366, 4, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"LINKSETDATA_RESET", SYM_VARIABLE, LST_INTEGER, 370, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"touch", SYM_EVENT, LST_NULL, 370, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGiveInventory", SYM_FUNCTION, LST_NULL, 371, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_ROTATION", SYM_VARIABLE, LST_INTEGER, 373, 0, 8, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OPT_WALKABLE", SYM_VARIABLE, LST_INTEGER, 373, 0, 3, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"email", SYM_EVENT, LST_NULL, 373, 5, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_MEDIA_FIRST_CLICK_INTERACT", SYM_VARIABLE, LST_INTEGER, 378, 0, 8, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetRegionSunDirection", SYM_FUNCTION, LST_VECTOR, 378, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_STREAMING_COST", SYM_VARIABLE, LST_INTEGER, 378, 0, 15, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"TEXTURE_BLANK", SYM_VARIABLE, LST_STRING, 378, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, "5748decc-f629-461c-9a36-a35a221fe21f"},
+    {"llTakeCamera", SYM_FUNCTION, LST_NULL, 378, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PSYS_PART_START_SCALE", SYM_VARIABLE, LST_INTEGER, 379, 0, 5, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_NECK", SYM_VARIABLE, LST_INTEGER, 379, 0, 39, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CHANGED_SHAPE", SYM_VARIABLE, LST_INTEGER, 379, 0, 4, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_PHYSICS_SHAPE_PRIM", SYM_VARIABLE, LST_INTEGER, 379, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llRemoteDataReply", SYM_FUNCTION, LST_NULL, 379, 4, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OPT_LEGACY_LINKSET", SYM_VARIABLE, LST_INTEGER, 383, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"LINK_ROOT", SYM_VARIABLE, LST_INTEGER, 383, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PSYS_SRC_PATTERN_ANGLE", SYM_VARIABLE, LST_INTEGER, 383, 0, 4, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llInstantMessage", SYM_FUNCTION, LST_NULL, 383, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"INVENTORY_ALL", SYM_VARIABLE, LST_INTEGER, 385, 0, -1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"STATUS_BLOCK_GRAB", SYM_VARIABLE, LST_INTEGER, 385, 0, 64, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetDate", SYM_FUNCTION, LST_STRING, 385, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CHARACTER_ORIENTATION", SYM_VARIABLE, LST_INTEGER, 385, 0, 4, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_LUARM", SYM_VARIABLE, LST_INTEGER, 385, 0, 20, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PAY_DEFAULT", SYM_VARIABLE, LST_INTEGER, 385, 0, -2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llRotTarget", SYM_FUNCTION, LST_INTEGER, 385, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llNavigateTo", SYM_FUNCTION, LST_NULL, 387, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"VEHICLE_FLAG_LIMIT_MOTOR_UP", SYM_VARIABLE, LST_INTEGER, 389, 0, 64, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_MEDIA_MAX_URL_LENGTH", SYM_VARIABLE, LST_INTEGER, 389, 0, 1024, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"JSON_NULL", SYM_VARIABLE, LST_STRING, 389, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, "﷕"},
+    {"llMakeSmoke", SYM_FUNCTION, LST_NULL, 389, 7, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CHARACTER_ACCOUNT_FOR_SKIPPED_FRAMES", SYM_VARIABLE, LST_INTEGER, 396, 0, 14, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"moving_end", SYM_EVENT, LST_NULL, 396, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_SIT_TARGET", SYM_VARIABLE, LST_INTEGER, 396, 0, 41, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CLICK_ACTION_DISABLED", SYM_VARIABLE, LST_INTEGER, 396, 0, 8, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CAMERA_FOCUS", SYM_VARIABLE, LST_INTEGER, 396, 0, 17, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetObjectAnimationNames", SYM_FUNCTION, LST_LIST, 396, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"URL_REQUEST_DENIED", SYM_VARIABLE, LST_STRING, 396, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, "URL_REQUEST_DENIED"},
+    {"PRIM_HOLE_SQUARE", SYM_VARIABLE, LST_INTEGER, 396, 0, 32, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_AVATAR_CENTER", SYM_VARIABLE, LST_INTEGER, 396, 0, 40, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"SKY_SUN", SYM_VARIABLE, LST_INTEGER, 396, 0, 14, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llClearLinkMedia", SYM_FUNCTION, LST_INTEGER, 396, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_SCALE", SYM_VARIABLE, LST_INTEGER, 398, 0, 47, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_RHIP", SYM_VARIABLE, LST_INTEGER, 398, 0, 22, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llVecNorm", SYM_FUNCTION, LST_VECTOR, 398, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetParcelPrimCount", SYM_FUNCTION, LST_INTEGER, 399, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"IMG_USE_BAKED_LEFTLEG", SYM_VARIABLE, LST_STRING, 402, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, "8e915e25-31d1-cc95-ae08-d58a47488251"},
+    {"ATTACH_LULEG", SYM_VARIABLE, LST_INTEGER, 402, 0, 26, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"XP_ERROR_INVALID_EXPERIENCE", SYM_VARIABLE, LST_INTEGER, 402, 0, 7, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llLinksetDataFindKeys", SYM_FUNCTION, LST_LIST, 402, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llCeil", SYM_FUNCTION, LST_INTEGER, 405, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_HUD_TOP_CENTER", SYM_VARIABLE, LST_INTEGER, 406, 0, 33, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"XP_ERROR_NO_EXPERIENCE", SYM_VARIABLE, LST_INTEGER, 406, 0, 5, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_LLLEG", SYM_VARIABLE, LST_INTEGER, 406, 0, 27, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"XP_ERROR_KEY_NOT_FOUND", SYM_VARIABLE, LST_INTEGER, 406, 0, 14, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"VERTICAL", SYM_VARIABLE, LST_INTEGER, 406, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llStopPointAt", SYM_FUNCTION, LST_NULL, 406, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"VEHICLE_BANKING_TIMESCALE", SYM_VARIABLE, LST_INTEGER, 406, 0, 40, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llDetectedGrab", SYM_FUNCTION, LST_VECTOR, 406, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PARCEL_FLAG_ALLOW_DAMAGE", SYM_VARIABLE, LST_INTEGER, 407, 0, 32, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PAYMENT_INFO_USED", SYM_VARIABLE, LST_INTEGER, 407, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSendRemoteData", SYM_FUNCTION, LST_KEY, 407, 4, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"AGENT_TYPING", SYM_VARIABLE, LST_INTEGER, 411, 0, 512, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PSYS_PART_END_COLOR", SYM_VARIABLE, LST_INTEGER, 411, 0, 3, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"VEHICLE_FLAG_MOUSELOOK_STEER", SYM_VARIABLE, LST_INTEGER, 411, 0, 128, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"HTTP_METHOD", SYM_VARIABLE, LST_INTEGER, 411, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetAnimationOverride", SYM_FUNCTION, LST_STRING, 411, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"DATA_SIM_POS", SYM_VARIABLE, LST_INTEGER, 412, 0, 5, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_SERVER_COST", SYM_VARIABLE, LST_INTEGER, 412, 0, 14, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llUnSit", SYM_FUNCTION, LST_NULL, 412, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llLog10", SYM_FUNCTION, LST_FLOATINGPOINT, 413, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CHANGED_REGION_START", SYM_VARIABLE, LST_INTEGER, 414, 0, 1024, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CAMERA_FOCUS_THRESHOLD", SYM_VARIABLE, LST_INTEGER, 414, 0, 11, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetAttached", SYM_FUNCTION, LST_INTEGER, 414, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetOwner", SYM_FUNCTION, LST_KEY, 414, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PU_SLOWDOWN_DISTANCE_REACHED", SYM_VARIABLE, LST_INTEGER, 414, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_MEDIA_WHITELIST_ENABLE", SYM_VARIABLE, LST_INTEGER, 414, 0, 11, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"REMOTE_DATA_CHANNEL", SYM_VARIABLE, LST_INTEGER, 414, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llListenRemove", SYM_FUNCTION, LST_NULL, 414, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llListStatistics", SYM_FUNCTION, LST_FLOATINGPOINT, 415, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"VEHICLE_LINEAR_DEFLECTION_TIMESCALE", SYM_VARIABLE, LST_INTEGER, 417, 0, 29, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ESTATE_ACCESS_ALLOWED_AGENT_REMOVE", SYM_VARIABLE, LST_INTEGER, 417, 0, 8, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"SKY_SUN_TEXTURE", SYM_VARIABLE, LST_INTEGER, 417, 0, 21, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PERM_COPY", SYM_VARIABLE, LST_INTEGER, 417, 0, 32768, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PSYS_PART_START_COLOR", SYM_VARIABLE, LST_INTEGER, 417, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CHARACTER_MAX_SPEED", SYM_VARIABLE, LST_INTEGER, 417, 0, 13, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetTextureScale", SYM_FUNCTION, LST_VECTOR, 417, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"VEHICLE_ANGULAR_FRICTION_TIMESCALE", SYM_VARIABLE, LST_INTEGER, 418, 0, 17, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"INVENTORY_ANIMATION", SYM_VARIABLE, LST_INTEGER, 418, 0, 20, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_SCULPT_TYPE_MASK", SYM_VARIABLE, LST_INTEGER, 418, 0, 7, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"IMG_USE_BAKED_LEFTARM", SYM_VARIABLE, LST_STRING, 418, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, "ff62763f-d60a-9855-890b-0c96f8f8cd98"},
+    {"llSetTexture", SYM_FUNCTION, LST_NULL, 418, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ERR_MALFORMED_PARAMS", SYM_VARIABLE, LST_INTEGER, 420, 0, -3, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"RC_GET_NORMAL", SYM_VARIABLE, LST_INTEGER, 420, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llFabs", SYM_FUNCTION, LST_FLOATINGPOINT, 420, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_COLOR", SYM_VARIABLE, LST_INTEGER, 421, 0, 18, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"STATUS_ROTATE_Z", SYM_VARIABLE, LST_INTEGER, 421, 0, 8, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"VEHICLE_ANGULAR_MOTOR_TIMESCALE", SYM_VARIABLE, LST_INTEGER, 421, 0, 34, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PARCEL_FLAG_USE_LAND_PASS_LIST", SYM_VARIABLE, LST_INTEGER, 421, 0, 2048, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_LINK_NUMBER", SYM_VARIABLE, LST_INTEGER, 421, 0, 46, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PERMISSION_RELEASE_OWNERSHIP", SYM_VARIABLE, LST_INTEGER, 421, 0, 64, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llRot2Up", SYM_FUNCTION, LST_VECTOR, 421, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_SCULPT_TYPE_PLANE", SYM_VARIABLE, LST_INTEGER, 422, 0, 3, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ESTATE_ACCESS_ALLOWED_GROUP_REMOVE", SYM_VARIABLE, LST_INTEGER, 422, 0, 32, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CHARACTER_MAX_DECEL", SYM_VARIABLE, LST_INTEGER, 422, 0, 9, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetPos", SYM_FUNCTION, LST_VECTOR, 422, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetPrimitiveParams", SYM_FUNCTION, LST_LIST, 422, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llLinksetDataDeleteProtected", SYM_FUNCTION, LST_INTEGER, 423, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetDisplayName", SYM_FUNCTION, LST_STRING, 425, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetMinScaleFactor", SYM_FUNCTION, LST_FLOATINGPOINT, 426, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CAMERA_FOCUS_LOCKED", SYM_VARIABLE, LST_INTEGER, 426, 0, 22, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetVel", SYM_FUNCTION, LST_VECTOR, 426, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"REVERSE", SYM_VARIABLE, LST_INTEGER, 426, 0, 4, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PARCEL_DETAILS_TP_ROUTING", SYM_VARIABLE, LST_INTEGER, 426, 0, 11, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_MATERIAL_GLASS", SYM_VARIABLE, LST_INTEGER, 426, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"JSON_TRUE", SYM_VARIABLE, LST_STRING, 426, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, "﷖"},
+    {"PRIM_PHYSICS", SYM_VARIABLE, LST_INTEGER, 426, 0, 3, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CONTROL_ML_LBUTTON", SYM_VARIABLE, LST_INTEGER, 426, 0, 1073741824, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PARCEL_COUNT_SELECTED", SYM_VARIABLE, LST_INTEGER, 426, 0, 4, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llResetLandBanList", SYM_FUNCTION, LST_NULL, 426, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_REZ_TIME", SYM_VARIABLE, LST_INTEGER, 426, 0, 45, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PARCEL_DETAILS_PRIM_CAPACITY", SYM_VARIABLE, LST_INTEGER, 426, 0, 7, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PSYS_SRC_ACCEL", SYM_VARIABLE, LST_INTEGER, 426, 0, 8, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PSYS_SRC_BURST_SPEED_MAX", SYM_VARIABLE, LST_INTEGER, 426, 0, 18, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PSYS_SRC_ANGLE_END", SYM_VARIABLE, LST_INTEGER, 426, 0, 23, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ACTIVE", SYM_VARIABLE, LST_INTEGER, 426, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_MATERIAL_WOOD", SYM_VARIABLE, LST_INTEGER, 426, 0, 3, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llModifyLand", SYM_FUNCTION, LST_NULL, 426, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetRegionDayLength", SYM_FUNCTION, LST_INTEGER, 428, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_TAIL_TIP", SYM_VARIABLE, LST_INTEGER, 428, 0, 44, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetRot", SYM_FUNCTION, LST_NULL, 428, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_RETURN_PARCEL_OWNER", SYM_VARIABLE, LST_INTEGER, 429, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_BUMP_DISKS", SYM_VARIABLE, LST_INTEGER, 429, 0, 10, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_GROIN", SYM_VARIABLE, LST_INTEGER, 429, 0, 53, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetObjectLinkKey", SYM_FUNCTION, LST_KEY, 429, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"VEHICLE_TYPE_NONE", SYM_VARIABLE, LST_INTEGER, 431, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_TYPE_TUBE", SYM_VARIABLE, LST_INTEGER, 431, 0, 5, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llChar", SYM_FUNCTION, LST_STRING, 431, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"TRAVERSAL_TYPE_NONE", SYM_VARIABLE, LST_INTEGER, 432, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llList2Vector", SYM_FUNCTION, LST_VECTOR, 432, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_BUMP_GRAVEL", SYM_VARIABLE, LST_INTEGER, 434, 0, 11, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"TP_ROUTING_LANDINGP", SYM_VARIABLE, LST_INTEGER, 434, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PSYS_SRC_TEXTURE", SYM_VARIABLE, LST_INTEGER, 434, 0, 12, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetAlpha", SYM_FUNCTION, LST_FLOATINGPOINT, 434, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PU_FAILURE_INVALID_START", SYM_VARIABLE, LST_INTEGER, 435, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PSYS_PART_BLEND_FUNC_SOURCE", SYM_VARIABLE, LST_INTEGER, 435, 0, 24, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_MEDIA_PERM_ANYONE", SYM_VARIABLE, LST_INTEGER, 435, 0, 4, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llTargetOmega", SYM_FUNCTION, LST_NULL, 435, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llList2ListStrided", SYM_FUNCTION, LST_LIST, 438, 4, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llReleaseControls", SYM_FUNCTION, LST_NULL, 442, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSound", SYM_FUNCTION, LST_NULL, 442, 4, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"SCALE", SYM_VARIABLE, LST_INTEGER, 446, 0, 64, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"HTTP_EXTENDED_ERROR", SYM_VARIABLE, LST_INTEGER, 446, 0, 9, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"at_rot_target", SYM_EVENT, LST_NULL, 446, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"VEHICLE_FLAG_CAMERA_DECOUPLED", SYM_VARIABLE, LST_INTEGER, 449, 0, 512, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_HUD_CENTER_2", SYM_VARIABLE, LST_INTEGER, 449, 0, 31, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"state_exit", SYM_EVENT, LST_NULL, 449, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"VEHICLE_HOVER_EFFICIENCY", SYM_VARIABLE, LST_INTEGER, 449, 0, 25, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PSYS_PART_WIND_MASK", SYM_VARIABLE, LST_INTEGER, 449, 0, 8, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"SIT_NO_ACCESS", SYM_VARIABLE, LST_INTEGER, 449, 0, -6, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"AVOID_NONE", SYM_VARIABLE, LST_INTEGER, 449, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"INVENTORY_SETTING", SYM_VARIABLE, LST_INTEGER, 449, 0, 56, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_MEDIA_CURRENT_URL", SYM_VARIABLE, LST_INTEGER, 449, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CHANGED_REGION", SYM_VARIABLE, LST_INTEGER, 449, 0, 256, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CLICK_ACTION_ZOOM", SYM_VARIABLE, LST_INTEGER, 449, 0, 7, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llVolumeDetect", SYM_FUNCTION, LST_NULL, 449, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llRotBetween", SYM_FUNCTION, LST_QUATERNION, 450, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llLinksetDataWrite", SYM_FUNCTION, LST_INTEGER, 452, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CHANGED_TEXTURE", SYM_VARIABLE, LST_INTEGER, 454, 0, 16, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"AGENT_BY_USERNAME", SYM_VARIABLE, LST_INTEGER, 454, 0, 16, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetVehicleType", SYM_FUNCTION, LST_NULL, 454, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llPassTouches", SYM_FUNCTION, LST_NULL, 455, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llRot2Euler", SYM_FUNCTION, LST_VECTOR, 456, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"STATUS_NOT_SUPPORTED", SYM_VARIABLE, LST_INTEGER, 457, 0, 1004, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetRootPosition", SYM_FUNCTION, LST_VECTOR, 457, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_FACE_LEYE", SYM_VARIABLE, LST_INTEGER, 457, 0, 50, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"XP_ERROR_REQUEST_PERM_TIMEOUT", SYM_VARIABLE, LST_INTEGER, 457, 0, 18, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"VEHICLE_HOVER_HEIGHT", SYM_VARIABLE, LST_INTEGER, 457, 0, 24, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llRequestAgentData", SYM_FUNCTION, LST_KEY, 457, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llLookAt", SYM_FUNCTION, LST_NULL, 459, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PARCEL_FLAG_ALLOW_FLY", SYM_VARIABLE, LST_INTEGER, 462, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetParcelMusicURL", SYM_FUNCTION, LST_NULL, 462, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"IMG_USE_BAKED_HEAD", SYM_VARIABLE, LST_STRING, 463, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, "5a9f4a74-30f2-821c-b88d-70499d3e7183"},
+    {"EOF", SYM_VARIABLE, LST_STRING, 463, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, "\n\n\n"},
+    {"XP_ERROR_NOT_PERMITTED_LAND", SYM_VARIABLE, LST_INTEGER, 463, 0, 17, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llMakeFountain", SYM_FUNCTION, LST_NULL, 463, 9, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"collision_end", SYM_EVENT, LST_NULL, 472, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetScale", SYM_FUNCTION, LST_NULL, 473, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llEuler2Rot", SYM_FUNCTION, LST_QUATERNION, 474, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_TYPE_SPHERE", SYM_VARIABLE, LST_INTEGER, 475, 0, 3, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llOrd", SYM_FUNCTION, LST_INTEGER, 475, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_HUD_CENTER_1", SYM_VARIABLE, LST_INTEGER, 477, 0, 35, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"KFM_FORWARD", SYM_VARIABLE, LST_INTEGER, 477, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llTakeControls", SYM_FUNCTION, LST_NULL, 477, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llBreakLink", SYM_FUNCTION, LST_NULL, 480, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"VEHICLE_VERTICAL_ATTRACTION_EFFICIENCY", SYM_VARIABLE, LST_INTEGER, 481, 0, 36, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"at_target", SYM_EVENT, LST_NULL, 481, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ROTATE", SYM_VARIABLE, LST_INTEGER, 484, 0, 32, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CHARACTER_TYPE_C", SYM_VARIABLE, LST_INTEGER, 484, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PSYS_PART_BF_ZERO", SYM_VARIABLE, LST_INTEGER, 484, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_LINK_TARGET", SYM_VARIABLE, LST_INTEGER, 484, 0, 34, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CHARACTER_MAX_ACCEL", SYM_VARIABLE, LST_INTEGER, 484, 0, 8, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CONTENT_TYPE_JSON", SYM_VARIABLE, LST_INTEGER, 484, 0, 5, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llDetectedTouchPos", SYM_FUNCTION, LST_VECTOR, 484, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llListFindList", SYM_FUNCTION, LST_INTEGER, 485, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_MATERIAL_PLASTIC", SYM_VARIABLE, LST_INTEGER, 487, 0, 5, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"IMG_USE_BAKED_LOWER", SYM_VARIABLE, LST_STRING, 487, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, "24daea5f-0539-cfcf-047f-fbc40b2786ba"},
+    {"llDetectedTouchST", SYM_FUNCTION, LST_VECTOR, 487, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llEjectFromLand", SYM_FUNCTION, LST_NULL, 488, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PERM_TRANSFER", SYM_VARIABLE, LST_INTEGER, 489, 0, 8192, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetRegionSunRotation", SYM_FUNCTION, LST_QUATERNION, 489, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"not_at_rot_target", SYM_EVENT, LST_NULL, 489, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_SIT_COUNT", SYM_VARIABLE, LST_INTEGER, 489, 0, 38, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llsRGB2Linear", SYM_FUNCTION, LST_VECTOR, 489, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_PHANTOM", SYM_VARIABLE, LST_INTEGER, 490, 0, 22, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetPhysicsMaterial", SYM_FUNCTION, LST_LIST, 490, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_MATERIAL_STONE", SYM_VARIABLE, LST_INTEGER, 490, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetMoonRotation", SYM_FUNCTION, LST_QUATERNION, 490, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llToUpper", SYM_FUNCTION, LST_STRING, 490, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"LIST_STAT_STD_DEV", SYM_VARIABLE, LST_INTEGER, 491, 0, 5, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llPreloadSound", SYM_FUNCTION, LST_NULL, 491, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"STATUS_TYPE_MISMATCH", SYM_VARIABLE, LST_INTEGER, 492, 0, 1001, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_SHINY_HIGH", SYM_VARIABLE, LST_INTEGER, 492, 0, 3, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"AGENT_ON_OBJECT", SYM_VARIABLE, LST_INTEGER, 492, 0, 32, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_TAIL_BASE", SYM_VARIABLE, LST_INTEGER, 492, 0, 43, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PARCEL_DETAILS_OWNER", SYM_VARIABLE, LST_INTEGER, 492, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llRefreshPrimURL", SYM_FUNCTION, LST_NULL, 492, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"run_time_permissions", SYM_EVENT, LST_NULL, 492, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_BUMP_CONCRETE", SYM_VARIABLE, LST_INTEGER, 493, 0, 7, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetColor", SYM_FUNCTION, LST_NULL, 493, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PSYS_SRC_PATTERN_EXPLODE", SYM_VARIABLE, LST_INTEGER, 495, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PERMISSION_CHANGE_LINKS", SYM_VARIABLE, LST_INTEGER, 495, 0, 128, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"WATER_FOG", SYM_VARIABLE, LST_INTEGER, 495, 0, 101, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llAtan2", SYM_FUNCTION, LST_FLOATINGPOINT, 495, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CAMERA_POSITION_THRESHOLD", SYM_VARIABLE, LST_INTEGER, 497, 0, 10, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llLoopSoundMaster", SYM_FUNCTION, LST_NULL, 497, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetExperienceDetails", SYM_FUNCTION, LST_LIST, 499, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PERMISSION_DEBIT", SYM_VARIABLE, LST_INTEGER, 500, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llWind", SYM_FUNCTION, LST_VECTOR, 500, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_SCULPT_TYPE_TORUS", SYM_VARIABLE, LST_INTEGER, 501, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetCameraPos", SYM_FUNCTION, LST_VECTOR, 501, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"AGENT", SYM_VARIABLE, LST_INTEGER, 501, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llResetScript", SYM_FUNCTION, LST_NULL, 501, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PU_FAILURE_NO_NAVMESH", SYM_VARIABLE, LST_INTEGER, 501, 0, 9, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetInventoryAcquireTime", SYM_FUNCTION, LST_STRING, 501, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PARCEL_FLAG_ALLOW_CREATE_GROUP_OBJECTS", SYM_VARIABLE, LST_INTEGER, 502, 0, 67108864, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llOffsetTexture", SYM_FUNCTION, LST_NULL, 502, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetGMTclock", SYM_FUNCTION, LST_FLOATINGPOINT, 505, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llVecDist", SYM_FUNCTION, LST_FLOATINGPOINT, 505, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSleep", SYM_FUNCTION, LST_NULL, 507, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PARCEL_MEDIA_COMMAND_PLAY", SYM_VARIABLE, LST_INTEGER, 508, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetSunDirection", SYM_FUNCTION, LST_VECTOR, 508, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PERMISSION_CHANGE_PERMISSIONS", SYM_VARIABLE, LST_INTEGER, 508, 0, 512, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llLoadURL", SYM_FUNCTION, LST_NULL, 508, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"IMG_USE_BAKED_UPPER", SYM_VARIABLE, LST_STRING, 511, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, "ae2de45c-d252-50b8-5c6e-19f39ce79317"},
+    {"STATUS_DIE_AT_NO_ENTRY", SYM_VARIABLE, LST_INTEGER, 511, 0, 2048, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"WATER_NORMAL_TEXTURE", SYM_VARIABLE, LST_INTEGER, 511, 0, 107, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_LSHOULDER", SYM_VARIABLE, LST_INTEGER, 511, 0, 3, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"RC_REJECT_PHYSICAL", SYM_VARIABLE, LST_INTEGER, 511, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"STATUS_INTERNAL_ERROR", SYM_VARIABLE, LST_INTEGER, 511, 0, 1999, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_MATERIAL", SYM_VARIABLE, LST_INTEGER, 511, 0, 42, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PSYS_PART_BF_ONE_MINUS_SOURCE_ALPHA", SYM_VARIABLE, LST_INTEGER, 511, 0, 9, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"linkset_data", SYM_EVENT, LST_NULL, 511, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PSYS_PART_MAX_AGE", SYM_VARIABLE, LST_INTEGER, 514, 0, 7, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llCreateKeyValue", SYM_FUNCTION, LST_KEY, 514, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llStopSound", SYM_FUNCTION, LST_NULL, 516, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"AGENT_SCRIPTED", SYM_VARIABLE, LST_INTEGER, 516, 0, 4, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PERMISSION_ATTACH", SYM_VARIABLE, LST_INTEGER, 516, 0, 32, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llCloud", SYM_FUNCTION, LST_FLOATINGPOINT, 516, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"SKY_LIGHT", SYM_VARIABLE, LST_INTEGER, 517, 0, 8, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetObjectDetails", SYM_FUNCTION, LST_LIST, 517, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetTextureAnim", SYM_FUNCTION, LST_NULL, 519, 7, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llLinksetDataRead", SYM_FUNCTION, LST_STRING, 526, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_TEMP_ATTACHED", SYM_VARIABLE, LST_INTEGER, 527, 0, 34, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llReturnObjectsByOwner", SYM_FUNCTION, LST_INTEGER, 527, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"VEHICLE_BANKING_EFFICIENCY", SYM_VARIABLE, LST_INTEGER, 529, 0, 38, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGroundSlope", SYM_FUNCTION, LST_VECTOR, 529, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetVehicleFlags", SYM_FUNCTION, LST_NULL, 530, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PSYS_SRC_PATTERN_ANGLE_CONE", SYM_VARIABLE, LST_INTEGER, 531, 0, 8, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetMassMKS", SYM_FUNCTION, LST_FLOATINGPOINT, 531, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_LHIP", SYM_VARIABLE, LST_INTEGER, 531, 0, 25, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"DENSITY", SYM_VARIABLE, LST_INTEGER, 531, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"GRAVITY_MULTIPLIER", SYM_VARIABLE, LST_INTEGER, 531, 0, 8, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ENV_NO_EXPERIENCE_LAND", SYM_VARIABLE, LST_INTEGER, 531, 0, -7, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CONTROL_UP", SYM_VARIABLE, LST_INTEGER, 531, 0, 16, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetDamage", SYM_FUNCTION, LST_NULL, 531, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llRezAtRoot", SYM_FUNCTION, LST_NULL, 532, 5, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llJsonGetValue", SYM_FUNCTION, LST_STRING, 537, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetSPMaxMemory", SYM_FUNCTION, LST_INTEGER, 539, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetNumberOfNotecardLines", SYM_FUNCTION, LST_KEY, 539, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetScriptName", SYM_FUNCTION, LST_STRING, 540, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"VEHICLE_FLAG_HOVER_TERRAIN_ONLY", SYM_VARIABLE, LST_INTEGER, 540, 0, 8, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"VEHICLE_HOVER_TIMESCALE", SYM_VARIABLE, LST_INTEGER, 540, 0, 26, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llRotateTexture", SYM_FUNCTION, LST_NULL, 540, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PERM_MOVE", SYM_VARIABLE, LST_INTEGER, 542, 0, 524288, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PSYS_PART_TARGET_LINEAR_MASK", SYM_VARIABLE, LST_INTEGER, 542, 0, 128, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetCreator", SYM_FUNCTION, LST_KEY, 542, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llStartObjectAnimation", SYM_FUNCTION, LST_NULL, 542, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ESTATE_ACCESS_BANNED_AGENT_REMOVE", SYM_VARIABLE, LST_INTEGER, 543, 0, 128, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llFleeFrom", SYM_FUNCTION, LST_NULL, 543, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_BUMP_STONE", SYM_VARIABLE, LST_INTEGER, 546, 0, 9, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_ANIMATED_COUNT", SYM_VARIABLE, LST_INTEGER, 546, 0, 39, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llCollisionSound", SYM_FUNCTION, LST_NULL, 546, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_REAR", SYM_VARIABLE, LST_INTEGER, 548, 0, 14, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llLinear2sRGB", SYM_FUNCTION, LST_VECTOR, 548, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetLinkTextureAnim", SYM_FUNCTION, LST_NULL, 549, 8, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ENV_INVALID_RULE", SYM_VARIABLE, LST_INTEGER, 557, 0, -5, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llResetLandPassList", SYM_FUNCTION, LST_NULL, 557, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"IMG_USE_BAKED_SKIRT", SYM_VARIABLE, LST_STRING, 557, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, "43529ce8-7faa-ad92-165a-bc4078371687"},
+    {"llName2Key", SYM_FUNCTION, LST_KEY, 557, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"REGION_FLAG_BLOCK_FLY", SYM_VARIABLE, LST_INTEGER, 558, 0, 524288, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_BUMP_WEAVE", SYM_VARIABLE, LST_INTEGER, 558, 0, 17, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetDayLength", SYM_FUNCTION, LST_INTEGER, 558, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PROFILE_NONE", SYM_VARIABLE, LST_INTEGER, 558, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetCameraParams", SYM_FUNCTION, LST_NULL, 558, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PSYS_PART_INTERP_COLOR_MASK", SYM_VARIABLE, LST_INTEGER, 559, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetPrimMediaParams", SYM_FUNCTION, LST_LIST, 559, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"JSON_DELETE", SYM_VARIABLE, LST_STRING, 561, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, "﷘"},
+    {"llClearCameraParams", SYM_FUNCTION, LST_NULL, 561, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetRootRotation", SYM_FUNCTION, LST_QUATERNION, 561, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"VEHICLE_REFERENCE_FRAME", SYM_VARIABLE, LST_INTEGER, 561, 0, 44, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"STATUS_OK", SYM_VARIABLE, LST_INTEGER, 561, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"LIST_STAT_MEAN", SYM_VARIABLE, LST_INTEGER, 561, 0, 3, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PU_GOAL_REACHED", SYM_VARIABLE, LST_INTEGER, 561, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_BUMP_BRICKS", SYM_VARIABLE, LST_INTEGER, 561, 0, 5, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_RUARM", SYM_VARIABLE, LST_INTEGER, 561, 0, 18, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llResetTime", SYM_FUNCTION, LST_NULL, 561, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"STATUS_PHANTOM", SYM_VARIABLE, LST_INTEGER, 561, 0, 16, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"INVENTORY_NOTECARD", SYM_VARIABLE, LST_INTEGER, 561, 0, 7, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llStartAnimation", SYM_FUNCTION, LST_NULL, 561, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_ACCOUNT_LEVEL", SYM_VARIABLE, LST_INTEGER, 562, 0, 41, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_CHEST", SYM_VARIABLE, LST_INTEGER, 562, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PU_FAILURE_NO_VALID_DESTINATION", SYM_VARIABLE, LST_INTEGER, 562, 0, 6, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PSYS_PART_FOLLOW_SRC_MASK", SYM_VARIABLE, LST_INTEGER, 562, 0, 16, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"TEXTURE_DEFAULT", SYM_VARIABLE, LST_STRING, 562, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, "89556747-24cb-43ed-920b-47caed15465f"},
+    {"MASK_EVERYONE", SYM_VARIABLE, LST_INTEGER, 562, 0, 3, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetObjectPermMask", SYM_FUNCTION, LST_INTEGER, 562, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"REGION_FLAG_ALLOW_DIRECT_TELEPORT", SYM_VARIABLE, LST_INTEGER, 563, 0, 1048576, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_GROUP_TAG", SYM_VARIABLE, LST_INTEGER, 563, 0, 33, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"changed", SYM_EVENT, LST_NULL, 563, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PARCEL_FLAG_ALLOW_GROUP_OBJECT_ENTRY", SYM_VARIABLE, LST_INTEGER, 564, 0, 268435456, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_SELECT_COUNT", SYM_VARIABLE, LST_INTEGER, 564, 0, 37, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"land_collision_end", SYM_EVENT, LST_NULL, 564, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_HOLE_DEFAULT", SYM_VARIABLE, LST_INTEGER, 565, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llRegionSay", SYM_FUNCTION, LST_NULL, 565, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"REGION_FLAG_ALLOW_DAMAGE", SYM_VARIABLE, LST_INTEGER, 567, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_LAST_OWNER_ID", SYM_VARIABLE, LST_INTEGER, 567, 0, 27, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetScale", SYM_FUNCTION, LST_VECTOR, 567, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_TEXT_ALPHA", SYM_VARIABLE, LST_INTEGER, 567, 0, 49, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llXorBase64", SYM_FUNCTION, LST_STRING, 567, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_FACE_JAW", SYM_VARIABLE, LST_INTEGER, 569, 0, 47, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"TP_ROUTING_FREE", SYM_VARIABLE, LST_INTEGER, 569, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"SKY_STAR_BRIGHTNESS", SYM_VARIABLE, LST_INTEGER, 569, 0, 13, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CHARACTER_TYPE_D", SYM_VARIABLE, LST_INTEGER, 569, 0, 3, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llAngleBetween", SYM_FUNCTION, LST_FLOATINGPOINT, 569, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llTan", SYM_FUNCTION, LST_FLOATINGPOINT, 571, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"HTTP_VERBOSE_THROTTLE", SYM_VARIABLE, LST_INTEGER, 572, 0, 4, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llInsertString", SYM_FUNCTION, LST_STRING, 572, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llAbs", SYM_FUNCTION, LST_INTEGER, 575, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"XP_ERROR_RETRY_UPDATE", SYM_VARIABLE, LST_INTEGER, 576, 0, 15, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_ALPHA_MODE_EMISSIVE", SYM_VARIABLE, LST_INTEGER, 576, 0, 3, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llDetectedGroup", SYM_FUNCTION, LST_INTEGER, 576, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"KFM_DATA", SYM_VARIABLE, LST_INTEGER, 577, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llAxisAngle2Rot", SYM_FUNCTION, LST_QUATERNION, 577, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"INVENTORY_SCRIPT", SYM_VARIABLE, LST_INTEGER, 579, 0, 10, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_CREATOR", SYM_VARIABLE, LST_INTEGER, 579, 0, 8, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"SKY_BLUE", SYM_VARIABLE, LST_INTEGER, 579, 0, 22, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llListen", SYM_FUNCTION, LST_INTEGER, 579, 4, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llPointAt", SYM_FUNCTION, LST_NULL, 583, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"TRAVERSAL_TYPE", SYM_VARIABLE, LST_INTEGER, 584, 0, 7, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"VEHICLE_TYPE_BALLOON", SYM_VARIABLE, LST_INTEGER, 584, 0, 5, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_ROT", SYM_VARIABLE, LST_INTEGER, 584, 0, 4, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CAMERA_PITCH", SYM_VARIABLE, LST_INTEGER, 584, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llUpdateCharacter", SYM_FUNCTION, LST_NULL, 584, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llKeysKeyValue", SYM_FUNCTION, LST_KEY, 585, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetRegionMoonRotation", SYM_FUNCTION, LST_QUATERNION, 587, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetMass", SYM_FUNCTION, LST_FLOATINGPOINT, 587, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_ALPHA_MODE_NONE", SYM_VARIABLE, LST_INTEGER, 587, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"LINK_THIS", SYM_VARIABLE, LST_INTEGER, 587, 0, -4, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_MEDIA_MAX_WIDTH_PIXELS", SYM_VARIABLE, LST_INTEGER, 587, 0, 2048, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetInventoryNumber", SYM_FUNCTION, LST_INTEGER, 587, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_CLICK_ACTION", SYM_VARIABLE, LST_INTEGER, 588, 0, 28, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CHARACTER_TYPE_NONE", SYM_VARIABLE, LST_INTEGER, 588, 0, 4, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llRemoteDataSetRegion", SYM_FUNCTION, LST_NULL, 588, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llOpenFloater", SYM_FUNCTION, LST_INTEGER, 588, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"XP_ERROR_THROTTLED", SYM_VARIABLE, LST_INTEGER, 591, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"JSON_APPEND", SYM_VARIABLE, LST_INTEGER, 591, 0, -1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetLocalPos", SYM_FUNCTION, LST_VECTOR, 591, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetPermissionsKey", SYM_FUNCTION, LST_KEY, 591, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llStopAnimation", SYM_FUNCTION, LST_NULL, 591, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"LIST_STAT_GEOMETRIC_MEAN", SYM_VARIABLE, LST_INTEGER, 592, 0, 9, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PSYS_SRC_BURST_SPEED_MIN", SYM_VARIABLE, LST_INTEGER, 592, 0, 17, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetExperienceErrorMessage", SYM_FUNCTION, LST_STRING, 592, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"WATER_FRESNEL", SYM_VARIABLE, LST_INTEGER, 593, 0, 102, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"MASK_NEXT", SYM_VARIABLE, LST_INTEGER, 593, 0, 4, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llTeleportAgentHome", SYM_FUNCTION, LST_NULL, 593, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CHARACTER_TYPE", SYM_VARIABLE, LST_INTEGER, 594, 0, 6, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"SKY_ABSORPTION_CONFIG", SYM_VARIABLE, LST_INTEGER, 594, 0, 16, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetCenterOfMass", SYM_FUNCTION, LST_VECTOR, 594, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"RCERR_UNKNOWN", SYM_VARIABLE, LST_INTEGER, 594, 0, -1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"AGENT_ATTACHMENTS", SYM_VARIABLE, LST_INTEGER, 594, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetMaxScaleFactor", SYM_FUNCTION, LST_FLOATINGPOINT, 594, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"VEHICLE_ANGULAR_MOTOR_DIRECTION", SYM_VARIABLE, LST_INTEGER, 594, 0, 19, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_TYPE_TORUS", SYM_VARIABLE, LST_INTEGER, 594, 0, 4, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetAgentLanguage", SYM_FUNCTION, LST_STRING, 594, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"RC_MAX_HITS", SYM_VARIABLE, LST_INTEGER, 595, 0, 3, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"STATUS_PHYSICS", SYM_VARIABLE, LST_INTEGER, 595, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llTargetedEmail", SYM_FUNCTION, LST_NULL, 595, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"TYPE_ROTATION", SYM_VARIABLE, LST_INTEGER, 598, 0, 6, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"XP_ERROR_EXPERIENCE_DISABLED", SYM_VARIABLE, LST_INTEGER, 598, 0, 8, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PSYS_PART_BF_ONE_MINUS_DEST_COLOR", SYM_VARIABLE, LST_INTEGER, 598, 0, 4, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_PHANTOM", SYM_VARIABLE, LST_INTEGER, 598, 0, 5, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"RC_REJECT_LAND", SYM_VARIABLE, LST_INTEGER, 598, 0, 8, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llParseStringKeepNulls", SYM_FUNCTION, LST_LIST, 598, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CHARACTER_DESIRED_SPEED", SYM_VARIABLE, LST_INTEGER, 601, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_PELVIS", SYM_VARIABLE, LST_INTEGER, 601, 0, 10, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"JSON_STRING", SYM_VARIABLE, LST_STRING, 601, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, "﷔"},
+    {"PRIM_MEDIA_CONTROLS", SYM_VARIABLE, LST_INTEGER, 601, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PSYS_PART_BF_ONE_MINUS_SOURCE_COLOR", SYM_VARIABLE, LST_INTEGER, 601, 0, 5, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_MEDIA_PERM_OWNER", SYM_VARIABLE, LST_INTEGER, 601, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llRemoveFromLandPassList", SYM_FUNCTION, LST_NULL, 601, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"VEHICLE_FLAG_NO_FLY_UP", SYM_VARIABLE, LST_INTEGER, 602, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_RHAND_RING1", SYM_VARIABLE, LST_INTEGER, 602, 0, 42, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llMessageLinked", SYM_FUNCTION, LST_NULL, 602, 4, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"TEXTURE_TRANSPARENT", SYM_VARIABLE, LST_STRING, 606, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, "8dcd4a48-2d37-4909-9f78-f7a9eb4ef903"},
+    {"llPow", SYM_FUNCTION, LST_FLOATINGPOINT, 606, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llShout", SYM_FUNCTION, LST_NULL, 608, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CLICK_ACTION_OPEN_MEDIA", SYM_VARIABLE, LST_INTEGER, 610, 0, 6, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_GLOW", SYM_VARIABLE, LST_INTEGER, 610, 0, 25, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"IMG_USE_BAKED_AUX1", SYM_VARIABLE, LST_STRING, 610, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, "9742065b-19b5-297c-858a-29711d539043"},
+    {"SKY_DENSITY_PROFILE_COUNTS", SYM_VARIABLE, LST_INTEGER, 610, 0, 3, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llCreateCharacter", SYM_FUNCTION, LST_NULL, 610, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llCreateLink", SYM_FUNCTION, LST_NULL, 611, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"MASK_OWNER", SYM_VARIABLE, LST_INTEGER, 613, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PARCEL_DETAILS_SEE_AVATARS", SYM_VARIABLE, LST_INTEGER, 613, 0, 6, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetRegionDayOffset", SYM_FUNCTION, LST_INTEGER, 613, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CHARACTER_CMD_SMOOTH_STOP", SYM_VARIABLE, LST_INTEGER, 613, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"SKY_CLOUDS", SYM_VARIABLE, LST_INTEGER, 613, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"VEHICLE_LINEAR_MOTOR_OFFSET", SYM_VARIABLE, LST_INTEGER, 613, 0, 20, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_TEXGEN", SYM_VARIABLE, LST_INTEGER, 613, 0, 22, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llStopHover", SYM_FUNCTION, LST_NULL, 613, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGiveMoney", SYM_FUNCTION, LST_INTEGER, 613, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llXorBase64StringsCorrect", SYM_FUNCTION, LST_STRING, 615, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"WATER_REFRACTION", SYM_VARIABLE, LST_INTEGER, 617, 0, 105, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CONTENT_TYPE_FORM", SYM_VARIABLE, LST_INTEGER, 617, 0, 7, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGroundRepel", SYM_FUNCTION, LST_NULL, 617, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_PRIM_COUNT", SYM_VARIABLE, LST_INTEGER, 620, 0, 30, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PERMISSION_CHANGE_JOINTS", SYM_VARIABLE, LST_INTEGER, 620, 0, 256, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llEvade", SYM_FUNCTION, LST_NULL, 620, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CONTENT_TYPE_RSS", SYM_VARIABLE, LST_INTEGER, 622, 0, 8, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetForceAndTorque", SYM_FUNCTION, LST_NULL, 622, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PARCEL_DETAILS_LANDING_POINT", SYM_VARIABLE, LST_INTEGER, 625, 0, 9, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetWallclock", SYM_FUNCTION, LST_FLOATINGPOINT, 625, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_BUMP_SIDING", SYM_VARIABLE, LST_INTEGER, 625, 0, 13, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetTouchText", SYM_FUNCTION, LST_NULL, 625, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PASS_ALWAYS", SYM_VARIABLE, LST_INTEGER, 626, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"SIT_NO_EXPERIENCE_PERMISSION", SYM_VARIABLE, LST_INTEGER, 626, 0, -2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetLinkTexture", SYM_FUNCTION, LST_NULL, 626, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llRequestInventoryData", SYM_FUNCTION, LST_KEY, 629, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CHANGED_COLOR", SYM_VARIABLE, LST_INTEGER, 630, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_FACE_REYE", SYM_VARIABLE, LST_INTEGER, 630, 0, 51, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetInventoryCreator", SYM_FUNCTION, LST_KEY, 630, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"control", SYM_EVENT, LST_NULL, 631, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_LHAND", SYM_VARIABLE, LST_INTEGER, 634, 0, 5, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSitTarget", SYM_FUNCTION, LST_NULL, 634, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"TRUE", SYM_VARIABLE, LST_INTEGER, 636, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"DATA_PAYINFO", SYM_VARIABLE, LST_INTEGER, 636, 0, 8, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetForce", SYM_FUNCTION, LST_VECTOR, 636, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"TYPE_STRING", SYM_VARIABLE, LST_INTEGER, 636, 0, 3, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llStopLookAt", SYM_FUNCTION, LST_NULL, 636, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llReplaceAgentEnvironment", SYM_FUNCTION, LST_INTEGER, 636, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llFloor", SYM_FUNCTION, LST_INTEGER, 639, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_CHARACTER_TIME", SYM_VARIABLE, LST_INTEGER, 640, 0, 17, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"XP_ERROR_STORAGE_EXCEPTION", SYM_VARIABLE, LST_INTEGER, 640, 0, 13, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llRot2Fwd", SYM_FUNCTION, LST_VECTOR, 640, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetVelocity", SYM_FUNCTION, LST_NULL, 641, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PSYS_PART_BOUNCE_MASK", SYM_VARIABLE, LST_INTEGER, 643, 0, 4, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetTorque", SYM_FUNCTION, LST_VECTOR, 643, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PARCEL_COUNT_TEMP", SYM_VARIABLE, LST_INTEGER, 643, 0, 5, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llTeleportAgent", SYM_FUNCTION, LST_NULL, 643, 4, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"AGENT_BUSY", SYM_VARIABLE, LST_INTEGER, 647, 0, 2048, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"LAND_RAISE", SYM_VARIABLE, LST_INTEGER, 647, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"TARGETED_EMAIL_OBJECT_OWNER", SYM_VARIABLE, LST_INTEGER, 647, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CLICK_ACTION_SIT", SYM_VARIABLE, LST_INTEGER, 647, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llAddToLandBanList", SYM_FUNCTION, LST_NULL, 647, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PERMISSION_SILENT_ESTATE_MANAGEMENT", SYM_VARIABLE, LST_INTEGER, 649, 0, 16384, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"URL_REQUEST_GRANTED", SYM_VARIABLE, LST_STRING, 649, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, "URL_REQUEST_GRANTED"},
+    {"PRIM_PHYSICS_SHAPE_NONE", SYM_VARIABLE, LST_INTEGER, 649, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"KFM_LOOP", SYM_VARIABLE, LST_INTEGER, 649, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llAttachToAvatar", SYM_FUNCTION, LST_NULL, 649, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llTriggerSoundLimited", SYM_FUNCTION, LST_NULL, 650, 4, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetTextureRot", SYM_FUNCTION, LST_FLOATINGPOINT, 654, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llScriptProfiler", SYM_FUNCTION, LST_NULL, 655, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llDeleteCharacter", SYM_FUNCTION, LST_NULL, 656, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"SKY_REFRACTION", SYM_VARIABLE, LST_INTEGER, 656, 0, 11, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"VEHICLE_ANGULAR_MOTOR_DECAY_TIMESCALE", SYM_VARIABLE, LST_INTEGER, 656, 0, 35, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PARCEL_FLAG_ALLOW_GROUP_SCRIPTS", SYM_VARIABLE, LST_INTEGER, 656, 0, 33554432, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_MEDIA_WIDTH_PIXELS", SYM_VARIABLE, LST_INTEGER, 656, 0, 9, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_OMEGA", SYM_VARIABLE, LST_INTEGER, 656, 0, 32, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetRegionAgentCount", SYM_FUNCTION, LST_INTEGER, 656, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_TEXTURE", SYM_VARIABLE, LST_INTEGER, 656, 0, 17, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CHARACTER_STAY_WITHIN_PARCEL", SYM_VARIABLE, LST_INTEGER, 656, 0, 15, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llOwnerSay", SYM_FUNCTION, LST_NULL, 656, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGround", SYM_FUNCTION, LST_FLOATINGPOINT, 657, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetObjectPermMask", SYM_FUNCTION, LST_NULL, 658, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ANIM_ON", SYM_VARIABLE, LST_INTEGER, 660, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"SIM_STAT_PCT_CHARS_STEPPED", SYM_VARIABLE, LST_INTEGER, 660, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"VEHICLE_LINEAR_MOTOR_TIMESCALE", SYM_VARIABLE, LST_INTEGER, 660, 0, 30, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"DATA_RATING", SYM_VARIABLE, LST_INTEGER, 660, 0, 4, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"SMOOTH", SYM_VARIABLE, LST_INTEGER, 660, 0, 16, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PSYS_SRC_PATTERN_DROP", SYM_VARIABLE, LST_INTEGER, 660, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"VEHICLE_BANKING_MIX", SYM_VARIABLE, LST_INTEGER, 660, 0, 39, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetHoverHeight", SYM_FUNCTION, LST_NULL, 660, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_SCULPT_TYPE_CYLINDER", SYM_VARIABLE, LST_INTEGER, 663, 0, 4, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_BODY_SHAPE_TYPE", SYM_VARIABLE, LST_INTEGER, 663, 0, 26, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"HTTP_ACCEPT", SYM_VARIABLE, LST_INTEGER, 663, 0, 8, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"TARGETED_EMAIL_ROOT_CREATOR", SYM_VARIABLE, LST_INTEGER, 663, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llListRandomize", SYM_FUNCTION, LST_LIST, 663, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_SCULPT_FLAG_MIRROR", SYM_VARIABLE, LST_INTEGER, 665, 0, 128, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_BUMP_SHINY", SYM_VARIABLE, LST_INTEGER, 665, 0, 19, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetLinkPrimitiveParams", SYM_FUNCTION, LST_LIST, 665, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_ALLOW_UNSIT", SYM_VARIABLE, LST_INTEGER, 667, 0, 39, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_HUD_TOP_RIGHT", SYM_VARIABLE, LST_INTEGER, 667, 0, 32, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PERM_ALL", SYM_VARIABLE, LST_INTEGER, 667, 0, 2147483647, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"RC_DETECT_PHANTOM", SYM_VARIABLE, LST_INTEGER, 667, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CHANGED_MEDIA", SYM_VARIABLE, LST_INTEGER, 667, 0, 2048, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_BELLY", SYM_VARIABLE, LST_INTEGER, 667, 0, 28, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_HUD_BOTTOM_LEFT", SYM_VARIABLE, LST_INTEGER, 667, 0, 36, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"SKY_AMBIENT", SYM_VARIABLE, LST_INTEGER, 667, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetCameraAtOffset", SYM_FUNCTION, LST_NULL, 667, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_GROUP", SYM_VARIABLE, LST_INTEGER, 668, 0, 7, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llDeleteKeyValue", SYM_FUNCTION, LST_KEY, 668, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llListReplaceList", SYM_FUNCTION, LST_LIST, 669, 4, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PARCEL_MEDIA_COMMAND_URL", SYM_VARIABLE, LST_INTEGER, 673, 0, 5, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CHARACTER_TYPE_B", SYM_VARIABLE, LST_INTEGER, 673, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_BUMP_BRIGHT", SYM_VARIABLE, LST_INTEGER, 673, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"REQUIRE_LINE_OF_SIGHT", SYM_VARIABLE, LST_INTEGER, 673, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llStopMoveToTarget", SYM_FUNCTION, LST_NULL, 673, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSensorRepeat", SYM_FUNCTION, LST_NULL, 673, 6, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llRequestUsername", SYM_FUNCTION, LST_KEY, 679, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"VEHICLE_TYPE_AIRPLANE", SYM_VARIABLE, LST_INTEGER, 680, 0, 4, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetContentType", SYM_FUNCTION, LST_NULL, 680, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_MEDIA_AUTO_ZOOM", SYM_VARIABLE, LST_INTEGER, 682, 0, 7, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_SCULPT_TYPE_SPHERE", SYM_VARIABLE, LST_INTEGER, 682, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"HTTP_CUSTOM_HEADER", SYM_VARIABLE, LST_INTEGER, 682, 0, 5, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_BACK", SYM_VARIABLE, LST_INTEGER, 682, 0, 9, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"SKY_CLOUD_TEXTURE", SYM_VARIABLE, LST_INTEGER, 682, 0, 19, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_BUMP_LARGETILE", SYM_VARIABLE, LST_INTEGER, 682, 0, 14, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_ATTACHED_POINT", SYM_VARIABLE, LST_INTEGER, 682, 0, 19, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llHash", SYM_FUNCTION, LST_INTEGER, 682, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"VEHICLE_TYPE_SLED", SYM_VARIABLE, LST_INTEGER, 683, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_POS_LOCAL", SYM_VARIABLE, LST_INTEGER, 683, 0, 33, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CONTROL_RIGHT", SYM_VARIABLE, LST_INTEGER, 683, 0, 8, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_RIGHT_PEC", SYM_VARIABLE, LST_INTEGER, 683, 0, 30, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_TEXT", SYM_VARIABLE, LST_INTEGER, 683, 0, 44, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"RC_REJECT_NONPHYSICAL", SYM_VARIABLE, LST_INTEGER, 683, 0, 4, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ERR_GENERIC", SYM_VARIABLE, LST_INTEGER, 683, 0, -1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PSYS_PART_FLAGS", SYM_VARIABLE, LST_INTEGER, 683, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"SIT_NO_SIT_TARGET", SYM_VARIABLE, LST_INTEGER, 683, 0, -3, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"KFM_CMD_PLAY", SYM_VARIABLE, LST_INTEGER, 683, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"WATER_BLUR_MULTIPLIER", SYM_VARIABLE, LST_INTEGER, 683, 0, 100, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"listen", SYM_EVENT, LST_NULL, 683, 4, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llHTTPResponse", SYM_FUNCTION, LST_NULL, 687, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetForce", SYM_FUNCTION, LST_NULL, 690, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PARCEL_COUNT_GROUP", SYM_VARIABLE, LST_INTEGER, 692, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_TEXGEN_PLANAR", SYM_VARIABLE, LST_INTEGER, 692, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetNumberOfPrims", SYM_FUNCTION, LST_INTEGER, 692, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CONTROL_LBUTTON", SYM_VARIABLE, LST_INTEGER, 692, 0, 268435456, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CONTROL_DOWN", SYM_VARIABLE, LST_INTEGER, 692, 0, 32, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"AGENT_BY_LEGACY_NAME", SYM_VARIABLE, LST_INTEGER, 692, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetInventoryKey", SYM_FUNCTION, LST_KEY, 692, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"REGION_FLAG_DISABLE_PHYSICS", SYM_VARIABLE, LST_INTEGER, 693, 0, 16384, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llManageEstateAccess", SYM_FUNCTION, LST_INTEGER, 693, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"LIST_STAT_RANGE", SYM_VARIABLE, LST_INTEGER, 695, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_TOTAL_SCRIPT_COUNT", SYM_VARIABLE, LST_INTEGER, 695, 0, 10, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"SKY_HAZE", SYM_VARIABLE, LST_INTEGER, 695, 0, 23, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetSitText", SYM_FUNCTION, LST_NULL, 695, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PSYS_PART_BF_SOURCE_COLOR", SYM_VARIABLE, LST_INTEGER, 696, 0, 3, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_LPEC", SYM_VARIABLE, LST_INTEGER, 696, 0, 30, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llKeyCountKeyValue", SYM_FUNCTION, LST_KEY, 696, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"XP_ERROR_EXPERIENCE_SUSPENDED", SYM_VARIABLE, LST_INTEGER, 696, 0, 9, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_RPEC", SYM_VARIABLE, LST_INTEGER, 696, 0, 29, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PARCEL_MEDIA_COMMAND_DESC", SYM_VARIABLE, LST_INTEGER, 696, 0, 12, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CONTENT_TYPE_LLSD", SYM_VARIABLE, LST_INTEGER, 696, 0, 6, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"LINKSETDATA_NOUPDATE", SYM_VARIABLE, LST_INTEGER, 696, 0, 5, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"VEHICLE_LINEAR_DEFLECTION_EFFICIENCY", SYM_VARIABLE, LST_INTEGER, 696, 0, 28, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llReturnObjectsByID", SYM_FUNCTION, LST_INTEGER, 696, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetLinkPrimitiveParams", SYM_FUNCTION, LST_NULL, 697, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PASS_IF_NOT_HANDLED", SYM_VARIABLE, LST_INTEGER, 699, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"SIT_INVALID_LINK", SYM_VARIABLE, LST_INTEGER, 699, 0, -5, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"WATER_TEXTURE_DEFAULTS", SYM_VARIABLE, LST_INTEGER, 699, 0, 103, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"XP_ERROR_EXPERIENCES_DISABLED", SYM_VARIABLE, LST_INTEGER, 699, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"SKY_MOON_TEXTURE", SYM_VARIABLE, LST_INTEGER, 699, 0, 20, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_RUNNING_SCRIPT_COUNT", SYM_VARIABLE, LST_INTEGER, 699, 0, 9, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"LIST_STAT_SUM_SQUARES", SYM_VARIABLE, LST_INTEGER, 699, 0, 7, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"TRAVERSAL_TYPE_SLOW", SYM_VARIABLE, LST_INTEGER, 699, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OPT_OTHER", SYM_VARIABLE, LST_INTEGER, 699, 0, -1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"AGENT_AUTOPILOT", SYM_VARIABLE, LST_INTEGER, 699, 0, 8192, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ERR_THROTTLED", SYM_VARIABLE, LST_INTEGER, 699, 0, -5, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_MEDIA_PERMS_INTERACT", SYM_VARIABLE, LST_INTEGER, 699, 0, 13, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_BUMP_DARK", SYM_VARIABLE, LST_INTEGER, 699, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llRequestExperiencePermissions", SYM_FUNCTION, LST_NULL, 699, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_SCRIPTED_SIT_ONLY", SYM_VARIABLE, LST_INTEGER, 701, 0, 40, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"SKY_MOON", SYM_VARIABLE, LST_INTEGER, 701, 0, 9, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CHANGED_OWNER", SYM_VARIABLE, LST_INTEGER, 701, 0, 128, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llApplyRotationalImpulse", SYM_FUNCTION, LST_NULL, 701, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_MEDIA_HEIGHT_PIXELS", SYM_VARIABLE, LST_INTEGER, 703, 0, 10, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetSimStats", SYM_FUNCTION, LST_FLOATINGPOINT, 703, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetLinkKey", SYM_FUNCTION, LST_KEY, 704, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_HOVER_HEIGHT", SYM_VARIABLE, LST_INTEGER, 705, 0, 25, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetPrimURL", SYM_FUNCTION, LST_NULL, 705, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"HTTP_VERIFY_CERT", SYM_VARIABLE, LST_INTEGER, 706, 0, 3, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"FORCE_DIRECT_PATH", SYM_VARIABLE, LST_INTEGER, 706, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PSYS_SRC_INNERANGLE", SYM_VARIABLE, LST_INTEGER, 706, 0, 10, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CHARACTER_TYPE_A", SYM_VARIABLE, LST_INTEGER, 706, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llClearExperiencePermissions", SYM_FUNCTION, LST_NULL, 706, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_RULEG", SYM_VARIABLE, LST_INTEGER, 707, 0, 23, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CONTENT_TYPE_HTML", SYM_VARIABLE, LST_INTEGER, 707, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetAlpha", SYM_FUNCTION, LST_NULL, 707, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llMinEventDelay", SYM_FUNCTION, LST_NULL, 709, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetNumberOfSides", SYM_FUNCTION, LST_INTEGER, 710, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llRemoteLoadScriptPin", SYM_FUNCTION, LST_NULL, 710, 5, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_PHYSICS_SHAPE_TYPE", SYM_VARIABLE, LST_INTEGER, 715, 0, 30, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llCos", SYM_FUNCTION, LST_FLOATINGPOINT, 715, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSHA1String", SYM_FUNCTION, LST_STRING, 716, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"LIST_STAT_MEDIAN", SYM_VARIABLE, LST_INTEGER, 717, 0, 4, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PARCEL_DETAILS_PRIM_USED", SYM_VARIABLE, LST_INTEGER, 717, 0, 8, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llList2Key", SYM_FUNCTION, LST_KEY, 717, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llAcos", SYM_FUNCTION, LST_FLOATINGPOINT, 719, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_MATERIAL_METAL", SYM_VARIABLE, LST_INTEGER, 720, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PSYS_SRC_PATTERN_ANGLE_CONE_EMPTY", SYM_VARIABLE, LST_INTEGER, 720, 0, 16, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llBreakAllLinks", SYM_FUNCTION, LST_NULL, 720, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llTarget", SYM_FUNCTION, LST_INTEGER, 720, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"moving_start", SYM_EVENT, LST_NULL, 722, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llMakeExplosion", SYM_FUNCTION, LST_NULL, 722, 7, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetListEntryType", SYM_FUNCTION, LST_INTEGER, 729, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetEnv", SYM_FUNCTION, LST_STRING, 731, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"VEHICLE_LINEAR_FRICTION_TIMESCALE", SYM_VARIABLE, LST_INTEGER, 732, 0, 16, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"JSON_ARRAY", SYM_VARIABLE, LST_STRING, 732, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, "﷒"},
+    {"llParseString2List", SYM_FUNCTION, LST_LIST, 732, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"STATUS_SANDBOX", SYM_VARIABLE, LST_INTEGER, 735, 0, 32, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_SCULPT_FLAG_INVERT", SYM_VARIABLE, LST_INTEGER, 735, 0, 64, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"NULL_KEY", SYM_VARIABLE, LST_STRING, 735, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, "00000000-0000-0000-0000-000000000000"},
+    {"llRequestPermissions", SYM_FUNCTION, LST_NULL, 735, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PURSUIT_FUZZ_FACTOR", SYM_VARIABLE, LST_INTEGER, 737, 0, 3, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"INVENTORY_SOUND", SYM_VARIABLE, LST_INTEGER, 737, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llRemoveVehicleFlags", SYM_FUNCTION, LST_NULL, 737, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetAgentList", SYM_FUNCTION, LST_LIST, 738, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetLinkPrimitiveParamsFast", SYM_FUNCTION, LST_NULL, 740, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetRegionFlags", SYM_FUNCTION, LST_INTEGER, 742, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PU_FAILURE_TARGET_GONE", SYM_VARIABLE, LST_INTEGER, 742, 0, 5, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"collision", SYM_EVENT, LST_NULL, 742, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetAndResetTime", SYM_FUNCTION, LST_FLOATINGPOINT, 743, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"SIT_NOT_EXPERIENCE", SYM_VARIABLE, LST_INTEGER, 743, 0, -1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PARCEL_MEDIA_COMMAND_STOP", SYM_VARIABLE, LST_INTEGER, 743, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CHARACTER_DESIRED_TURN_SPEED", SYM_VARIABLE, LST_INTEGER, 743, 0, 12, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llReleaseURL", SYM_FUNCTION, LST_NULL, 743, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"GCNP_STATIC", SYM_VARIABLE, LST_INTEGER, 744, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"RC_DATA_FLAGS", SYM_VARIABLE, LST_INTEGER, 744, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_TYPE_PRISM", SYM_VARIABLE, LST_INTEGER, 744, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llTriggerSound", SYM_FUNCTION, LST_NULL, 744, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llOverMyLand", SYM_FUNCTION, LST_INTEGER, 746, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetTimerEvent", SYM_FUNCTION, LST_NULL, 747, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_BUMP_BLOBS", SYM_VARIABLE, LST_INTEGER, 748, 0, 12, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"LAND_REVERT", SYM_VARIABLE, LST_INTEGER, 748, 0, 5, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"TYPE_VECTOR", SYM_VARIABLE, LST_INTEGER, 748, 0, 5, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"KFM_TRANSLATION", SYM_VARIABLE, LST_INTEGER, 748, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"transaction_result", SYM_EVENT, LST_NULL, 748, 3, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetExperienceList", SYM_FUNCTION, LST_LIST, 751, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PSYS_SRC_OBJ_REL_MASK", SYM_VARIABLE, LST_INTEGER, 752, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llBase64ToInteger", SYM_FUNCTION, LST_INTEGER, 752, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PURSUIT_OFFSET", SYM_VARIABLE, LST_INTEGER, 753, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_RFOOT", SYM_VARIABLE, LST_INTEGER, 753, 0, 8, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llCSV2List", SYM_FUNCTION, LST_LIST, 753, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"VEHICLE_FLAG_HOVER_GLOBAL_HEIGHT", SYM_VARIABLE, LST_INTEGER, 754, 0, 16, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"XP_ERROR_NOT_FOUND", SYM_VARIABLE, LST_INTEGER, 754, 0, 6, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PASSIVE", SYM_VARIABLE, LST_INTEGER, 754, 0, 4, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetColor", SYM_FUNCTION, LST_VECTOR, 754, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llDetectedOwner", SYM_FUNCTION, LST_KEY, 755, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetObjectPrimCount", SYM_FUNCTION, LST_INTEGER, 756, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llDetectedTouchNormal", SYM_FUNCTION, LST_VECTOR, 757, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_HIND_RFOOT", SYM_VARIABLE, LST_INTEGER, 758, 0, 55, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_POINT_LIGHT", SYM_VARIABLE, LST_INTEGER, 758, 0, 23, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llResetAnimationOverride", SYM_FUNCTION, LST_NULL, 758, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_NAME", SYM_VARIABLE, LST_INTEGER, 759, 0, 27, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ENV_VALIDATION_FAIL", SYM_VARIABLE, LST_INTEGER, 759, 0, -6, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PU_FAILURE_DYNAMIC_PATHFINDING_DISABLED", SYM_VARIABLE, LST_INTEGER, 759, 0, 10, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_MEDIA_MAX_WHITELIST_COUNT", SYM_VARIABLE, LST_INTEGER, 759, 0, 64, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"DATA_ONLINE", SYM_VARIABLE, LST_INTEGER, 759, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llSetObjectName", SYM_FUNCTION, LST_NULL, 759, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llPursue", SYM_FUNCTION, LST_NULL, 760, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PARCEL_DETAILS_LANDING_LOOKAT", SYM_VARIABLE, LST_INTEGER, 762, 0, 10, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PARCEL_FLAG_USE_ACCESS_LIST", SYM_VARIABLE, LST_INTEGER, 762, 0, 512, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"OBJECT_ANIMATED_SLOTS_AVAILABLE", SYM_VARIABLE, LST_INTEGER, 762, 0, 40, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetMoonDirection", SYM_FUNCTION, LST_VECTOR, 762, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_MEDIA_CONTROLS_STANDARD", SYM_VARIABLE, LST_INTEGER, 762, 0, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llLinksetDataDelete", SYM_FUNCTION, LST_INTEGER, 762, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"TOUCH_INVALID_FACE", SYM_VARIABLE, LST_INTEGER, 763, 0, -1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"AGENT_LIST_PARCEL", SYM_VARIABLE, LST_INTEGER, 763, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_BUMP_STUCCO", SYM_VARIABLE, LST_INTEGER, 763, 0, 15, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"ATTACH_RSHOULDER", SYM_VARIABLE, LST_INTEGER, 763, 0, 4, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llGetVisualParams", SYM_FUNCTION, LST_LIST, 763, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PI", SYM_VARIABLE, LST_FLOATINGPOINT, 765, 0, 0, {3.14159265f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PASS_NEVER", SYM_VARIABLE, LST_INTEGER, 765, 0, 2, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llPassCollisions", SYM_FUNCTION, LST_NULL, 765, 1, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"INVENTORY_BODYPART", SYM_VARIABLE, LST_INTEGER, 766, 0, 13, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CLICK_ACTION_PAY", SYM_VARIABLE, LST_INTEGER, 766, 0, 3, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"LIST_STAT_MIN", SYM_VARIABLE, LST_INTEGER, 766, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"CAMERA_POSITION_LAG", SYM_VARIABLE, LST_INTEGER, 766, 0, 5, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_HOLE_TRIANGLE", SYM_VARIABLE, LST_INTEGER, 766, 0, 48, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"llLinksetDataListKeys", SYM_FUNCTION, LST_LIST, 766, 2, 0, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+    {"PRIM_MEDIA_CONTROLS_MINI", SYM_VARIABLE, LST_INTEGER, 768, 0, 1, {0.0f, 0.0f, 0.0f, 0.0f}, nullptr},
+};
+
+static constexpr uint16_t BUILTIN_HASH_SEEDS[] = {
+    2, 229, 1, 388, 35, 17, 169, 42, 11, 25, 0, 4, 18, 12, 8, 41,
+    4, 11, 40, 33, 4, 13, 4, 76, 292, 2, 22, 9, 2, 73, 1, 10,
+    8, 8, 68, 13, 74, 14, 8, 1, 7, 6, 2, 228, 47, 44, 37, 7,
+    4, 20, 8, 357, 4, 24, 1, 11, 3, 7, 1, 5, 540, 1, 174, 1,
+    44, 284, 65, 16, 79, 67, 40, 29, 7, 0, 21, 105, 2, 1, 27, 0,
+    58, 201, 6, 47, 194, 1, 3, 153, 4, 227, 128, 720, 18, 65, 15, 41,
+    1, 7, 6, 0, 6, 25, 26, 237, 104, 214, 7, 62, 144, 49, 5, 33,
+    32, 120, 24, 138, 3, 9, 3, 125, 21, 4, 85, 321, 10, 79, 146, 144,
+    32, 10, 141, 312, 2, 13, 9, 13, 61, 270, 2, 1, 151, 2, 172, 67,
+    152, 13, 286, 69, 67, 178, 338, 5, 140, 1, 67, 4, 12, 562, 2, 139,
+    3, 1, 2, 1, 63, 1, 26, 183, 6, 15, 74, 70, 31, 167, 176, 7,
+    630, 34, 6, 1, 63, 40, 64, 22, 33, 447, 11, 512, 135, 34, 149, 6,
+    9, 558, 111, 71, 529, 83, 3, 2, 342, 1, 5, 14, 10, 77, 205, 17,
+    155, 156, 337, 11, 29, 882, 648, 1, 219, 19, 83, 1, 3, 249, 428, 5,
+    73, 29, 14, 1, 25, 1075, 2, 22, 353, 107, 3, 2, 2, 10, 10, 2,
+    213, 396, 701, 3, 323, 24, 40, 165, 377, 1058, 53, 1, 465, 0, 18, 5,
+    8, 1618, 3, 2, 4, 2, 31, 126, 2, 10, 4115, 168, 3080, 491, 193, 1788,
+    637, 2, 411, 1, 208, 157, 48, 529, 2, 323, 486, 153, 238, 155, 65, 57,
+    495, 318, 3, 2583, 8171, 118, 3, 3, 31, 608, 443, 326, 89, 24, 1, 3834,
+    2, 54, 29, 13, 360, 2110, 507, 1, 176, 118, 56, 16, 718, 1782, 966, 1602,
+    9, 4, 678, 413, 50, 4, 945, 3560, 25, 208, 920, 114, 31,
+};
+
+static constexpr size_t NUM_BUILTIN_ENTRIES = sizeof(BUILTIN_ENTRIES) / sizeof(BUILTIN_ENTRIES[0]);
+static constexpr size_t NUM_BUILTIN_HASH_SEEDS = sizeof(BUILTIN_HASH_SEEDS) / sizeof(BUILTIN_HASH_SEEDS[0]);
+
+static constexpr int find_builtin_entry_impl(const char *name) {
+  uint32_t seed = BUILTIN_HASH_SEEDS[hash_builtin_name(name, 0) % NUM_BUILTIN_HASH_SEEDS];
+  auto idx = (int)(hash_builtin_name(name, seed) % NUM_BUILTIN_ENTRIES);
+  // the hash only tells us where the name would be if it existed.
+  const char *entry_name = BUILTIN_ENTRIES[idx].name;
+  for (; *name && *name == *entry_name; ++name, ++entry_name);
+  return (*name == *entry_name) ? idx : -1;
+}
+
+static constexpr bool check_builtin_hashes() {
+  for (size_t i = 0; i < NUM_BUILTIN_ENTRIES; ++i) {
+    if (find_builtin_entry_impl(BUILTIN_ENTRIES[i].name) != (int)i)
+      return false;
+  }
+  return true;
+}
+static_assert(check_builtin_hashes(), "builtins_table.cc is out of sync with hash_builtin_name()");
+
+int find_builtin_entry(const char *name) {
+  return find_builtin_entry_impl(name);
+}
+
+const BuiltinEntry *get_builtin_entries(size_t *num_entries) {
+  *num_entries = NUM_BUILTIN_ENTRIES;
+  return BUILTIN_ENTRIES;
+}
+
+const BuiltinParam *get_builtin_params(const BuiltinEntry *entry) {
+  return BUILTIN_PARAMS + entry->first_param;
+}
+
+}
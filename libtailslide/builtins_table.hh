@@ -0,0 +1,51 @@
+#ifndef TAILSLIDE_BUILTINS_TABLE_HH
+#define TAILSLIDE_BUILTINS_TABLE_HH
+
+#include <cstddef>
+#include <cstdint>
+
+#include "lslmini.hh"
+
+namespace Tailslide {
+
+struct BuiltinParam {
+  const char *name;
+  LSLIType type;
+};
+
+// A builtin function, event or constant, as described in builtins.txt
+struct BuiltinEntry {
+  const char *name;
+  LSLSymbolType symbol_type;
+  // return type for functions
+  LSLIType type;
+  // index of the first param in the param table, for functions and events
+  uint16_t first_param;
+  uint16_t num_params;
+  // values for constants, whichever one is relevant for `type`
+  int32_t int_value;
+  float float_values[4];
+  const char *str_value;
+};
+
+// FNV-1a, must match `hash_name()` in generate_builtins_c.py
+constexpr uint32_t hash_builtin_name(const char *name, uint32_t seed) {
+  uint32_t hash = 2166136261u ^ seed;
+  for (; *name; ++name) {
+    hash ^= (uint8_t)*name;
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+// These are implemented in builtins_table.cc, which the build generates from builtins.txt
+
+/// Get the index of the builtin named `name` with a single probe of
+/// a perfect hash table, or -1 if there's no such builtin.
+int find_builtin_entry(const char *name);
+const BuiltinEntry *get_builtin_entries(size_t *num_entries);
+const BuiltinParam *get_builtin_params(const BuiltinEntry *entry);
+
+}
+
+#endif
@@ -0,0 +1,394 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <system_error>
+#include <vector>
+
+#include "compile_cache.hh"
+
+namespace Tailslide {
+
+namespace fs = std::filesystem;
+
+// bump whenever the entry format changes
+static const uint32_t CACHE_FORMAT_VERSION = 3;
+static const char CACHE_MAGIC[4] = {'T', 'S', 'C', 'C'};
+// trimming stops once the cache is this fraction of its maximum size so we
+// don't have to trim again right after adding the next entry.
+static const double CACHE_LOW_WATER_MARK = 0.9;
+// temp files older than this were probably left behind by a crashed process
+static const auto STALE_TEMP_AGE = std::chrono::hours(1);
+
+static uint32_t rotr32(uint32_t val, int shift) {
+  return (val >> shift) | (val << (32 - shift));
+}
+
+static const uint32_t SHA256_ROUND_CONSTANTS[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+};
+
+void CacheKeyBuilder::processBlock(const uint8_t *block) {
+  uint32_t w[64];
+  for (int i = 0; i < 16; ++i) {
+    w[i] = ((uint32_t)block[i * 4] << 24) | ((uint32_t)block[i * 4 + 1] << 16)
+         | ((uint32_t)block[i * 4 + 2] << 8) | (uint32_t)block[i * 4 + 3];
+  }
+  for (int i = 16; i < 64; ++i) {
+    uint32_t s0 = rotr32(w[i - 15], 7) ^ rotr32(w[i - 15], 18) ^ (w[i - 15] >> 3);
+    uint32_t s1 = rotr32(w[i - 2], 17) ^ rotr32(w[i - 2], 19) ^ (w[i - 2] >> 10);
+    w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+  }
+
+  uint32_t a = _mState[0], b = _mState[1], c = _mState[2], d = _mState[3];
+  uint32_t e = _mState[4], f = _mState[5], g = _mState[6], h = _mState[7];
+  for (int i = 0; i < 64; ++i) {
+    uint32_t s1 = rotr32(e, 6) ^ rotr32(e, 11) ^ rotr32(e, 25);
+    uint32_t ch = (e & f) ^ (~e & g);
+    uint32_t temp1 = h + s1 + ch + SHA256_ROUND_CONSTANTS[i] + w[i];
+    uint32_t s0 = rotr32(a, 2) ^ rotr32(a, 13) ^ rotr32(a, 22);
+    uint32_t maj = (a & b) ^ (a & c) ^ (b & c);
+    uint32_t temp2 = s0 + maj;
+    h = g;
+    g = f;
+    f = e;
+    e = d + temp1;
+    d = c;
+    c = b;
+    b = a;
+    a = temp1 + temp2;
+  }
+  _mState[0] += a; _mState[1] += b; _mState[2] += c; _mState[3] += d;
+  _mState[4] += e; _mState[5] += f; _mState[6] += g; _mState[7] += h;
+}
+
+CacheKeyBuilder &CacheKeyBuilder::addBytes(const void *data, size_t len) {
+  auto *bytes = (const uint8_t *)data;
+  size_t buffered = _mLength % sizeof(_mBuffer);
+  _mLength += len;
+  // top up a partial block first
+  if (buffered) {
+    size_t needed = std::min(len, sizeof(_mBuffer) - buffered);
+    memcpy(_mBuffer + buffered, bytes, needed);
+    bytes += needed;
+    len -= needed;
+    if (buffered + needed < sizeof(_mBuffer))
+      return *this;
+    processBlock(_mBuffer);
+  }
+  for (; len >= sizeof(_mBuffer); bytes += sizeof(_mBuffer), len -= sizeof(_mBuffer))
+    processBlock(bytes);
+  memcpy(_mBuffer, bytes, len);
+  return *this;
+}
+
+CacheKeyBuilder &CacheKeyBuilder::addString(const std::string &str) {
+  // length-prefixed so adjacent strings can't run together
+  addInt(str.size());
+  return addBytes(str.data(), str.size());
+}
+
+CacheKeyBuilder &CacheKeyBuilder::addInt(uint64_t val) {
+  uint8_t bytes[8];
+  for (unsigned char &byte : bytes) {
+    byte = (uint8_t)val;
+    val >>= 8;
+  }
+  return addBytes(bytes, sizeof(bytes));
+}
+
+CacheKeyBuilder &CacheKeyBuilder::addOptions(const OptimizationOptions &opts) {
+  addInt(opts.fold_constants);
+  addInt(opts.prune_unused_locals);
+  addInt(opts.prune_unused_globals);
+  addInt(opts.prune_unused_functions);
+  return addInt(opts.may_create_new_strs);
+}
+
+CacheKeyBuilder &CacheKeyBuilder::addOptions(const PrettyPrintOpts &opts) {
+  addInt(opts.mangle_local_names);
+  addInt(opts.mangle_func_names);
+  addInt(opts.mangle_global_names);
+  return addInt(opts.show_unmangled);
+}
+
+CacheKeyBuilder &CacheKeyBuilder::addOptions(const MonoCompilationOptions &opts) {
+  addInt(opts.optimize_sutractions);
+  return addInt(opts.omit_unnecessary_pushes);
+}
+
+std::string CacheKeyBuilder::finish() const {
+  // pad a copy so more can still be added to this one
+  CacheKeyBuilder padded = *this;
+  uint64_t bit_length = _mLength * 8;
+  uint8_t padding[72] = {0x80};
+  size_t buffered = _mLength % sizeof(_mBuffer);
+  size_t padding_len = (buffered < 56 ? 56 : 120) - buffered;
+  for (int i = 0; i < 8; ++i)
+    padding[padding_len + i] = (uint8_t)(bit_length >> (56 - i * 8));
+  padded.addBytes(padding, padding_len + 8);
+
+  char buf[65];
+  for (int i = 0; i < 8; ++i)
+    snprintf(buf + i * 8, 9, "%08x", padded._mState[i]);
+  return buf;
+}
+
+
+static void write_cache_int(std::string &out, uint64_t val, int num_bytes) {
+  for (int i = 0; i < num_bytes; ++i) {
+    out += (char)(uint8_t)val;
+    val >>= 8;
+  }
+}
+
+static void write_cache_string(std::string &out, const std::string &str) {
+  write_cache_int(out, str.size(), 8);
+  out += str;
+}
+
+// Reads back what the `write_cache_*()` functions wrote, failing on truncated data
+class CacheEntryReader {
+  public:
+    explicit CacheEntryReader(const std::string &data) : _mData(data) {}
+
+    bool readInt(uint64_t &val, int num_bytes) {
+      if (_mData.size() - _mPos < (size_t)num_bytes)
+        return false;
+      val = 0;
+      for (int i = 0; i < num_bytes; ++i)
+        val |= (uint64_t)(uint8_t)_mData[_mPos + i] << (i * 8);
+      _mPos += num_bytes;
+      return true;
+    }
+
+    bool readString(std::string &str) {
+      uint64_t len;
+      if (!readInt(len, 8) || _mData.size() - _mPos < len)
+        return false;
+      str.assign(_mData, _mPos, (size_t)len);
+      _mPos += (size_t)len;
+      return true;
+    }
+
+    bool atEnd() const { return _mPos == _mData.size(); }
+
+  private:
+    const std::string &_mData;
+    size_t _mPos = 0;
+};
+
+static std::string serialize_entry(const std::string &key, const CompileResult &result) {
+  std::string out(CACHE_MAGIC, sizeof(CACHE_MAGIC));
+  write_cache_int(out, CACHE_FORMAT_VERSION, 4);
+  write_cache_string(out, key);
+  write_cache_int(out, result.parsed, 1);
+  write_cache_int(out, (uint32_t)result.errors, 4);
+  write_cache_int(out, (uint32_t)result.warnings, 4);
+  write_cache_string(out, result.diagnostics);
+  write_cache_int(out, result.messages.size(), 4);
+  for (const auto &message : result.messages) {
+    write_cache_int(out, message.level, 1);
+    write_cache_int(out, message.code, 4);
+    write_cache_int(out, (uint32_t)message.loc.first_line, 4);
+    write_cache_int(out, (uint32_t)message.loc.first_column, 4);
+    write_cache_int(out, (uint32_t)message.loc.last_line, 4);
+    write_cache_int(out, (uint32_t)message.loc.last_column, 4);
+    write_cache_string(out, message.message);
+  }
+  write_cache_string(out, result.pretty);
+  write_cache_string(out, result.tree);
+  write_cache_string(out, result.lso);
+  write_cache_string(out, result.cil);
+  return out;
+}
+
+static bool deserialize_entry(const std::string &data, const std::string &key, CompileResult &result) {
+  if (data.size() < sizeof(CACHE_MAGIC) || memcmp(data.data(), CACHE_MAGIC, sizeof(CACHE_MAGIC)) != 0)
+    return false;
+  CacheEntryReader reader(data);
+  uint64_t magic, version, parsed, errors, warnings;
+  std::string stored_key;
+  if (!reader.readInt(magic, 4) || !reader.readInt(version, 4) || version != CACHE_FORMAT_VERSION)
+    return false;
+  if (!reader.readString(stored_key) || stored_key != key)
+    return false;
+  if (!reader.readInt(parsed, 1) || !reader.readInt(errors, 4) || !reader.readInt(warnings, 4))
+    return false;
+  CompileResult read_result;
+  read_result.parsed = parsed != 0;
+  read_result.errors = (int)(uint32_t)errors;
+  read_result.warnings = (int)(uint32_t)warnings;
+  uint64_t num_messages;
+  if (!reader.readString(read_result.diagnostics) || !reader.readInt(num_messages, 4))
+    return false;
+  for (uint64_t i = 0; i < num_messages; ++i) {
+    uint64_t level, code, first_line, first_column, last_line, last_column;
+    Diagnostic message {};
+    if (!reader.readInt(level, 1) || !reader.readInt(code, 4)
+        || !reader.readInt(first_line, 4) || !reader.readInt(first_column, 4)
+        || !reader.readInt(last_line, 4) || !reader.readInt(last_column, 4)
+        || !reader.readString(message.message))
+      return false;
+    message.level = (LogLevel)level;
+    message.code = (ErrorCode)code;
+    message.loc = {(int)first_line, (int)first_column, (int)last_line, (int)last_column};
+    read_result.messages.push_back(std::move(message));
+  }
+  if (!reader.readString(read_result.pretty)
+      || !reader.readString(read_result.tree) || !reader.readString(read_result.lso)
+      || !reader.readString(read_result.cil) || !reader.atEnd())
+    return false;
+  result = std::move(read_result);
+  return true;
+}
+
+
+CompileCache::CompileCache(fs::path dir, uint64_t max_bytes) : _mDir(std::move(dir)), _mMaxBytes(max_bytes) {
+  std::random_device rd;
+  _mInstanceID = ((uint64_t)rd() << 32) | rd();
+}
+
+std::string CompileCache::makeKey(const std::string &source, const OptimizationOptions &optim_opts,
+                                  const PrettyPrintOpts &pretty_opts, const MonoCompilationOptions &mono_opts,
+                                  uint64_t flags) {
+  CacheKeyBuilder builder;
+  builder.addInt(CACHE_FORMAT_VERSION);
+  // different builds of the compiler may give different output for the same input
+#ifdef VERSION
+  builder.addString(VERSION);
+#endif
+  builder.addString(tailslide_get_build_id());
+  builder.addInt(tailslide_get_builtins_fingerprint());
+  builder.addOptions(optim_opts);
+  builder.addOptions(pretty_opts);
+  builder.addOptions(mono_opts);
+  builder.addInt(flags);
+  builder.addString(source);
+  return builder.finish();
+}
+
+fs::path CompileCache::getEntryPath(const std::string &key) const {
+  // fan out into subdirectories so no single directory gets huge
+  return _mDir / key.substr(0, 2) / key;
+}
+
+bool CompileCache::lookup(const std::string &key, CompileResult &result) {
+  auto path = getEntryPath(key);
+  std::ifstream f(path, std::ios::binary);
+  if (!f) {
+    ++_mMisses;
+    return false;
+  }
+  std::stringstream contents;
+  contents << f.rdbuf();
+  f.close();
+  if (!deserialize_entry(contents.str(), key, result)) {
+    // corrupt or from an older version, get rid of it.
+    std::error_code ec;
+    fs::remove(path, ec);
+    ++_mMisses;
+    return false;
+  }
+  // mark as recently used so `trim()` keeps it around
+  std::error_code ec;
+  fs::last_write_time(path, fs::file_time_type::clock::now(), ec);
+  ++_mHits;
+  return true;
+}
+
+bool CompileCache::store(const std::string &key, const CompileResult &result) {
+  auto path = getEntryPath(key);
+  std::error_code ec;
+  fs::create_directories(path.parent_path(), ec);
+  if (ec)
+    return false;
+
+  auto temp_path = path;
+  temp_path += "." + std::to_string(_mInstanceID) + "-" + std::to_string(_mTempCounter++) + ".tmp";
+  std::string data = serialize_entry(key, result);
+  {
+    std::ofstream f(temp_path, std::ios::binary);
+    if (!f)
+      return false;
+    f.write(data.data(), (std::streamsize)data.size());
+    if (!f.flush()) {
+      f.close();
+      fs::remove(temp_path, ec);
+      return false;
+    }
+  }
+  // readers either see the old entry, no entry, or the complete new one.
+  fs::rename(temp_path, path, ec);
+  if (ec) {
+    fs::remove(temp_path, ec);
+    return false;
+  }
+  // trimming leaves this much headroom, once it's used up we may be over the limit again.
+  auto trim_after = (uint64_t)((double)_mMaxBytes * (1.0 - CACHE_LOW_WATER_MARK));
+  if ((_mBytesSinceTrim += data.size()) > trim_after && !_mTrimming.exchange(true)) {
+    trim();
+    _mTrimming = false;
+  }
+  return true;
+}
+
+void CompileCache::trim() {
+  struct CacheFile {
+    fs::path path;
+    fs::file_time_type last_used;
+    uint64_t size;
+  };
+  std::vector<CacheFile> files;
+  uint64_t total_size = 0;
+  _mBytesSinceTrim = 0;
+  auto now = fs::file_time_type::clock::now();
+  std::error_code ec;
+  // other processes may be adding and removing entries while we walk, nothing here is fatal.
+  fs::recursive_directory_iterator iter(_mDir, ec);
+  for (; !ec && iter != fs::recursive_directory_iterator(); iter.increment(ec)) {
+    const auto &entry = *iter;
+    std::error_code entry_ec;
+    if (!entry.is_regular_file(entry_ec))
+      continue;
+    auto last_used = entry.last_write_time(entry_ec);
+    if (entry_ec)
+      continue;
+    if (entry.path().extension() == ".tmp") {
+      // may still be being written by another process, only clean up old ones.
+      if (now - last_used > STALE_TEMP_AGE)
+        fs::remove(entry.path(), entry_ec);
+      continue;
+    }
+    uint64_t size = entry.file_size(entry_ec);
+    if (entry_ec)
+      continue;
+    files.push_back({entry.path(), last_used, size});
+    total_size += size;
+  }
+  if (total_size <= _mMaxBytes)
+    return;
+
+  std::sort(files.begin(), files.end(), [](const CacheFile &a, const CacheFile &b) {
+    return a.last_used < b.last_used;
+  });
+  auto target_size = (uint64_t)((double)_mMaxBytes * CACHE_LOW_WATER_MARK);
+  for (auto &file : files) {
+    if (total_size <= target_size)
+      break;
+    if (fs::remove(file.path, ec))
+      total_size -= file.size;
+  }
+}
+
+}
@@ -0,0 +1,97 @@
+#ifndef TAILSLIDE_COMPILE_CACHE_HH
+#define TAILSLIDE_COMPILE_CACHE_HH
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "passes/pretty_print.hh"
+#include "passes/tree_simplifier.hh"
+#include "passes/mono/script_compiler.hh"
+
+namespace Tailslide {
+
+/// Everything compiling a single script produced
+struct CompileResult {
+  // whether the script parsed at all
+  bool parsed = false;
+  int errors = 0;
+  int warnings = 0;
+  // as formatted by `Logger::formatReport()`
+  std::string diagnostics;
+  // the same messages as `Logger::getDiagnostics()`, if they were asked for
+  std::vector<Diagnostic> messages;
+  std::string pretty;
+  std::string tree;
+  std::string lso;
+  std::string cil;
+};
+
+/// Incrementally builds a SHA-256 content hash for use as a cache key.
+/// Lookups trust any entry with a matching key, so the hash has to be collision resistant.
+class CacheKeyBuilder {
+  public:
+    CacheKeyBuilder &addBytes(const void *data, size_t len);
+    CacheKeyBuilder &addString(const std::string &str);
+    CacheKeyBuilder &addInt(uint64_t val);
+    CacheKeyBuilder &addOptions(const OptimizationOptions &opts);
+    CacheKeyBuilder &addOptions(const PrettyPrintOpts &opts);
+    CacheKeyBuilder &addOptions(const MonoCompilationOptions &opts);
+    /// 64 hex digits
+    std::string finish() const;
+
+  private:
+    void processBlock(const uint8_t *block);
+
+    uint32_t _mState[8] = {
+        0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19,
+    };
+    // bytes that don't make up a whole block yet
+    uint8_t _mBuffer[64] = {};
+    uint64_t _mLength = 0;
+};
+
+/// Cache of compilation results stored on disk, keyed by a hash of everything
+/// that may affect the result. Safe to use from multiple threads and processes at once,
+/// entries are written to a temporary file and renamed into place.
+class CompileCache {
+  public:
+    CompileCache(std::filesystem::path dir, uint64_t max_bytes);
+
+    /// Key for `source` compiled with the current builtins and the given options.
+    /// `flags` should describe anything else that changes the output, like which outputs were asked for.
+    static std::string makeKey(const std::string &source, const OptimizationOptions &optim_opts,
+                               const PrettyPrintOpts &pretty_opts, const MonoCompilationOptions &mono_opts,
+                               uint64_t flags);
+
+    bool lookup(const std::string &key, CompileResult &result);
+    /// Also trims the cache whenever enough has been stored since the last trim
+    /// that it may have outgrown `max_bytes`, so long-running processes stay bounded.
+    bool store(const std::string &key, const CompileResult &result);
+    /// Evict the least recently used entries until the cache fits in `max_bytes`
+    void trim();
+
+    uint64_t getHits() const { return _mHits; }
+    uint64_t getMisses() const { return _mMisses; }
+
+  private:
+    std::filesystem::path getEntryPath(const std::string &key) const;
+
+    std::filesystem::path _mDir;
+    uint64_t _mMaxBytes;
+    // makes temp file names unique across processes
+    uint64_t _mInstanceID;
+    std::atomic<uint64_t> _mTempCounter {0};
+    // bytes written by `store()` since the last `trim()`
+    std::atomic<uint64_t> _mBytesSinceTrim {0};
+    // only one thread needs to trim at a time
+    std::atomic<bool> _mTrimming {false};
+    std::atomic<uint64_t> _mHits {0};
+    std::atomic<uint64_t> _mMisses {0};
+};
+
+}
+
+#endif
@@ -0,0 +1,469 @@
+#include <cstring>
+#include <unordered_set>
+
+#include "incremental.hh"
+#include "passes/final_pass.hh"
+#include "passes/symbol_resolution.hh"
+#include "passes/type_checking.hh"
+#include "passes/values.hh"
+
+namespace Tailslide {
+
+// re-parse from scratch once superseded nodes take up this many times what a fresh parse did
+static const size_t MAX_ARENA_GROWTH = 4;
+// stands in for the rest of the script when re-parsing a single global function or state
+static const char FRAGMENT_DEFAULT_STATE[] = "default{state_entry(){}}";
+
+enum LexState { LEX_CODE, LEX_STRING, LEX_LINE_COMMENT, LEX_BLOCK_COMMENT };
+
+// Follow strings and comments through `src` up to `end` the way the lexer would.
+// `multiline_strings` gets set if a string spans lines, the lexer doesn't count
+// those newlines so positions after them won't match the source.
+static LexState scan_lex_state(const std::string &src, size_t end, bool *multiline_strings = nullptr) {
+  LexState state = LEX_CODE;
+  for (size_t i = 0; i < end; ++i) {
+    char c = src[i];
+    char next = i + 1 < src.size() ? src[i + 1] : '\0';
+    switch (state) {
+      case LEX_CODE:
+        if (c == '"') {
+          state = LEX_STRING;
+        } else if (c == '/' && next == '/') {
+          state = LEX_LINE_COMMENT;
+          ++i;
+        } else if (c == '/' && next == '*') {
+          state = LEX_BLOCK_COMMENT;
+          ++i;
+        }
+        break;
+      case LEX_STRING:
+        if (c == '\n' || (c == '\\' && next == '\n')) {
+          if (multiline_strings)
+            *multiline_strings = true;
+        }
+        if (c == '\\')
+          ++i;
+        else if (c == '"')
+          state = LEX_CODE;
+        break;
+      case LEX_LINE_COMMENT:
+        if (c == '\n')
+          state = LEX_CODE;
+        break;
+      case LEX_BLOCK_COMMENT:
+        if (c == '*' && next == '/') {
+          state = LEX_CODE;
+          ++i;
+        }
+        break;
+    }
+  }
+  return state;
+}
+
+// Where the lexer would say byte `offset` of `src` is
+static YYLTYPE loc_at(const std::string &src, size_t offset) {
+  int line = 1;
+  size_t line_start = 0;
+  for (size_t i = 0; i < offset; ++i) {
+    if (src[i] == '\n') {
+      ++line;
+      line_start = i + 1;
+    }
+  }
+  int column = (int)(offset - line_start) + 1;
+  return {line, column, line, column};
+}
+
+static bool pos_less(int line_a, int col_a, int line_b, int col_b) {
+  return line_a < line_b || (line_a == line_b && col_a < col_b);
+}
+
+// Move a position that came after an edit along with the text that followed it.
+// Ends of ranges are exclusive, so one ending right where the edit was stays put.
+static void shift_pos(int &line, int &column, const YYLTYPE &edit_end, const YYLTYPE &new_end, bool is_end) {
+  if (pos_less(line, column, edit_end.first_line, edit_end.first_column))
+    return;
+  if (is_end && line == edit_end.first_line && column == edit_end.first_column)
+    return;
+  if (line == edit_end.first_line)
+    column += new_end.first_column - edit_end.first_column;
+  line += new_end.first_line - edit_end.first_line;
+}
+
+static void shift_loc(YYLTYPE *loc, const YYLTYPE &edit_end, const YYLTYPE &new_end) {
+  shift_pos(loc->first_line, loc->first_column, edit_end, new_end, false);
+  shift_pos(loc->last_line, loc->last_column, edit_end, new_end, true);
+}
+
+static void shift_node_locs(LSLASTNode *node, LSLASTNode *skip, const YYLTYPE &edit_end, const YYLTYPE &new_end) {
+  if (node == skip)
+    return;
+  shift_loc(node->getLoc(), edit_end, new_end);
+  for (auto *child : *node)
+    shift_node_locs(child, skip, edit_end, new_end);
+}
+
+static void collect_tables(LSLASTNode *node, std::vector<LSLSymbolTable *> &tables) {
+  if (auto *table = node->getSymbolTable())
+    tables.push_back(table);
+  for (auto *child : *node)
+    collect_tables(child, tables);
+}
+
+// Whether other parts of the script could depend on anything about `new_node`
+// other than what's the same in `old_node`.
+static bool same_signature(LSLASTNode *old_node, LSLASTNode *new_node) {
+  auto *old_id = (LSLIdentifier *)old_node->getChild(0);
+  auto *new_id = (LSLIdentifier *)new_node->getChild(0);
+  if (strcmp(old_id->getName(), new_id->getName()) != 0 || old_id->getIType() != new_id->getIType())
+    return false;
+  if (old_node->getNodeType() == NODE_STATE)
+    return true;
+  auto *old_params = old_node->getChild(1);
+  auto *new_params = new_node->getChild(1);
+  if (old_params->getNumChildren() != new_params->getNumChildren())
+    return false;
+  for (int i = 0; i < old_params->getNumChildren(); ++i) {
+    if (old_params->getChild(i)->getIType() != new_params->getChild(i)->getIType())
+      return false;
+  }
+  return true;
+}
+
+
+IncrementalScript::IncrementalScript(bool mono_semantics) : _mMonoSemantics(mono_semantics) {}
+
+LSLScript *IncrementalScript::setSource(std::string source) {
+  _mSource = std::move(source);
+  _mWasIncremental = false;
+  parseFull();
+  return _mParser.script;
+}
+
+bool IncrementalScript::applyEdit(size_t offset, size_t removed, const std::string &text) {
+  if (offset > _mSource.size() || removed > _mSource.size() - offset)
+    return false;
+
+  _mWasIncremental = false;
+  if (_mCanEdit && _mParser.allocator.getStats().bytes_used < _mFullParseBytes * MAX_ARENA_GROWTH) {
+    bool in_item = false;
+    for (size_t i = 0; i < _mItems.size(); ++i) {
+      // the first and last tokens have to survive for it to still be the same item
+      if (offset > _mItems[i].start && offset + removed < _mItems[i].end) {
+        _mWasIncremental = editItem(i, offset, removed, text);
+        in_item = true;
+        break;
+      }
+    }
+    if (!in_item)
+      _mWasIncremental = editWhitespace(offset, removed, text);
+  }
+
+  if (!_mWasIncremental) {
+    _mSource.replace(offset, removed, text);
+    parseFull();
+  }
+  return true;
+}
+
+void IncrementalScript::parseFull() {
+  _mParser.reset();
+  _mItems.clear();
+  _mLintMessages.clear();
+  _mCanEdit = false;
+
+  auto *script = _mParser.parseLSLBytes(_mSource.c_str(), (int)_mSource.size());
+  if (!script)
+    return;
+  // anything logged so far is a syntax error, the tree might not line up with the source.
+  bool syntax_errors = !_mParser.logger.getMessages().empty();
+  script->analyze(_mMonoSemantics, false);
+  script->validateGlobals(_mMonoSemantics);
+  runLintPasses();
+
+  _mCanEdit = !syntax_errors && _mParser.ast_sane && collectItems();
+  _mFullParseBytes = _mParser.allocator.getStats().bytes_used;
+}
+
+bool IncrementalScript::collectItems() {
+  bool multiline_strings = false;
+  scan_lex_state(_mSource, _mSource.size(), &multiline_strings);
+  if (multiline_strings)
+    return false;
+
+  std::vector<size_t> line_starts {0};
+  for (size_t i = 0; i < _mSource.size(); ++i) {
+    if (_mSource[i] == '\n')
+      line_starts.push_back(i + 1);
+  }
+  auto offset_of = [&](int line, int column) -> size_t {
+    if (line < 1 || (size_t)line > line_starts.size() || column < 1)
+      return std::string::npos;
+    size_t offset = line_starts[line - 1] + column - 1;
+    return offset <= _mSource.size() ? offset : std::string::npos;
+  };
+
+  auto *script = _mParser.script;
+  size_t prev_end = 0;
+  for (LSLASTNode *list : {(LSLASTNode *)script->getGlobals(), (LSLASTNode *)script->getStates()}) {
+    for (auto *node : *list) {
+      auto *loc = node->getLoc();
+      size_t start = offset_of(loc->first_line, loc->first_column);
+      size_t end = offset_of(loc->last_line, loc->last_column);
+      if (start == std::string::npos || end == std::string::npos || start < prev_end || end <= start)
+        return false;
+      // make sure the positions really do line up with the source
+      char last_char = node->getNodeType() == NODE_GLOBAL_VARIABLE ? ';' : '}';
+      if (_mSource[end - 1] != last_char)
+        return false;
+      _mItems.push_back({node, start, end});
+      prev_end = end;
+    }
+  }
+  return true;
+}
+
+void IncrementalScript::runLintPasses() {
+  size_t num_messages = _mParser.logger.getMessages().size();
+  _mParser.script->checkSymbols();
+  auto &messages = _mParser.logger.getMessages();
+  _mLintMessages.assign(messages.begin() + (ptrdiff_t)num_messages, messages.end());
+}
+
+bool IncrementalScript::canShiftMessages(const YYLTYPE &edit_end, const YYLTYPE &new_end) {
+  if (edit_end.first_line == new_end.first_line && edit_end.first_column == new_end.first_column)
+    return true;
+  // these mention the position of another declaration in their text, which we can't update.
+  for (auto *message : _mParser.logger.getMessages()) {
+    if (message->getError() == E_DUPLICATE_DECLARATION || message->getError() == W_SHADOW_DECLARATION)
+      return false;
+  }
+  return true;
+}
+
+void IncrementalScript::shiftLocations(LSLASTNode *skip, const YYLTYPE &edit_end, const YYLTYPE &new_end) {
+  if (edit_end.first_line == new_end.first_line && edit_end.first_column == new_end.first_column)
+    return;
+  shift_node_locs(_mParser.script, skip, edit_end, new_end);
+  for (auto *table : _mParser.table_manager.getTables()) {
+    for (auto *symbol : table->getSymbols())
+      shift_loc(symbol->getLoc(), edit_end, new_end);
+  }
+  for (auto *message : _mParser.logger.getMessages()) {
+    YYLTYPE loc = *message->getLoc();
+    shift_loc(&loc, edit_end, new_end);
+    if (memcmp(&loc, message->getLoc(), sizeof(loc)) != 0)
+      _mParser.logger.relocateMessage(message, loc);
+  }
+  shift_loc(&_mParser.context.glloc, edit_end, new_end);
+}
+
+bool IncrementalScript::editWhitespace(size_t offset, size_t removed, const std::string &text) {
+  auto is_space = [](char c) { return c == ' ' || c == '\t' || c == '\r' || c == '\n'; };
+  for (size_t i = offset; i < offset + removed; ++i) {
+    if (!is_space(_mSource[i]))
+      return false;
+  }
+  for (char c : text) {
+    if (!is_space(c))
+      return false;
+  }
+  // whitespace can't go inside tokens or comments without changing what they mean
+  for (auto &item : _mItems) {
+    if (offset < item.end && offset + removed > item.start)
+      return false;
+  }
+  if (scan_lex_state(_mSource, offset) != LEX_CODE)
+    return false;
+
+  std::string new_source = _mSource;
+  new_source.replace(offset, removed, text);
+  YYLTYPE edit_end = loc_at(_mSource, offset + removed);
+  YYLTYPE new_end = loc_at(new_source, offset + text.size());
+  if (!canShiftMessages(edit_end, new_end))
+    return false;
+
+  ScopedPass pass(&_mParser.context, "incremental");
+  shiftLocations(nullptr, edit_end, new_end);
+  for (auto &item : _mItems) {
+    if (item.start >= offset + removed) {
+      item.start = item.start + text.size() - removed;
+      item.end = item.end + text.size() - removed;
+    }
+  }
+  _mSource = std::move(new_source);
+  return true;
+}
+
+bool IncrementalScript::editItem(size_t item_idx, size_t offset, size_t removed, const std::string &text) {
+  auto &item = _mItems[item_idx];
+  LSLASTNode *old_node = item.node;
+  auto node_type = old_node->getNodeType();
+  // global variables can change the constant value of anything that uses them
+  if (node_type != NODE_GLOBAL_FUNCTION && node_type != NODE_STATE)
+    return false;
+
+  auto *script = _mParser.script;
+  auto *symbol = old_node->getSymbol();
+  // Duplicate or shadowing declarations get diagnostics from the pass over all the
+  // global declarations, and we only re-run the passes over this one's body.
+  if (!symbol)
+    return false;
+  auto *global_table = script->getSymbolTable();
+  if (global_table->lookupAtom(symbol->getName()) != symbol || global_table->countAtom(symbol->getName()) != 1)
+    return false;
+  if (_mParser.context.builtins->lookup(symbol->getName()))
+    return false;
+
+  std::string new_source = _mSource;
+  new_source.replace(offset, removed, text);
+  size_t new_item_end = item.end + text.size() - removed;
+  std::string item_text = new_source.substr(item.start, new_item_end - item.start);
+  bool multiline_strings = false;
+  if (scan_lex_state(item_text, item_text.size(), &multiline_strings) != LEX_CODE || multiline_strings)
+    return false;
+
+  YYLTYPE old_loc = *old_node->getLoc();
+  YYLTYPE edit_end = loc_at(_mSource, offset + removed);
+  YYLTYPE new_edit_end = loc_at(new_source, offset + text.size());
+  if (!canShiftMessages(edit_end, new_edit_end))
+    return false;
+
+  ScopedPass pass(&_mParser.context, "incremental");
+
+  // Parse just this function or state, padded so it lands at the same position
+  // it has in the script, with whatever else it takes to be a valid script.
+  std::string fragment;
+  bool other_state = node_type == NODE_STATE && strcmp(symbol->getName(), "default") != 0;
+  if (other_state)
+    fragment += FRAGMENT_DEFAULT_STATE;
+  if (old_loc.first_line > 1) {
+    fragment.append(old_loc.first_line - 1, '\n');
+    fragment.append(old_loc.first_column - 1, ' ');
+  } else if (fragment.size() <= (size_t)old_loc.first_column - 1) {
+    fragment.append(old_loc.first_column - 1 - fragment.size(), ' ');
+  } else {
+    return false;
+  }
+  fragment += item_text;
+  if (node_type == NODE_GLOBAL_FUNCTION) {
+    fragment += ' ';
+    fragment += FRAGMENT_DEFAULT_STATE;
+  }
+
+  size_t num_messages = _mParser.logger.getMessages().size();
+  auto *fragment_script = _mParser.parseFragment(fragment.c_str(), (int)fragment.size());
+  if (!fragment_script || _mParser.logger.getMessages().size() != num_messages)
+    return false;
+  LSLASTNode *new_node;
+  if (node_type == NODE_GLOBAL_FUNCTION) {
+    auto *globals = fragment_script->getGlobals();
+    if (globals->getNumChildren() != 1)
+      return false;
+    new_node = globals->getChild(0);
+  } else {
+    auto *states = fragment_script->getStates();
+    if (states->getNumChildren() != (other_state ? 2 : 1))
+      return false;
+    new_node = states->getChild(states->getNumChildren() - 1);
+  }
+  if (new_node->getNodeType() != node_type || !same_signature(old_node, new_node))
+    return false;
+
+  // whether each global is ever assigned to decides whether it's constant everywhere
+  std::vector<std::pair<LSLSymbol *, bool>> globals_assigned;
+  for (auto *global : script->getSymbolTable()->getSymbols()) {
+    if (global->getSymbolType() == SYM_VARIABLE)
+      globals_assigned.emplace_back(global, global->getAssignments() != 0);
+  }
+
+  // Nothing's been touched so far, from here on out we're committed to changing the tree.
+  // Everything said about the old version is going away along with it.
+  std::unordered_set<LogMessage *> lint_messages(_mLintMessages.begin(), _mLintMessages.end());
+  _mLintMessages.clear();
+  _mParser.logger.removeMessagesIf([&](LogMessage *message) {
+    auto *loc = message->getLoc();
+    if (lint_messages.count(message))
+      return true;
+    return !pos_less(loc->first_line, loc->first_column, old_loc.first_line, old_loc.first_column)
+        && pos_less(loc->first_line, loc->first_column, old_loc.last_line, old_loc.last_column);
+  });
+  std::vector<LSLSymbolTable *> old_tables;
+  collect_tables(old_node, old_tables);
+
+  LSLASTNode::replaceNode(old_node, new_node);
+  shiftLocations(new_node, edit_end, new_edit_end);
+
+  // The symbol is shared with everything that refers to it, so update it in place.
+  if (node_type == NODE_GLOBAL_FUNCTION) {
+    symbol->setFunctionDecl(((LSLGlobalFunction *)new_node)->getArguments());
+    *symbol->getLoc() = *new_node->getLoc();
+  } else {
+    *symbol->getLoc() = *new_node->getChild(0)->getLoc();
+  }
+
+  {
+    ScopedPass symbols_pass(&_mParser.context, "symbols");
+    size_t num_tables = _mParser.table_manager.getTables().size();
+    SymbolResolutionVisitor resolver(true, &_mParser.allocator);
+    resolver.resolveReplacement(new_node, symbol);
+
+    // The new tables were registered at the end, put them where the old ones were
+    // so mangled names come out the same as they would after a full parse.
+    std::vector<LSLSymbolTable *> tables = _mParser.table_manager.getTables();
+    std::vector<LSLSymbolTable *> new_tables(tables.begin() + (ptrdiff_t)num_tables, tables.end());
+    tables.resize(num_tables);
+    std::unordered_set<LSLSymbolTable *> old_nested(old_tables.begin() + 1, old_tables.end());
+    std::vector<LSLSymbolTable *> reordered;
+    bool placed_nested = false;
+    for (auto *table : tables) {
+      if (table == old_tables[0]) {
+        reordered.push_back(new_tables[0]);
+      } else if (old_nested.count(table)) {
+        if (!placed_nested)
+          reordered.insert(reordered.end(), new_tables.begin() + 1, new_tables.end());
+        placed_nested = true;
+      } else {
+        reordered.push_back(table);
+      }
+    }
+    if (!placed_nested)
+      reordered.insert(reordered.end(), new_tables.begin() + 1, new_tables.end());
+    _mParser.table_manager.setTables(std::move(reordered));
+  }
+  {
+    ScopedPass types_pass(&_mParser.context, "types");
+    TypeCheckVisitor type_visitor;
+    new_node->visit(&type_visitor);
+  }
+
+  // It wasn't resolved yet when it was swapped in, so nothing in it was counted.
+  track_subtree_usage(new_node);
+  script->recalculateReferenceData();
+  for (auto &global : globals_assigned) {
+    if ((global.first->getAssignments() != 0) != global.second)
+      return false;
+  }
+
+  {
+    ScopedPass values_pass(&_mParser.context, "values");
+    FinalPassVisitor final_visitor(false);
+    TailslideOperationBehavior behavior(&_mParser.allocator, true);
+    ConstantDeterminingVisitor values_visitor(&behavior, &_mParser.allocator);
+    values_visitor.setFinalPass(&final_visitor);
+    new_node->visit(&values_visitor);
+  }
+  runLintPasses();
+
+  item.node = new_node;
+  item.end = new_item_end;
+  for (size_t i = item_idx + 1; i < _mItems.size(); ++i) {
+    _mItems[i].start = _mItems[i].start + text.size() - removed;
+    _mItems[i].end = _mItems[i].end + text.size() - removed;
+  }
+  _mSource = std::move(new_source);
+  return true;
+}
+
+}
@@ -0,0 +1,67 @@
+#ifndef TAILSLIDE_INCREMENTAL_HH
+#define TAILSLIDE_INCREMENTAL_HH
+
+#include <string>
+#include <vector>
+
+#include "tailslide.hh"
+
+namespace Tailslide {
+
+/// A script that stays parsed and analyzed while its source is edited, for editors
+/// that want diagnostics on every change. When an edit falls inside a single global
+/// function or state and leaves its signature alone only that function or state is
+/// re-parsed and re-analyzed, anything else re-parses the whole script.
+///
+/// The tree is analyzed the same way `tailslide --lint` would, but never optimized.
+/// Don't optimize or compile it in place, the next edit expects it untouched.
+class IncrementalScript {
+  public:
+    explicit IncrementalScript(bool mono_semantics = true);
+
+    /// Replace the whole source, parsing and analyzing it from scratch
+    LSLScript *setSource(std::string source);
+    /// Replace `removed` bytes at `offset` with `text`, re-parsing as little as possible.
+    /// Returns false without changing anything if the range is out of bounds.
+    bool applyEdit(size_t offset, size_t removed, const std::string &text);
+
+    const std::string &getSource() const { return _mSource; }
+    /// nullptr if the source had syntax errors
+    LSLScript *getScript() { return _mParser.script; }
+    Logger &getLogger() { return _mParser.logger; }
+    ScopedScriptParser &getParser() { return _mParser; }
+    /// Whether the last edit got away without re-parsing the whole script
+    bool wasIncremental() const { return _mWasIncremental; }
+
+  private:
+    // A global variable, global function or state along with where it is in `_mSource`
+    struct TopLevelItem {
+      LSLASTNode *node;
+      size_t start;
+      size_t end;
+    };
+
+    void parseFull();
+    bool collectItems();
+    bool editItem(size_t item_idx, size_t offset, size_t removed, const std::string &text);
+    bool editWhitespace(size_t offset, size_t removed, const std::string &text);
+    bool canShiftMessages(const YYLTYPE &edit_end, const YYLTYPE &new_end);
+    void shiftLocations(LSLASTNode *skip, const YYLTYPE &edit_end, const YYLTYPE &new_end);
+    void runLintPasses();
+
+    ScopedScriptParser _mParser {nullptr};
+    bool _mMonoSemantics;
+    std::string _mSource;
+    std::vector<TopLevelItem> _mItems;
+    // messages from `checkSymbols()`, which depend on the whole script and get redone after every edit
+    std::vector<class LogMessage *> _mLintMessages;
+    // false if positions in the tree can't be trusted to match the source, or it had syntax errors
+    bool _mCanEdit = false;
+    bool _mWasIncremental = false;
+    // arena usage right after the last full parse, superseded nodes aren't freed until the next one.
+    size_t _mFullParseBytes = 0;
+};
+
+}
+
+#endif
@@ -1,4 +1,6 @@
+#include <cassert>
 #include <cstdarg>
+#include <cstring>
 #include <vector>
 #include <algorithm>
 #include "logger.hh"
@@ -6,8 +8,6 @@
 
 namespace Tailslide {
 
-#define LOG_BUF_LEFT (1024 - (bp - buf))
-
 void Logger::reset() {
   _mMessages.clear();
   _mAssertions.clear();
@@ -17,6 +17,88 @@ void Logger::reset() {
   _mCheckAssertions = false;
 }
 
+void Logger::removeMessagesIf(const std::function<bool(LogMessage *)> &pred) {
+  auto new_end = std::remove_if(_mMessages.begin(), _mMessages.end(), [&](LogMessage *message) {
+    if (!pred(message))
+      return false;
+    if (message->getType() == LOG_ERROR)
+      --_mErrors;
+    else if (message->getType() == LOG_WARN)
+      --_mWarnings;
+    return true;
+  });
+  _mMessages.erase(new_end, _mMessages.end());
+}
+
+void Logger::relocateMessage(LogMessage *message, const YYLTYPE &loc) {
+  // messages logged without a location have nothing to update
+  if (message->_mShowLoc)
+    message->setLoc(loc);
+}
+
+void Logger::suppressCode(ErrorCode code, bool suppress) {
+  if (code > E_ERROR && code < E_LAST)
+    _mSuppressedErrors.set(code - E_ERROR, suppress);
+  else if (code > W_WARNING && code < W_LAST)
+    _mSuppressedWarnings.set(code - W_WARNING, suppress);
+}
+
+bool Logger::isSuppressed(int code) const {
+  if (code > E_ERROR && code < E_LAST)
+    return _mSuppressedErrors.test(code - E_ERROR);
+  if (code > W_WARNING && code < W_LAST)
+    return _mSuppressedWarnings.test(code - W_WARNING);
+  return false;
+}
+
+static_assert(E_LAST - E_ERROR <= 64, "too many error codes for the suppression bitset");
+static_assert(W_LAST - W_WARNING <= 64, "too many warning codes for the suppression bitset");
+
+// Parse the printf conversion whose '%' is at `fp`, returning a pointer just past it.
+// `arg_idx` is which argument it uses, `spec` gets the conversion without any "n$"
+// so it can be handed to snprintf on its own. Returns `fp + 2` with `conversion`
+// set to '%' for a literal percent sign.
+static const char *parse_conversion(const char *fp, int &next_arg, int &arg_idx, char &conversion, std::string *spec) {
+  const char *p = fp + 1;
+  if (*p == '%') {
+    conversion = '%';
+    return p + 1;
+  }
+  const char *spec_start = p;
+  int position = 0;
+  while (*p >= '0' && *p <= '9')
+    position = position * 10 + (*p++ - '0');
+  if (*p == '$' && position > 0) {
+    arg_idx = position - 1;
+    spec_start = ++p;
+  } else {
+    arg_idx = next_arg;
+    p = spec_start;
+  }
+  next_arg = arg_idx + 1;
+  // flags, width and precision
+  while (*p && strchr("-+ #0123456789.", *p))
+    ++p;
+  conversion = *p;
+  if (*p)
+    ++p;
+  if (spec) {
+    *spec = "%";
+    spec->append(spec_start, p);
+  }
+  return p;
+}
+
+// Write the "(line,col): " part of a message to `report`
+static void format_message_loc(std::string &report, const YYLTYPE *yylloc, bool show_end) {
+  char buf[64];
+  int len = snprintf(buf, sizeof(buf), "(%3d,%3d)", yylloc->first_line, yylloc->first_column);
+  if (show_end)
+    len += snprintf(buf + len, sizeof(buf) - len, "-(%3d,%3d)", yylloc->last_line, yylloc->last_column);
+  report.append(buf, len);
+  report += ": ";
+}
+
 void Logger::log(LogLevel level, YYLTYPE *yylloc, const char *fmt, ...) {
   va_list args;
   va_start(args, fmt);
@@ -25,86 +107,121 @@ void Logger::log(LogLevel level, YYLTYPE *yylloc, const char *fmt, ...) {
 }
 
 void Logger::error(YYLTYPE *yylloc, int error, ...) {
-  // FIXME: magic numbers
-  char buf[1025] = {0};
-  char *bp = buf;
-  const char *fmt;
-  const char *fp;
   LogLevel level = (error < W_WARNING) ? LOG_ERROR : LOG_WARN;
-  va_list args;
-
-  // pick out the format string to tack onto the end of the message
+  const char *fmt;
+  // pick out the format string for the message
   if (level == LOG_ERROR) {
     fmt = _sErrorMessages[(int) (error - E_ERROR)];
   } else {
     fmt = _sWarningMessages[(int) (error - W_WARNING)];
   }
 
-  if (_mCheckAssertions) {
-    // if we're checking assertions, messages will be removed by matching assertions,
-    // so we just add "Unexpected" to all of them.
-    bp += snprintf(bp, LOG_BUF_LEFT, level == LOG_ERROR ? "Unexpected error: " : "Unexpected warning: ");
-
-    // upgrade everything to error
-    level = LOG_ERROR;
-  }
-
-  if (_mShowErrorCodes) {
-    bp += snprintf(bp, LOG_BUF_LEFT, "[E%d] ", (int) error);
-  }
-
-  // copy the format string for the error itself to the end
-  for (fp = fmt; *fp && LOG_BUF_LEFT; ++fp) {
-    *bp++ = *fp;
-  }
-
+  va_list args;
   va_start(args, error);
-  logv(level, yylloc, buf, args, error);
+  logv(level, yylloc, fmt, args, error);
   va_end(args);
 }
 
 
 void Logger::logv(LogLevel level, YYLTYPE *yylloc, const char *fmt, va_list args, int error) {
-  const char *type = nullptr;
-  char buf[1025] = {0};
-  char *bp = buf;
   switch (level) {
     case LOG_ERROR:
-      type = "ERROR";
-      ++_mErrors;
-      break;
     case LOG_WARN:
-      type = "WARN";
-      ++_mWarnings;
       break;
     case LOG_INFO:
       if (!_mShowInfo) return;
-      type = "INFO";
       break;
     case LOG_DEBUG:
     case LOG_DEBUG_MINOR:
     case LOG_DEBUG_SPAM:
 #ifdef DEBUG_LEVEL
       if ( DEBUG_LEVEL < level ) return;
-      type = "DEBUG";
 #else /* not DEBUG_LEVEL */
       return;
 #endif /* not DEBUG_LEVEL */
       break;
     default:
-      type = "OTHER";
       break;
   }
 
-  bp += snprintf(bp, LOG_BUF_LEFT, "%5s:: ", type);
-  if (yylloc != nullptr) {
-    bp += snprintf(bp, LOG_BUF_LEFT, "(%3d,%3d)", yylloc->first_line, yylloc->first_column);
-    if (_mShowEnd)
-      bp += snprintf(bp, LOG_BUF_LEFT, "-(%3d,%3d)", yylloc->last_line, yylloc->last_column);
-    bp += snprintf(bp, LOG_BUF_LEFT, ": ");
+  // Filter before anything gets stored, suppressed errors only get counted.
+  bool suppressed = isSuppressed(error);
+  if (level != LOG_ERROR && (level > _mMaxLevel || suppressed))
+    return;
+
+  bool unexpected = false;
+  if (_mCheckAssertions && (level == LOG_ERROR || level == LOG_WARN) && error) {
+    // if we're checking assertions, messages will be removed by matching assertions,
+    // so we just add "Unexpected" to all of them and upgrade everything to error.
+    unexpected = true;
+    level = LOG_ERROR;
+  }
+  if (level == LOG_ERROR)
+    ++_mErrors;
+  else if (level == LOG_WARN)
+    ++_mWarnings;
+  if (!_mStoreMessages || suppressed)
+    return;
+
+  auto *message = _mAllocator->newTracked<LogMessage>(level, yylloc, fmt, (ErrorCode) error);
+  message->_mShowLoc = yylloc != nullptr;
+  message->_mShowEnd = _mShowEnd;
+  message->_mShowErrorCode = _mShowErrorCodes && error;
+  message->_mUnexpected = unexpected;
+
+  // Pull the arguments out now while we know their types, strings might not live
+  // as long as the message so they need copies. Only plain string, int and char
+  // conversions can be kept for later, anything else gets formatted right away.
+  char types[MAX_LOG_ARGS] = {0};
+  int num_args = 0;
+  int next_arg = 0;
+  bool deferrable = true;
+  for (const char *fp = fmt; *fp;) {
+    if (*fp != '%') {
+      ++fp;
+      continue;
+    }
+    int arg_idx;
+    char conversion;
+    fp = parse_conversion(fp, next_arg, arg_idx, conversion, nullptr);
+    if (conversion == '%')
+      continue;
+    if (arg_idx >= MAX_LOG_ARGS || !conversion || !strchr("sdic", conversion)) {
+      deferrable = false;
+      break;
+    }
+    types[arg_idx] = conversion;
+    num_args = std::max(num_args, arg_idx + 1);
+  }
+  // can't tell what type an argument that's never used has
+  for (int i = 0; i < num_args; ++i)
+    deferrable = deferrable && types[i];
+
+  if (!deferrable) {
+    va_list size_args;
+    va_copy(size_args, args);
+    int len = std::max(vsnprintf(nullptr, 0, fmt, size_args), 0);
+    va_end(size_args);
+    std::string formatted(len, '\0');
+    vsnprintf(&formatted[0], len + 1, fmt, args);
+    message->_mFormat = _mAllocator->copyStr(formatted.c_str());
+    message->_mPreformatted = true;
+    _mMessages.push_back(message);
+    return;
+  }
+
+  for (int i = 0; i < num_args; ++i) {
+    auto &arg = message->_mArgs[i];
+    arg.is_string = types[i] == 's';
+    if (arg.is_string) {
+      const char *str = va_arg(args, const char *);
+      arg.str_val = _mAllocator->copyStr(str ? str : "(null)");
+    } else {
+      arg.int_val = va_arg(args, int);
+    }
   }
-  bp += vsnprintf(bp, LOG_BUF_LEFT, fmt, args);
-  _mMessages.push_back(_mAllocator->newTracked<LogMessage>(level, yylloc, buf, (ErrorCode) error));
+  message->_mNumArgs = num_args;
+  _mMessages.push_back(message);
 }
 
 struct LogMessageSort {
@@ -156,22 +273,104 @@ void Logger::finalize() {
 }
 
 void Logger::printReport() {
+  fputs(formatReport().c_str(), stderr);
+}
+
+std::string Logger::formatReport() {
   finalize();
   if (_mSort)
     std::sort(_mMessages.begin(), _mMessages.end(), LogMessageSort());
 
-  std::vector<LogMessage *>::iterator i;
-  for (i = _mMessages.begin(); i != _mMessages.end(); ++i)
-    fprintf(stderr, "%s\n", (*i)->getMessage().c_str());
+  std::string report;
+  for (auto *message : _mMessages) {
+    report += message->getMessage();
+    report += '\n';
+  }
+  report += "TOTAL:: Errors: " + std::to_string(_mErrors) + "  Warnings: " + std::to_string(_mWarnings) + "\n";
+  return report;
+}
+
+std::vector<Diagnostic> Logger::getDiagnostics() {
+  finalize();
+  if (_mSort)
+    std::sort(_mMessages.begin(), _mMessages.end(), LogMessageSort());
 
-  fprintf(stderr, "TOTAL:: Errors: %d  Warnings: %d\n", _mErrors, _mWarnings);
+  std::vector<Diagnostic> diagnostics;
+  diagnostics.reserve(_mMessages.size());
+  for (auto *message : _mMessages)
+    diagnostics.push_back({message->getType(), message->getError(), *message->getLoc(), message->getText()});
+  return diagnostics;
 }
 
-LogMessage::LogMessage(ScriptContext *ctx, LogLevel type, YYLTYPE *loc, const char *message, ErrorCode error)
-    : TrackableObject(ctx), _mLogType(type), _mLoc({}), _mErrorCode(error) {
+LogMessage::LogMessage(ScriptContext *ctx, LogLevel type, YYLTYPE *loc, const char *fmt, ErrorCode error)
+    : TrackableObject(ctx), _mLogType(type), _mLoc({}), _mFormat(fmt), _mErrorCode(error) {
   if (loc) _mLoc = *loc;
-  assert (message != nullptr);
-  _mMessage = message;
+  assert (fmt != nullptr);
+}
+
+std::string LogMessage::getMessage() {
+  const char *type;
+  switch (_mLogType) {
+    case LOG_ERROR: type = "ERROR"; break;
+    case LOG_WARN: type = "WARN"; break;
+    case LOG_INFO: type = "INFO"; break;
+    case LOG_DEBUG:
+    case LOG_DEBUG_MINOR:
+    case LOG_DEBUG_SPAM:
+      type = "DEBUG"; break;
+    default: type = "OTHER"; break;
+  }
+
+  char buf[64];
+  snprintf(buf, sizeof(buf), "%5s:: ", type);
+  std::string message = buf;
+  if (_mShowLoc)
+    format_message_loc(message, &_mLoc, _mShowEnd);
+  if (_mUnexpected)
+    message += _mErrorCode < W_WARNING ? "Unexpected error: " : "Unexpected warning: ";
+  if (_mShowErrorCode) {
+    snprintf(buf, sizeof(buf), "[E%d] ", (int) _mErrorCode);
+    message += buf;
+  }
+  return message + getText();
+}
+
+std::string LogMessage::getText() {
+  if (_mPreformatted)
+    return _mFormat;
+  std::string message;
+  int next_arg = 0;
+  for (const char *fp = _mFormat; *fp;) {
+    const char *literal_end = strchr(fp, '%');
+    if (!literal_end) {
+      message += fp;
+      break;
+    }
+    message.append(fp, literal_end);
+    int arg_idx;
+    char conversion;
+    std::string spec;
+    fp = parse_conversion(literal_end, next_arg, arg_idx, conversion, &spec);
+    if (conversion == '%') {
+      message += '%';
+      continue;
+    }
+    if (arg_idx >= _mNumArgs)
+      continue;
+    auto &arg = _mArgs[arg_idx];
+    int len;
+    if (arg.is_string)
+      len = snprintf(nullptr, 0, spec.c_str(), arg.str_val);
+    else
+      len = snprintf(nullptr, 0, spec.c_str(), arg.int_val);
+    std::string formatted(len, '\0');
+    if (arg.is_string)
+      snprintf(&formatted[0], len + 1, spec.c_str(), arg.str_val);
+    else
+      snprintf(&formatted[0], len + 1, spec.c_str(), arg.int_val);
+    message += formatted;
+  }
+  return message;
 }
 
 
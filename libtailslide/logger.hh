@@ -1,8 +1,10 @@
 #ifndef _LOGGER_HH
 #define _LOGGER_HH 1
 
+#include <bitset>
 #include <cstdlib>
 #include <cstdio>
+#include <functional>
 #include <vector>
 #include <string>
 #include <utility>  // pair
@@ -97,18 +99,37 @@ enum ErrorCode {
 #define NODE_ERROR(node, ...) do {(node)->mContext->logger->error((node)->getLoc(), __VA_ARGS__);} while(0)
 #endif
 
+/// A message with its parts pulled apart, for reporting in formats other than `formatReport()`'s
+struct Diagnostic {
+  LogLevel level;
+  ErrorCode code;
+  YYLTYPE loc;
+  // without the level, location or code
+  std::string message;
+};
+
 class Logger {
   public:
     explicit Logger(ScriptAllocator *allocator) :
         _mErrors(0), _mWarnings(0), _mShowEnd(false), _mShowInfo(false), _mSort(true),
         _mShowErrorCodes(true), _mCheckAssertions(false),
-        _mFinalized(false), _mAllocator(allocator) {};
+        _mFinalized(false), _mStoreMessages(true), _mMaxLevel(LOG_DEBUG_SPAM), _mAllocator(allocator) {};
+    /// `fmt` isn't formatted until the message is, so it has to outlive the logger.
+    /// Formats using conversions other than %s, %d, %i and %c are formatted right away.
     void log(LogLevel type, YYLTYPE *loc, const char *fmt, ...);
     void logv(LogLevel type, YYLTYPE *loc, const char *fmt, va_list args, int error=0);
     void error( YYLTYPE *loc, int error, ... );
     void printReport();
+    /// The same text `printReport()` would print
+    std::string formatReport();
+    /// Every message, in the same order `formatReport()` would list them
+    std::vector<Diagnostic> getDiagnostics();
     void reset();
     void finalize();
+    /// Drop every message `pred` returns true for, along with its error or warning count
+    void removeMessagesIf(const std::function<bool(class LogMessage *)> &pred);
+    /// Point a message at a new location, like when the code it's about moved
+    void relocateMessage(class LogMessage *message, const YYLTYPE &loc);
 
     const std::vector<class LogMessage*> & getMessages() const { return _mMessages; };
     int     getErrors() const    { return _mErrors;    }
@@ -120,11 +141,24 @@ class Logger {
     void    setCheckAssertions(bool v) { _mCheckAssertions = v; }
     void    filterAssertErrors();
 
+    /// Only count messages instead of keeping them around, for when just the totals matter.
+    /// Assertions can't be checked without the messages.
+    void    setStoreMessages(bool v) { _mStoreMessages = v; }
+    /// Drop anything less severe than `level` as it's logged, without counting it.
+    /// Errors are never dropped.
+    void    setMaxLevel(LogLevel level) { _mMaxLevel = level; }
+    /// Drop every `code` message as it's logged. Suppressed warnings aren't counted,
+    /// but errors still are so a broken script can't pass for a working one.
+    void    suppressCode(ErrorCode code, bool suppress=true);
+    bool    isSuppressed(int code) const;
+
     void    addAssertion(int line, ErrorCode error ) {
       _mAssertions.emplace_back(std::pair<int, ErrorCode>(line, error ) );
     }
 
   protected:
+    friend class LogMessage;
+
     int     _mErrors;
     int     _mWarnings;
     bool    _mShowEnd;
@@ -133,11 +167,15 @@ class Logger {
     bool    _mShowErrorCodes;
     bool    _mCheckAssertions;
     bool    _mFinalized;
+    bool    _mStoreMessages;
+    LogLevel _mMaxLevel;
     ScriptAllocator *_mAllocator;
 
     std::vector<class LogMessage*>    _mMessages;
     std::vector<ErrorCode>            _mErrorsSeen;
     std::vector<std::pair<int, ErrorCode>>    _mAssertions;
+    std::bitset<64>                   _mSuppressedErrors;
+    std::bitset<64>                   _mSuppressedWarnings;
     static const char *_sErrorMessages[];
     static const char *_sWarningMessages[];
 };
@@ -149,18 +187,40 @@ inline void DEBUG(LogLevel level, YYLTYPE *yylloc, const char *fmt, ...) {
   va_end(args);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// An argument to a log message's format string, kept until it's formatted
+struct LogArg {
+  bool is_string;
+  union {
+    int int_val;
+    const char *str_val;
+  };
+};
+
+const int MAX_LOG_ARGS = 6;
+
 ////////////////////////////////////////////////////////////////////////////////
 // Log message entry, for sorting
+// Only the format string and its arguments are kept, most messages are
+// counted and never looked at so formatting them up front is a waste.
 class LogMessage: public TrackableObject {
   public:
-    LogMessage( ScriptContext *ctx, LogLevel type, YYLTYPE *loc, const char *message, ErrorCode error );
+    LogMessage( ScriptContext *ctx, LogLevel type, YYLTYPE *loc, const char *fmt, ErrorCode error );
 
     LogLevel    getType() { return _mLogType; }
     YYLTYPE    *getLoc()  { return &_mLoc;  }
     ErrorCode   getError() { return _mErrorCode; }
-    const std::string &getMessage() { return _mMessage; }
+    /// Format the message the way it'll show up in the report
+    std::string getMessage();
+    /// Just the message itself, without the level, location or code
+    std::string getText();
+    void setLoc(const YYLTYPE &loc) { _mLoc = loc; }
+
+    static constexpr bool TRIVIAL_TEARDOWN = true;
 
   private:
+    friend class Logger;
+
     LogLevel            _mLogType;
 
     // we need our own copy of loc, because messages logged in the parser will be
@@ -168,10 +228,19 @@ class LogMessage: public TrackableObject {
     // be invalid when we go to sort.
     YYLTYPE             _mLoc;
 
-    std::string         _mMessage;
+    const char         *_mFormat;
     ErrorCode           _mErrorCode;
+    // how the logger was set up to show it when it was logged
+    bool                _mShowLoc = false;
+    bool                _mShowEnd = false;
+    bool                _mShowErrorCode = false;
+    // logged while checking assertions, so not expected to be there
+    bool                _mUnexpected = false;
+    // `_mFormat` is the finished text rather than a format string
+    bool                _mPreformatted = false;
+    int                 _mNumArgs = 0;
+    LogArg              _mArgs[MAX_LOG_ARGS] {};
 };
-
 }
 
 #endif
@@ -10,6 +10,9 @@
 #include "passes/tree_simplifier.hh"
 #include "passes/symbol_resolution.hh"
 #include "passes/globalexpr_validator.hh"
+#include "passes/type_checking.hh"
+#include "passes/values.hh"
+#include "passes/final_pass.hh"
 
 
 namespace Tailslide {
@@ -30,24 +33,36 @@ const char *DEPRECATED_FUNCTIONS[][2] = {
 
 // Lookup a symbol, propagating up the tree until it is found.
 LSLSymbol *LSLASTNode::lookupSymbol(const char *name, LSLSymbolType type) {
+  // If the name was never interned then no script symbol can have it and the
+  // lookups by address will all miss, but it could still be a builtin.
+  const char *atom = mContext->allocator->getAtoms().find(name);
+  return lookupAtom(atom ? atom : name, type);
+}
+
+LSLSymbol *LSLASTNode::lookupAtom(const char *atom, LSLSymbolType type) {
   LSLSymbol *sym = nullptr;
 
   // If we have a symbol table of our own, look for it there
-  if (_mSymbolTable)
-    sym = _mSymbolTable->lookup(name, type);
+  if (_mSymbolTable) {
+    if (mContext->profiler)
+      ++mContext->counters.symbol_lookups;
+    sym = _mSymbolTable->lookupAtom(atom, type);
+  }
 
   // If we have no symbol table, or it wasn't in it, but we have a parent, ask them
   if (sym == nullptr && getParent())
-    sym = getParent()->lookupSymbol(name, type);
+    sym = getParent()->lookupAtom(atom, type);
 
   return sym;
 }
 
-LSLSymbol *LSLScript::lookupSymbol(const char *name, LSLSymbolType sym_type) {
-  auto *sym = mContext->builtins->lookup(name, sym_type);
+LSLSymbol *LSLScript::lookupAtom(const char *atom, LSLSymbolType sym_type) {
+  if (mContext->profiler)
+    ++mContext->counters.symbol_lookups;
+  auto *sym = mContext->builtins->lookup(atom, sym_type);
   if (sym != nullptr)
     return sym;
-  return LSLASTNode::lookupSymbol(name, sym_type);
+  return LSLASTNode::lookupAtom(atom, sym_type);
 }
 
 // Define a symbol, propagating up the tree to the nearest scope level.
@@ -60,7 +75,7 @@ void LSLASTNode::defineSymbol(LSLSymbol *symbol) {
     DEBUG(LOG_DEBUG_SPAM, nullptr, "symbol definition caught in %s\n", getNodeName().c_str());
 
     // Check if already defined, if it exists in the current scope then shadowing is never allowed!
-    shadow = _mSymbolTable->lookup(symbol->getName());
+    shadow = _mSymbolTable->lookupAtom(symbol->getName());
     if (shadow) {
       if (shadow->getSymbolType() == SYM_EVENT)
         if (symbol->getSymbolType() == SYM_EVENT)
@@ -72,11 +87,11 @@ void LSLASTNode::defineSymbol(LSLSymbol *symbol) {
     } else {
       // Check for shadowed declarations
       if (getParent())
-        shadow = getParent()->lookupSymbol(symbol->getName(), symbol->getSymbolType());
+        shadow = getParent()->lookupAtom(symbol->getName(), symbol->getSymbolType());
       // If we still didn't find anything, look in the root scope for _any_ kind of symbol,
       // shadowing certain kinds of builtins can be problematic.
       if (shadow == nullptr && getRoot())
-        shadow = getRoot()->lookupSymbol(symbol->getName(), SYM_ANY);
+        shadow = getRoot()->lookupAtom(symbol->getName(), SYM_ANY);
 
       // define it for now even if it shadows so that we have something to work with.
       _mSymbolTable->define(symbol);
@@ -114,6 +129,7 @@ void LSLASTNode::defineSymbol(LSLSymbol *symbol) {
 
 // Define any symbols we have, and ask our children to
 void LSLASTNode::collectSymbols() {
+  ScopedPass pass(mContext, "symbols");
   SymbolResolutionVisitor visitor(true, mContext->allocator);
   this->visit(&visitor);
 }
@@ -128,7 +144,7 @@ void LSLASTNode::collectSymbols() {
 //    }
 //  But if "test" looked itself up, it would think it is an integer. It's parent function
 //  expression node can tell it what it needs to be before determining it's own type.
-void LSLIdentifier::resolveSymbol(LSLSymbolType symbol_type) {
+void LSLIdentifier::resolveSymbol(LSLSymbolType symbol_type, const LSLScopeChain *scopes) {
 
   // If we already have a symbol, we don't need to look it up.
   if (_mSymbol != nullptr) {
@@ -151,11 +167,15 @@ void LSLIdentifier::resolveSymbol(LSLSymbolType symbol_type) {
     }
   }
 
+  auto lookup = [&](LSLSymbolType type) {
+    return scopes ? scopes->lookupAtom(_mName, type) : lookupAtom(_mName, type);
+  };
+
   // Look up the symbol with the requested type
-  _mSymbol = lookupSymbol(_mName, symbol_type);
+  _mSymbol = lookup(symbol_type);
 
   if (_mSymbol == nullptr) {                       // no symbol of the right type
-    _mSymbol = lookupSymbol(_mName, SYM_ANY);    // so try the wrong one, so we can have a more descriptive error message in that case.
+    _mSymbol = lookup(SYM_ANY);      // so try the wrong one, so we can have a more descriptive error message in that case.
     if (_mSymbol != nullptr && _mSymbol->getSymbolType() != symbol_type) {
       NODE_ERROR(this, E_WRONG_TYPE, _mName,
                  LSLSymbol::getTypeName(symbol_type),
@@ -179,77 +199,182 @@ void LSLIdentifier::resolveSymbol(LSLSymbolType symbol_type) {
   _mType = _mSymbol->getType();
 }
 
+static void check_node_symbols(LSLASTNode *node) {
+  if (node->getSymbolTable() != nullptr)
+    node->getSymbolTable()->checkSymbols();
+
+  for (auto *child : *node)
+    check_node_symbols(child);
+}
+
 void LSLASTNode::checkSymbols() {
-  if (getSymbolTable() != nullptr)
-    getSymbolTable()->checkSymbols();
+  ScopedPass pass(mContext, "check symbols");
+  check_node_symbols(this);
+}
+
 
-  for (auto *node : *this)
-    node->checkSymbols();
+struct SymbolUsage {
+  LSLSymbol *referenced = nullptr;
+  LSLSymbol *assigned = nullptr;
+};
+
+static SymbolUsage get_symbol_usage(LSLASTNode *node) {
+  SymbolUsage usage;
+  if (node->getNodeSubType() == NODE_LVALUE_EXPRESSION) {
+    // assignments are counted against the lvalue rather than the expression doing the
+    // assigning, so they go away along with it if it's taken out of the expression.
+    auto *parent = node->getParent();
+    if (parent && parent->getNodeType() == NODE_EXPRESSION && parent->getChild(0) == node
+        && operation_mutates(((LSLExpression *)parent)->getOperation())) {
+      auto *sym = node->getSymbol();
+      // make sure we don't muck with the assignment count on a builtin symbol!
+      if (sym && sym->getSubType() != SYM_BUILTIN)
+        usage.assigned = sym;
+    }
+  } else if (node->getNodeType() == NODE_IDENTIFIER) {
+    auto *id = (LSLIdentifier *)node;
+    // HACK: Make recursive calls not count as a reference, won't handle mutual recursion!
+    if (id->getEnclosingFunction() && id->getEnclosingFunction() == id->getSymbol())
+      return usage;
+    usage.referenced = id->getSymbol();
+  }
+  return usage;
+}
+
+void track_symbol_usage(LSLASTNode *node) {
+  node->setUsageCounted(true);
+  auto usage = get_symbol_usage(node);
+  if (usage.assigned)
+    usage.assigned->addAssignment();
+  if (usage.referenced)
+    usage.referenced->addReference();
 }
 
+void track_subtree_usage(LSLASTNode *node, bool untrack) {
+  node->setUsageCounted(!untrack);
+  auto usage = get_symbol_usage(node);
+  if (untrack) {
+    if (usage.assigned)
+      usage.assigned->removeAssignment();
+    if (usage.referenced)
+      usage.referenced->removeReference();
+  } else {
+    if (usage.assigned)
+      usage.assigned->addAssignment();
+    if (usage.referenced)
+      usage.referenced->addReference();
+  }
+  for (auto *child : *node)
+    track_subtree_usage(child, untrack);
+}
 
 class NodeReferenceUpdatingVisitor : public ASTVisitor {
   public:
-    virtual bool visit(LSLExpression *expr) {
-      if (operation_mutates(expr->getOperation())) {
-        auto *child = (LSLLValueExpression *)expr->getChild(0);
-        assert(child->getNodeSubType() == NODE_LVALUE_EXPRESSION);
-        // track the assignment
-        auto *sym = child->getSymbol();
-        if (!sym || sym->getSubType() == SYM_BUILTIN) {
-          // make sure we don't muck with the assignment count on a builtin symbol!
-          return true;
-        }
-        sym->addAssignment();
-      }
+    virtual bool visitSpecific(LSLASTNode *node) {
+      track_symbol_usage(node);
       return true;
     };
+};
 
-    virtual bool visit(LSLIdentifier *id) {
-      LSLASTNode *upper_node = id->getParent();
-      while (upper_node != nullptr) {
-        // HACK: Make recursive calls not count as a reference, won't handle mutual recursion!
-        if (upper_node->getNodeType() == NODE_GLOBAL_FUNCTION) {
-          auto *ident = (LSLIdentifier *) upper_node->getChild(0);
-          if (ident != id && ident->getSymbol() == id->getSymbol())
-            return false;
-        }
-        upper_node = upper_node->getParent();
+#ifndef NDEBUG
+// make sure the counts we've been keeping up to date match a recount
+static void check_reference_data(LSLScript *script) {
+  class UsageCountingVisitor : public ASTVisitor {
+    public:
+      bool visitSpecific(LSLASTNode *node) override {
+        auto usage = get_symbol_usage(node);
+        if (usage.referenced && usage.referenced->getSubType() != SYM_BUILTIN)
+          ++counts[usage.referenced].first;
+        if (usage.assigned)
+          ++counts[usage.assigned].second;
+        return true;
       }
-      if (auto *symbol = id->getSymbol())
-        symbol->addReference();
-      return false;
-    };
-};
+      SymbolDataVector<std::pair<int, int>> counts;
+  } visitor;
+  script->visit(&visitor);
+  for (auto *table : script->mContext->table_manager->getTables()) {
+    for (auto *sym : table->getSymbols()) {
+      if (sym->getSubType() == SYM_BUILTIN)
+        continue;
+      auto &counted = visitor.counts[sym];
+      assert(sym->getReferences() == counted.first && sym->getAssignments() == counted.second);
+    }
+  }
+}
+#endif
 
 void LSLScript::recalculateReferenceData() {
+  // Once they've been counted, they're kept up to date as the tree changes.
+  if (mContext->usage_tracked) {
+#ifndef NDEBUG
+    check_reference_data(this);
+#endif
+    return;
+  }
+  ScopedPass pass(mContext, "references");
   // get updated mutation / reference counts
   mContext->table_manager->resetTracking();
+  ++mContext->usage_epoch;
   auto visitor = NodeReferenceUpdatingVisitor();
   visit(&visitor);
+  mContext->usage_tracked = true;
+}
+
+void LSLScript::invalidateReferenceData() {
+  mContext->usage_tracked = false;
 }
 
 void LSLScript::optimize(const OptimizationOptions &ctx) {
-  int optimized;
+  ScopedPass pass(mContext, "optimize");
   // make sure we have updated reference data before we start folding any constants
   recalculateReferenceData();
-  do {
-    TreeSimplifyingVisitor folding_visitor(ctx);
-    visit(&folding_visitor);
-    optimized = folding_visitor.mFoldedLevel;
-
-    // reference data may have changed since we folded constants
-    if (optimized)
-      recalculateReferenceData();
-  } while (optimized);
+  // keeps the reference data up to date as it goes, no need to recalculate it after.
+  ScopedPass simplify_pass(mContext, "simplify");
+  TreeSimplifyingVisitor folding_visitor(ctx);
+  folding_visitor.simplify(this);
 }
 
 
 void LSLScript::validateGlobals(bool mono_semantics) {
+  ScopedPass pass(mContext, "validate globals");
   SimpleAssignableValidatingVisitor visitor(mono_semantics);
   visit(&visitor);
 }
 
+void LSLScript::analyze(bool mono_semantics, bool lint) {
+  ScopedPass pass(mContext, "analyze");
+  // symbol resolution is order-sensitive, it needs a walk all to itself.
+  collectSymbols();
+
+  // Type checking doesn't care about reference data, and reference data only
+  // cares about resolved symbols, so we can collect both in the same walk.
+  {
+    ScopedPass types_pass(mContext, "types");
+    mContext->usage_tracked = false;
+    mContext->table_manager->resetTracking();
+    ++mContext->usage_epoch;
+    TypeCheckVisitor type_visitor(true);
+    visit(&type_visitor);
+    mContext->usage_tracked = true;
+  }
+
+  // Constant propagation needs complete reference data, but the final pass
+  // only looks at constant values of the node being checked and its children,
+  // so it can run on each node right after its constant value is determined.
+  {
+    ScopedPass values_pass(mContext, "values");
+    FinalPassVisitor final_visitor(lint);
+    TailslideOperationBehavior behavior(mContext->allocator, true);
+    ConstantDeterminingVisitor values_visitor(&behavior, mContext->allocator);
+    values_visitor.setFinalPass(&final_visitor);
+    visit(&values_visitor);
+  }
+
+  // only walks the globals, no point in fusing it with anything.
+  if (lint)
+    validateGlobals(mono_semantics);
+}
+
 
 LSLConstant *LSLIdentifier::getConstantValue() {
   if (_mSymbol && _mSymbol->getAssignments() == 0)
@@ -323,11 +448,10 @@ LSLIdentifier *LSLIdentifier::clone() {
       getLoc()
   );
   id->setSymbol(getSymbol());
+  id->setEnclosingFunction(getEnclosingFunction());
   id->setConstantPrecluded(getConstantPrecluded());
   id->setConstantValue(getConstantValue());
-  if (auto *sym = getSymbol()) {
-    sym->addReference();
-  }
+  // Not a reference until it's somewhere in the script, attaching it will count it.
   return id;
 }
 
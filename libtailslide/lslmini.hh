@@ -10,6 +10,7 @@
 #include <sstream>
 
 #include "loctype.hh"
+#include "profiler.hh"
 #include "symtab.hh"
 #include "ast.hh"
 #include "types.hh"
@@ -47,6 +48,16 @@ struct ScriptContext {
   bool parsing = false;
   Tailslide::TailslideLType glloc {0};
   void *scanner = nullptr;
+  // only set when passes should be timed, see `ScopedPass`
+  PassProfiler *profiler = nullptr;
+  ScriptCounters counters {};
+  // how many IDs have been handed out to this script's symbols, see `assign_symbol_id()`
+  uint32_t num_symbol_ids = 0;
+  // Whether symbols' reference and assignment counts are current. Once they are, they're
+  // kept current as subtrees are attached to or detached from `script`.
+  bool usage_tracked = false;
+  // bumped every time usage is counted from scratch, see `LSLASTNode::setUsageCounted()`
+  uint32_t usage_epoch = 0;
 };
 
 struct Vector3 {
@@ -78,41 +89,47 @@ struct Quaternion {
 
 class LSLIdentifier : public LSLASTNode {
   public:
-    LSLIdentifier( ScriptContext *ctx, const char *name ) : LSLASTNode(ctx), _mName(name) {};
-    LSLIdentifier( ScriptContext *ctx, class LSLType *type, const char *name ) : LSLASTNode(ctx), _mName(name) { _mType = type; };
-    LSLIdentifier( ScriptContext *ctx, class LSLType *type, const char *name, YYLTYPE *lloc ) : LSLASTNode(ctx, lloc, 0), _mName(name) { _mType = type; };
-    LSLIdentifier( ScriptContext *ctx, LSLIdentifier *other ) : LSLASTNode(ctx), _mName(other->getName()) {};
+    LSLIdentifier( ScriptContext *ctx, const char *name ) : LSLASTNode(ctx), _mName(intern_name(ctx, name)) { _mNodeType = NODE_IDENTIFIER; };
+    LSLIdentifier( ScriptContext *ctx, class LSLType *type, const char *name ) : LSLASTNode(ctx), _mName(intern_name(ctx, name)) { _mNodeType = NODE_IDENTIFIER; _mType = type; };
+    LSLIdentifier( ScriptContext *ctx, class LSLType *type, const char *name, YYLTYPE *lloc ) : LSLASTNode(ctx, lloc, 0), _mName(intern_name(ctx, name)) { _mNodeType = NODE_IDENTIFIER; _mType = type; };
+    LSLIdentifier( ScriptContext *ctx, LSLIdentifier *other ) : LSLASTNode(ctx), _mName(intern_name(ctx, other->getName())) { _mNodeType = NODE_IDENTIFIER; };
 
+    // an atom when we belong to a script, see `intern_name()`
     const char    *getName() { return _mName; }
 
-    void resolveSymbol(LSLSymbolType symbol_type);
+    /// Bind to the symbol this refers to. Looked up in `scopes` if given,
+    /// otherwise by walking up through our ancestors' symbol tables.
+    void resolveSymbol(LSLSymbolType symbol_type, const LSLScopeChain *scopes = nullptr);
     void setSymbol(LSLSymbol *symbol ) { _mSymbol = symbol; };
     virtual LSLSymbol *getSymbol() { return _mSymbol; };
+    /// The global function a function call is made from, so recursive calls
+    /// can be told apart without looking at our ancestors.
+    void setEnclosingFunction(LSLSymbol *func_sym) { _mEnclosingFunction = func_sym; }
+    LSLSymbol *getEnclosingFunction() { return _mEnclosingFunction; }
 
     virtual std::string getNodeName() {
       char buf[256];
       snprintf(buf, 256, "identifier \"%s\"", _mName);
       return buf;
     }
-    virtual LSLNodeType getNodeType() { return NODE_IDENTIFIER; };
     virtual class LSLConstant *getConstantValue();
 
     LSLIdentifier *clone();
 
   private:
     LSLSymbol                  *_mSymbol = nullptr;
+    LSLSymbol                  *_mEnclosingFunction = nullptr;
     const char                      *_mName;
 };
 
 class LSLGlobalVariable : public LSLASTNode {
   public:
     LSLGlobalVariable( ScriptContext *ctx, class LSLIdentifier *identifier, class LSLExpression *value )
-      : LSLASTNode(ctx, 2, identifier, value) { DEBUG( LOG_DEBUG_SPAM, nullptr, "made a global var\n"); };
+      : LSLASTNode(ctx, 2, identifier, value) { _mNodeType = NODE_GLOBAL_VARIABLE; DEBUG( LOG_DEBUG_SPAM, nullptr, "made a global var\n"); };
     NODE_FIELD_GS(LSLIdentifier, Identifier, 0)
     NODE_FIELD_GS(class LSLExpression, Initializer, 1)
 
     virtual std::string getNodeName() { return "global var"; }
-    virtual LSLNodeType getNodeType() { return NODE_GLOBAL_VARIABLE; };
 
     virtual LSLConstant *getConstantValue();
     virtual LSLSymbol *getSymbol() {return ((LSLIdentifier *) getChild(0))->getSymbol(); }
@@ -121,9 +138,8 @@ class LSLGlobalVariable : public LSLASTNode {
 
 class LSLConstant : public LSLASTNode {
   public:
-    explicit LSLConstant(ScriptContext *ctx) : LSLASTNode(ctx) { _mConstantValue = this; }
+    explicit LSLConstant(ScriptContext *ctx) : LSLASTNode(ctx) { _mNodeType = NODE_CONSTANT; _mConstantValue = this; }
     virtual std::string getNodeName() { return "unknown constant"; }
-    virtual LSLNodeType getNodeType() { return NODE_CONSTANT; };
     // make a shallow copy of the constant
     virtual LSLConstant *copy(ScriptAllocator *allocator) = 0;
     virtual bool containsNaN() { return false; };
@@ -139,7 +155,7 @@ class LSLConstant : public LSLASTNode {
 
 class LSLIntegerConstant : public LSLConstant {
   public:
-    LSLIntegerConstant( ScriptContext *ctx, int v ) : LSLConstant(ctx), _mValue(v) { _mType = TYPE(LST_INTEGER); }
+    LSLIntegerConstant( ScriptContext *ctx, int v ) : LSLConstant(ctx), _mValue(v) { _mNodeSubType = NODE_INTEGER_CONSTANT; _mType = TYPE(LST_INTEGER); }
 
     virtual std::string getNodeName() {
       char buf[256];
@@ -147,8 +163,6 @@ class LSLIntegerConstant : public LSLConstant {
       return buf;
     }
 
-    virtual LSLNodeSubType getNodeSubType() { return NODE_INTEGER_CONSTANT; }
-
     int getValue() const { return _mValue; }
     virtual LSLConstant *copy(ScriptAllocator *allocator) {
       return allocator->newTracked<LSLIntegerConstant>(_mValue);
@@ -164,7 +178,7 @@ class LSLIntegerConstant : public LSLConstant {
 
 class LSLFloatConstant : public LSLConstant {
   public:
-    LSLFloatConstant( ScriptContext *ctx, double v ) : LSLConstant(ctx), _mValue(v) { _mType = TYPE(LST_FLOATINGPOINT); }
+    LSLFloatConstant( ScriptContext *ctx, double v ) : LSLConstant(ctx), _mValue(v) { _mNodeSubType = NODE_FLOAT_CONSTANT; _mType = TYPE(LST_FLOATINGPOINT); }
 
     virtual std::string getNodeName() {
       char buf[256];
@@ -172,8 +186,6 @@ class LSLFloatConstant : public LSLConstant {
       return buf;
     }
 
-    virtual LSLNodeSubType getNodeSubType() { return NODE_FLOAT_CONSTANT; }
-
     double getValue() const { return _mValue; }
     virtual bool containsNaN();
     virtual LSLConstant *copy(ScriptAllocator *allocator) {
@@ -190,7 +202,7 @@ class LSLFloatConstant : public LSLConstant {
 
 class LSLStringConstant : public LSLConstant {
   public:
-    LSLStringConstant( ScriptContext *ctx, const char *v ) : LSLConstant(ctx), _mValue(v) { _mType = TYPE(LST_STRING); }
+    LSLStringConstant( ScriptContext *ctx, const char *v ) : LSLConstant(ctx), _mValue(v) { _mNodeSubType = NODE_STRING_CONSTANT; _mType = TYPE(LST_STRING); }
 
     virtual std::string getNodeName() {
       char buf[256];
@@ -198,8 +210,6 @@ class LSLStringConstant : public LSLConstant {
       return buf;
     }
 
-    virtual LSLNodeSubType getNodeSubType() { return NODE_STRING_CONSTANT; }
-
     const char *getValue() { return _mValue; }
     virtual LSLConstant *copy(ScriptAllocator *allocator) {
       return allocator->newTracked<LSLStringConstant>(_mValue);
@@ -216,7 +226,7 @@ class LSLStringConstant : public LSLConstant {
 
 class LSLKeyConstant : public LSLStringConstant {
   public:
-    LSLKeyConstant( ScriptContext *ctx, const char *v ) : LSLStringConstant(ctx, v) { _mType = TYPE(LST_KEY); }
+    LSLKeyConstant( ScriptContext *ctx, const char *v ) : LSLStringConstant(ctx, v) { _mNodeSubType = NODE_KEY_CONSTANT; _mType = TYPE(LST_KEY); }
     virtual LSLConstant *copy(ScriptAllocator *allocator) {
       return allocator->newTracked<LSLKeyConstant>(_mValue);
     };
@@ -227,7 +237,6 @@ class LSLKeyConstant : public LSLStringConstant {
       return buf;
     }
 
-    virtual LSLNodeSubType getNodeSubType() { return NODE_KEY_CONSTANT; }
 };
 
 /////////////////////////////////////////////////////
@@ -236,6 +245,7 @@ class LSLKeyConstant : public LSLStringConstant {
 class LSLListConstant : public LSLConstant {
   public:
     LSLListConstant( ScriptContext *ctx, class LSLConstant *v ) : LSLConstant(ctx) {
+      _mNodeSubType = NODE_LIST_CONSTANT;
       _mType = TYPE(LST_LIST);
       // so we can do symbol resolution inside the list constant
       if (v != nullptr)
@@ -248,8 +258,6 @@ class LSLListConstant : public LSLConstant {
       return buf;
     }
 
-    virtual LSLNodeSubType getNodeSubType() { return NODE_LIST_CONSTANT; }
-
     class LSLConstant *getValue() { return (LSLConstant*) _mChildren; }
 
     int getLength() { return (int) getNumChildren(); }
@@ -270,6 +278,7 @@ class LSLListConstant : public LSLConstant {
 class LSLVectorConstant : public LSLConstant {
   public:
     LSLVectorConstant( ScriptContext *ctx, float x, float y, float z ): LSLConstant(ctx), _mValue({x, y, z}) {
+      _mNodeSubType = NODE_VECTOR_CONSTANT;
       _mType = TYPE(LST_VECTOR);
     };
 
@@ -279,8 +288,6 @@ class LSLVectorConstant : public LSLConstant {
       return buf;
     }
 
-    virtual LSLNodeSubType getNodeSubType() { return NODE_VECTOR_CONSTANT; }
-
     const Vector3 *getValue() { return &_mValue; }
     virtual bool containsNaN();
 
@@ -299,6 +306,7 @@ class LSLVectorConstant : public LSLConstant {
 class LSLQuaternionConstant : public LSLConstant {
   public:
     LSLQuaternionConstant( ScriptContext *ctx, float x, float y, float z, float s ): LSLConstant(ctx), _mValue({x, y, z, s}) {
+      _mNodeSubType = NODE_QUATERNION_CONSTANT;
       _mType = TYPE(LST_QUATERNION);
     };
 
@@ -308,8 +316,6 @@ class LSLQuaternionConstant : public LSLConstant {
       return buf;
     }
 
-    virtual LSLNodeSubType getNodeSubType() { return NODE_QUATERNION_CONSTANT; }
-
     const Quaternion *getValue() { return &_mValue; }
     virtual bool containsNaN();
 
@@ -325,13 +331,12 @@ class LSLQuaternionConstant : public LSLConstant {
 class LSLGlobalFunction : public LSLASTNode {
   public:
     LSLGlobalFunction( ScriptContext *ctx, class LSLIdentifier *identifier, class LSLFunctionDec *decl, class LSLStatement *statement )
-      : LSLASTNode( ctx, 3, identifier, decl, statement ) {};
+      : LSLASTNode( ctx, 3, identifier, decl, statement ) { _mNodeType = NODE_GLOBAL_FUNCTION; };
     NODE_FIELD_GS(LSLIdentifier, Identifier, 0)
     NODE_FIELD_GS(LSLFunctionDec, Arguments, 1)
     NODE_FIELD_GS(LSLStatement, Statements, 2)
 
     virtual std::string getNodeName() { return "global func"; }
-    virtual LSLNodeType getNodeType() { return NODE_GLOBAL_FUNCTION; };
     virtual LSLSymbol *getSymbol() {return ((LSLIdentifier *) getChild(0))->getSymbol(); }
 };
 
@@ -343,52 +348,49 @@ class LSLParamList : public LSLASTNodeList<LSLIdentifier> {
 
 class LSLFunctionDec : public LSLParamList {
   public:
-    explicit LSLFunctionDec(ScriptContext *ctx) : LSLParamList(ctx) {};
-    LSLFunctionDec( ScriptContext *ctx, class LSLIdentifier *identifiers ) : LSLParamList(ctx, identifiers) {};
+    explicit LSLFunctionDec(ScriptContext *ctx) : LSLParamList(ctx) { _mNodeType = NODE_FUNCTION_DEC; };
+    LSLFunctionDec( ScriptContext *ctx, class LSLIdentifier *identifiers ) : LSLParamList(ctx, identifiers) { _mNodeType = NODE_FUNCTION_DEC; };
     virtual std::string getNodeName() { return "function decl"; }
-    virtual LSLNodeType getNodeType() { return NODE_FUNCTION_DEC; };
 };
 
 class LSLEventDec : public LSLParamList {
   public:
-    explicit LSLEventDec(ScriptContext *ctx) : LSLParamList(ctx) {};
-    LSLEventDec( ScriptContext *ctx, class LSLIdentifier *identifiers ) : LSLParamList(ctx, identifiers) {};
+    explicit LSLEventDec(ScriptContext *ctx) : LSLParamList(ctx) { _mNodeType = NODE_EVENT_DEC; };
+    LSLEventDec( ScriptContext *ctx, class LSLIdentifier *identifiers ) : LSLParamList(ctx, identifiers) { _mNodeType = NODE_EVENT_DEC; };
 
     virtual std::string getNodeName() { return "event decl"; }
-    virtual LSLNodeType getNodeType() { return NODE_EVENT_DEC; };
 };
 
 
 class LSLEventHandler : public LSLASTNode {
   public:
   LSLEventHandler( ScriptContext *ctx, class LSLIdentifier *identifier, class LSLEventDec *decl, class LSLStatement *body )
-      : LSLASTNode(ctx, 3, identifier, decl, body) {};
+      : LSLASTNode(ctx, 3, identifier, decl, body) { _mNodeType = NODE_EVENT_HANDLER; };
   NODE_FIELD_GS(LSLIdentifier, Identifier, 0)
   NODE_FIELD_GS(LSLFunctionDec, Arguments, 1)
   NODE_FIELD_GS(LSLStatement, Statements, 2)
 
   virtual std::string getNodeName() { return "event handler"; }
-  virtual LSLNodeType getNodeType() { return NODE_EVENT_HANDLER; };
   virtual LSLSymbol *getSymbol() {return ((LSLIdentifier *) getChild(0))->getSymbol(); }
 };
 
 class LSLState : public LSLASTNode {
   public:
     LSLState( ScriptContext *ctx, class LSLIdentifier *identifier, LSLASTNodeList<LSLEventHandler> *event_handlers)
-        : LSLASTNode( ctx, 2, identifier, event_handlers) {};
+        : LSLASTNode( ctx, 2, identifier, event_handlers) { _mNodeType = NODE_STATE; };
     NODE_FIELD_GS(LSLIdentifier, Identifier, 0)
     NODE_FIELD_GS(LSLASTNodeList<class LSLEventHandler>, EventHandlers, 1)
 
     virtual std::string getNodeName() { return "state"; }
-    virtual LSLNodeType getNodeType() { return NODE_STATE; };
     virtual LSLSymbol *getSymbol() {return ((LSLIdentifier *) getChild(0))->getSymbol(); }
 };
 
 
 class LSLExpression : public LSLASTNode {
   public:
-  explicit LSLExpression(ScriptContext *ctx) : LSLASTNode(ctx, 0), _mOperation(OP_NONE) {};
+  explicit LSLExpression(ScriptContext *ctx) : LSLASTNode(ctx, 0), _mOperation(OP_NONE) { _mNodeType = NODE_EXPRESSION; };
   LSLExpression(ScriptContext *ctx, int num, ...): LSLASTNode(ctx), _mOperation(OP_NONE) {
+    _mNodeType = NODE_EXPRESSION;
     va_list ap;
     va_start(ap, num);
     addChildren(num, ap);
@@ -398,7 +400,6 @@ class LSLExpression : public LSLASTNode {
   virtual std::string getNodeName() {
     return "base expression";
   };
-  virtual LSLNodeType getNodeType() { return NODE_EXPRESSION; };
 
   virtual LSLConstant *getConstantValue();
   virtual bool nodeAllowsFolding() { return true; };
@@ -413,56 +414,53 @@ class LSLExpression : public LSLASTNode {
 
 class LSLStatement : public LSLASTNode {
   public:
-    explicit LSLStatement( ScriptContext *ctx ): LSLASTNode(ctx) {}
+    explicit LSLStatement( ScriptContext *ctx ): LSLASTNode(ctx) { _mNodeType = NODE_STATEMENT; }
     LSLStatement( ScriptContext *ctx, int num, ... ): LSLASTNode(ctx) {
+      _mNodeType = NODE_STATEMENT;
       va_list ap;
       va_start(ap, num);
       addChildren(num, ap);
       va_end(ap);
     };
     virtual std::string getNodeName() { return "statement"; }
-    virtual LSLNodeType getNodeType() { return NODE_STATEMENT; };
 };
 
 class LSLNopStatement : public LSLStatement {
   public:
-    explicit LSLNopStatement( ScriptContext *ctx) : LSLStatement(ctx, 0) {}
+    explicit LSLNopStatement( ScriptContext *ctx) : LSLStatement(ctx, 0) { _mNodeSubType = NODE_NOP_STATEMENT; }
     virtual std::string getNodeName() { return "nop statement"; };
-    virtual LSLNodeSubType getNodeSubType() { return NODE_NOP_STATEMENT; };
 };
 
 class LSLCompoundStatement : public LSLStatement {
   public:
     LSLCompoundStatement( ScriptContext *ctx, class LSLStatement *statements ) : LSLStatement(ctx) {
+      _mNodeSubType = NODE_COMPOUND_STATEMENT;
       if (statements)
         pushChild(statements);
     }
     virtual std::string getNodeName() { return "compound statement"; };
-    virtual LSLNodeSubType getNodeSubType() { return NODE_COMPOUND_STATEMENT; };
 };
 
 class LSLExpressionStatement : public LSLStatement {
   public:
-  LSLExpressionStatement( ScriptContext *ctx, class LSLExpression *expr ) : LSLStatement(ctx, 1, expr) {}
+  LSLExpressionStatement( ScriptContext *ctx, class LSLExpression *expr ) : LSLStatement(ctx, 1, expr) { _mNodeSubType = NODE_EXPRESSION_STATEMENT; }
   NODE_FIELD_GS(LSLExpression, Expr, 0)
 
   virtual std::string getNodeName() { return "expression statement"; };
-  virtual LSLNodeSubType getNodeSubType() { return NODE_EXPRESSION_STATEMENT; };
 };
 
 class LSLStateStatement : public LSLStatement {
   public:
-    LSLStateStatement( ScriptContext *ctx, class LSLIdentifier *identifier ) : LSLStatement(ctx, 1, identifier) {};
+    LSLStateStatement( ScriptContext *ctx, class LSLIdentifier *identifier ) : LSLStatement(ctx, 1, identifier) { _mNodeSubType = NODE_STATE_STATEMENT; };
     NODE_FIELD_GS(LSLIdentifier, Identifier, 0)
 
     virtual std::string getNodeName() { return "setstate"; };
-    virtual LSLNodeSubType getNodeSubType() { return NODE_STATE_STATEMENT; };
     virtual LSLSymbol *getSymbol() {return ((LSLIdentifier *) getChild(0))->getSymbol(); }
 };
 
 class LSLJumpStatement : public LSLStatement {
   public:
-    LSLJumpStatement( ScriptContext *ctx, class LSLIdentifier *identifier ) : LSLStatement(ctx, 1, identifier) {};
+    LSLJumpStatement( ScriptContext *ctx, class LSLIdentifier *identifier ) : LSLStatement(ctx, 1, identifier) { _mNodeSubType = NODE_JUMP_STATEMENT; };
     NODE_FIELD_GS(LSLIdentifier, Identifier, 0)
 
     virtual std::string getNodeName() {
@@ -475,7 +473,6 @@ class LSLJumpStatement : public LSLStatement {
       snprintf(buf, 256, "jump%s", jump_kind);
       return buf;
     };
-    virtual LSLNodeSubType getNodeSubType() { return NODE_JUMP_STATEMENT; };
     virtual LSLSymbol *getSymbol() {return ((LSLIdentifier *) getChild(0))->getSymbol(); }
 
     bool getIsBreakLike() const { return _mIsBreakLike; }
@@ -493,81 +490,74 @@ class LSLJumpStatement : public LSLStatement {
 
 class LSLLabel : public LSLStatement {
   public:
-    LSLLabel( ScriptContext *ctx, class LSLIdentifier *identifier ) : LSLStatement(ctx, 1, identifier) {};
+    LSLLabel( ScriptContext *ctx, class LSLIdentifier *identifier ) : LSLStatement(ctx, 1, identifier) { _mNodeSubType = NODE_LABEL; };
     NODE_FIELD_GS(LSLIdentifier, Identifier, 0)
 
     virtual std::string getNodeName() { return "label"; };
-    virtual LSLNodeSubType getNodeSubType() { return NODE_LABEL; };
     virtual LSLSymbol *getSymbol() {return ((LSLIdentifier *) getChild(0))->getSymbol(); }
 };
 
 class LSLReturnStatement : public LSLStatement {
   public:
-    LSLReturnStatement( ScriptContext *ctx, class LSLExpression *expression ) : LSLStatement(ctx, 1, expression) {};
+    LSLReturnStatement( ScriptContext *ctx, class LSLExpression *expression ) : LSLStatement(ctx, 1, expression) { _mNodeSubType = NODE_RETURN_STATEMENT; };
     NODE_FIELD_GS(LSLExpression, Expr, 0)
 
     virtual std::string getNodeName() { return "return"; };
-    virtual LSLNodeSubType getNodeSubType() { return NODE_RETURN_STATEMENT; };
 };
 
 class LSLIfStatement : public LSLStatement {
   public:
     LSLIfStatement( ScriptContext *ctx, class LSLExpression *expression, class LSLStatement *true_branch, class LSLStatement *false_branch)
-      : LSLStatement( ctx, 3, expression, true_branch, false_branch ) {};
+      : LSLStatement( ctx, 3, expression, true_branch, false_branch ) { _mNodeSubType = NODE_IF_STATEMENT; };
     NODE_FIELD_GS(LSLExpression, CheckExpr, 0)
     NODE_FIELD_GS(LSLStatement, TrueBranch, 1)
     NODE_FIELD_GS(LSLStatement, FalseBranch, 2)
 
     virtual std::string getNodeName() { return "if"; };
-    virtual LSLNodeSubType getNodeSubType() { return NODE_IF_STATEMENT; };
 };
 
 class LSLForStatement : public LSLStatement {
   public:
     LSLForStatement(ScriptContext *ctx, class LSLASTNodeList<LSLExpression> *init, class LSLExpression *condition,
                     class LSLASTNodeList<LSLExpression> *cont, class LSLStatement *body)
-      : LSLStatement( ctx, 4, init, condition, cont, body ) {};
+      : LSLStatement( ctx, 4, init, condition, cont, body ) { _mNodeSubType = NODE_FOR_STATEMENT; };
     NODE_FIELD_GS(LSLASTNodeList<LSLExpression>, InitExprs, 0)
     NODE_FIELD_GS(LSLExpression, CheckExpr, 1)
     NODE_FIELD_GS(LSLASTNodeList<LSLExpression>, IncrExprs, 2)
     NODE_FIELD_GS(LSLStatement, Body, 3)
 
     virtual std::string getNodeName() { return "for"; };
-    virtual LSLNodeSubType getNodeSubType() { return NODE_FOR_STATEMENT; };
 };
 
 class LSLDoStatement : public LSLStatement {
   public:
     LSLDoStatement( ScriptContext *ctx, class LSLStatement *body, class LSLExpression *condition )
-      : LSLStatement(ctx, 2, body, condition) {};
+      : LSLStatement(ctx, 2, body, condition) { _mNodeSubType = NODE_DO_STATEMENT; };
     NODE_FIELD_GS(LSLStatement, Body, 0)
     NODE_FIELD_GS(LSLExpression, CheckExpr, 1)
 
     virtual std::string getNodeName() { return "do"; };
-    virtual LSLNodeSubType getNodeSubType() { return NODE_DO_STATEMENT; };
 };
 
 class LSLWhileStatement : public LSLStatement {
   public:
     LSLWhileStatement( ScriptContext *ctx, class LSLExpression *condition, class LSLStatement *body )
-      : LSLStatement(ctx, 2, condition, body) {};
+      : LSLStatement(ctx, 2, condition, body) { _mNodeSubType = NODE_WHILE_STATEMENT; };
     NODE_FIELD_GS(LSLExpression, CheckExpr, 0)
     NODE_FIELD_GS(LSLStatement, Body, 1)
 
     virtual std::string getNodeName() { return "while"; };
-    virtual LSLNodeSubType getNodeSubType() { return NODE_WHILE_STATEMENT; };
 };
 
 
 class LSLDeclaration : public LSLStatement {
   public:
     LSLDeclaration(ScriptContext *ctx, class LSLIdentifier *identifier, class LSLExpression *value)
-      : LSLStatement(ctx, 2, identifier, value) { };
+      : LSLStatement(ctx, 2, identifier, value) { _mNodeSubType = NODE_DECLARATION; };
     NODE_FIELD_GS(LSLIdentifier, Identifier, 0)
     NODE_FIELD_GS(LSLExpression, Initializer, 1)
 
     virtual std::string getNodeName() { return "declaration"; };
-    virtual LSLNodeSubType getNodeSubType() { return NODE_DECLARATION; };
 
     virtual LSLConstant *getConstantValue();
     virtual LSLSymbol *getSymbol() {return ((LSLIdentifier *) getChild(0))->getSymbol(); }
@@ -578,8 +568,10 @@ class LSLConstantExpression: public LSLExpression {
 public:
     LSLConstantExpression( ScriptContext *ctx, LSLConstant *constant )
       : LSLExpression(ctx) {
+      _mNodeSubType = NODE_CONSTANT_EXPRESSION;
       assert(constant);
-      if (constant->isStatic())
+      // taking a constant that's already in the tree would leave it with two parents
+      if (constant->isStatic() || constant->getParent())
         constant = constant->copy(ctx->allocator);
       pushChild(constant);
       _mConstantValue = constant;
@@ -589,27 +581,25 @@ public:
     virtual std::string getNodeName() {
       return "constant expression";
     };
-    virtual LSLNodeSubType getNodeSubType() { return NODE_CONSTANT_EXPRESSION; };
 };
 
 
 class LSLParenthesisExpression: public LSLExpression {
 public:
     LSLParenthesisExpression( ScriptContext *ctx, LSLExpression *expr )
-      : LSLExpression(ctx, 1, expr) { _mOperation = OP_PARENS; };
+      : LSLExpression(ctx, 1, expr) { _mNodeSubType = NODE_PARENTHESIS_EXPRESSION; _mOperation = OP_PARENS; };
     NODE_FIELD_GS(LSLExpression, ChildExpr, 0)
 
     virtual std::string getNodeName() {
       return "parenthesis expression";
     };
-    virtual LSLNodeSubType getNodeSubType() { return NODE_PARENTHESIS_EXPRESSION; };
 };
 
 
 class LSLBinaryExpression : public LSLExpression {
 public:
     LSLBinaryExpression( ScriptContext *ctx, LSLExpression *lvalue, LSLOperator oper, LSLExpression *rvalue )
-    : LSLExpression(ctx, 2, lvalue, rvalue) { _mOperation = oper; };
+    : LSLExpression(ctx, 2, lvalue, rvalue) { _mNodeSubType = NODE_BINARY_EXPRESSION; _mOperation = oper; };
     NODE_FIELD_GS(LSLExpression, LHS, 0)
     NODE_FIELD_GS(LSLExpression, RHS, 1)
 
@@ -618,13 +608,12 @@ public:
       snprintf( buf, 256, "binary expression: '%s'", operation_repr_str(_mOperation) );
       return buf;
     };
-    virtual LSLNodeSubType getNodeSubType() { return NODE_BINARY_EXPRESSION; };
 };
 
 class LSLUnaryExpression : public LSLExpression {
 public:
     LSLUnaryExpression( ScriptContext *ctx, LSLExpression *lvalue, LSLOperator oper )
-            : LSLExpression(ctx, 1, lvalue) { _mOperation = oper; };
+            : LSLExpression(ctx, 1, lvalue) { _mNodeSubType = NODE_UNARY_EXPRESSION; _mOperation = oper; };
     NODE_FIELD_GS(LSLExpression, ChildExpr, 0)
 
     virtual std::string getNodeName() {
@@ -632,49 +621,44 @@ public:
       snprintf( buf, 256, "unary expression: '%s'", operation_repr_str(_mOperation) );
       return buf;
     };
-    virtual LSLNodeSubType getNodeSubType() { return NODE_UNARY_EXPRESSION; };
 };
 
 class LSLTypecastExpression : public LSLExpression {
   public:
     LSLTypecastExpression(ScriptContext *ctx, LSLType *type, LSLExpression *expression )
-      : LSLExpression(ctx, 1, expression) { _mType = type;};
+      : LSLExpression(ctx, 1, expression) { _mNodeSubType = NODE_TYPECAST_EXPRESSION; _mType = type;};
     NODE_FIELD_GS(LSLExpression, ChildExpr, 0)
 
     virtual std::string getNodeName() { return "typecast expression"; }
-    virtual LSLNodeSubType getNodeSubType() { return NODE_TYPECAST_EXPRESSION; };
 };
 
 /// synthesized node to represent cases where something must be converted to boolean
 class LSLBoolConversionExpression : public LSLExpression {
   public:
   LSLBoolConversionExpression(ScriptContext *ctx, LSLExpression *expression )
-      : LSLExpression(ctx, 1, expression) { _mType = TYPE(LST_INTEGER);};
+      : LSLExpression(ctx, 1, expression) { _mNodeSubType = NODE_BOOL_CONVERSION_EXPRESSION; _mType = TYPE(LST_INTEGER);};
   NODE_FIELD_GS(LSLExpression, ChildExpr, 0)
 
   virtual std::string getNodeName() { return "boolean conversion"; }
-  virtual LSLNodeSubType getNodeSubType() { return NODE_BOOL_CONVERSION_EXPRESSION; };
 };
 
 class LSLPrintExpression : public LSLExpression {
   public:
     LSLPrintExpression( ScriptContext *ctx, LSLExpression *expression )
-      : LSLExpression( ctx, 1, expression ) { _mType = TYPE(LST_NULL); };
+      : LSLExpression( ctx, 1, expression ) { _mNodeSubType = NODE_PRINT_EXPRESSION; _mType = TYPE(LST_NULL); };
     NODE_FIELD_GS(LSLExpression, ChildExpr, 0)
 
     virtual std::string getNodeName() { return "print() call"; }
-    virtual LSLNodeSubType getNodeSubType() { return NODE_PRINT_EXPRESSION; };
 };
 
 class LSLFunctionExpression : public LSLExpression {
   public:
     LSLFunctionExpression( ScriptContext *ctx, LSLIdentifier *identifier, LSLASTNodeList<LSLExpression> *arguments )
-      : LSLExpression( ctx, 2, identifier, arguments) {};
+      : LSLExpression( ctx, 2, identifier, arguments) { _mNodeSubType = NODE_FUNCTION_EXPRESSION; };
     NODE_FIELD_GS(LSLIdentifier, Identifier, 0)
     NODE_FIELD_GS(LSLASTNodeList<LSLExpression>, Arguments, 1)
 
     virtual std::string getNodeName() { return "function call"; }
-    virtual LSLNodeSubType getNodeSubType() { return NODE_FUNCTION_EXPRESSION; };
 
     virtual bool nodeAllowsFolding() { return false; };
     virtual LSLSymbol *getSymbol() {return ((LSLIdentifier *) getChild(0))->getSymbol(); }
@@ -683,38 +667,36 @@ class LSLFunctionExpression : public LSLExpression {
 class LSLVectorExpression : public LSLExpression {
   public:
     LSLVectorExpression(ScriptContext *ctx, LSLExpression *x, LSLExpression *y, LSLExpression *z )
-      : LSLExpression(ctx, 3, x, y, z) { _mType = TYPE(LST_VECTOR); }
+      : LSLExpression(ctx, 3, x, y, z) { _mNodeSubType = NODE_VECTOR_EXPRESSION; _mType = TYPE(LST_VECTOR); }
     NODE_FIELD_GS(LSLExpression, X, 0)
     NODE_FIELD_GS(LSLExpression, Y, 1)
     NODE_FIELD_GS(LSLExpression, Z, 2)
 
     virtual std::string getNodeName() { return "vector expression"; }
-    virtual LSLNodeSubType getNodeSubType() { return NODE_VECTOR_EXPRESSION; };
 };
 
 class LSLQuaternionExpression : public LSLExpression {
   public:
     LSLQuaternionExpression(ScriptContext *ctx, LSLExpression *x, LSLExpression *y, LSLExpression *z, LSLExpression *s )
-      : LSLExpression(ctx, 4, x, y, z, s) { _mType = TYPE(LST_QUATERNION); };
+      : LSLExpression(ctx, 4, x, y, z, s) { _mNodeSubType = NODE_QUATERNION_EXPRESSION; _mType = TYPE(LST_QUATERNION); };
     NODE_FIELD_GS(LSLExpression, X, 0)
     NODE_FIELD_GS(LSLExpression, Y, 1)
     NODE_FIELD_GS(LSLExpression, Z, 2)
     NODE_FIELD_GS(LSLExpression, S, 3)
 
     virtual std::string getNodeName() { return "quaternion expression"; };
-    virtual LSLNodeSubType getNodeSubType() { return NODE_QUATERNION_EXPRESSION; };
 };
 
 class LSLListExpression : public LSLExpression {
   public:
     LSLListExpression( ScriptContext *ctx, LSLExpression *c ) : LSLExpression(ctx) {
+      _mNodeSubType = NODE_LIST_EXPRESSION;
       _mType = TYPE(LST_LIST);
       if (c)
         pushChild(c);
     };
 
     virtual std::string getNodeName() { return "list expression"; };
-    virtual LSLNodeSubType getNodeSubType() { return NODE_LIST_EXPRESSION; }
     node_child_iterator<LSLExpression> begin() {
       return node_child_iterator<LSLExpression>(static_cast<LSLExpression*>(_mChildren));
     }
@@ -726,7 +708,7 @@ class LSLListExpression : public LSLExpression {
 class LSLLValueExpression : public LSLExpression {
   public:
     LSLLValueExpression( ScriptContext *ctx, LSLIdentifier *identifier, LSLIdentifier *member )
-      : LSLExpression(ctx, 2, identifier, member), _mIsFoldable(false) {};
+      : LSLExpression(ctx, 2, identifier, member), _mIsFoldable(false) { _mNodeSubType = NODE_LVALUE_EXPRESSION; };
     NODE_FIELD_GS(LSLIdentifier, Identifier, 0)
     NODE_FIELD_GS(LSLIdentifier, Member, 1)
 
@@ -735,7 +717,6 @@ class LSLLValueExpression : public LSLExpression {
       snprintf(buf, 256, "lvalue expression {%sfoldable}", _mIsFoldable ? "" : "not ");
       return buf;
     };
-    virtual LSLNodeSubType getNodeSubType() { return NODE_LVALUE_EXPRESSION; };
     virtual LSLConstant *getConstantValue();
     virtual LSLSymbol *getSymbol() {return ((LSLIdentifier*)getChild(0))->getSymbol(); };
 
@@ -750,21 +731,48 @@ class LSLLValueExpression : public LSLExpression {
 class LSLScript : public LSLASTNode {
     public:
     LSLScript( ScriptContext *ctx, LSLASTNodeList<LSLASTNode> *globals, LSLASTNodeList<LSLState> *states )
-        : LSLASTNode( ctx, 2, globals, states ) {};
+        : LSLASTNode( ctx, 2, globals, states ) { _mNodeType = NODE_SCRIPT; };
     NODE_FIELD_GS(LSLASTNodeList<LSLASTNode>, Globals, 0)
     NODE_FIELD_GS(LSLASTNodeList<LSLState>, States, 1)
 
     virtual std::string getNodeName() { return "script"; };
-    virtual LSLNodeType getNodeType() { return NODE_SCRIPT; };
-    virtual LSLSymbol *lookupSymbol(const char *name, LSLSymbolType sym_type);
+    virtual LSLSymbol *lookupAtom(const char *atom, LSLSymbolType sym_type);
 
     void optimize(const OptimizationOptions &ctx);
     void recalculateReferenceData();
+    // Throw away the tracked reference data so the next `recalculateReferenceData()`
+    // recounts from scratch. Needed after changing the tree without going through
+    // `pushChild()` / `removeChild()` / `replaceNode()`, such as by calling `setSymbol()`.
+    void invalidateReferenceData();
     void validateGlobals(bool mono_semantics);
+    // Run every front-end pass from `collectSymbols()` through `finalPass()`,
+    // followed by `validateGlobals()` and `checkSymbols()` if `lint` is set.
+    // Passes whose dependencies allow it share tree walks, but the results are
+    // the same as running each pass separately.
+    void analyze(bool mono_semantics=true, bool lint=true);
 };
 
+// Count the symbol references and assignments made by `node` itself
+void track_symbol_usage(LSLASTNode *node);
+// Count (or stop counting) the usage made by `node` and everything under it.
+// Must be called while `node` is attached to wherever it's being counted in.
+void track_subtree_usage(LSLASTNode *node, bool untrack=false);
+
+// Must be called before parsing any scripts. The builtins are immutable afterwards
+// and may be shared by scripts being parsed on different threads.
 void tailslide_init_builtins(const char *builtins_file);
 
+// Load builtins from a file in the same format as builtins.txt into `table`, for
+// checking scripts against something other than the global builtins.
+void tailslide_load_builtins_file(const char *builtins_file, LSLSymbolTable *table, ScriptAllocator *allocator);
+
+// Hash of the builtins loaded by `tailslide_init_builtins()`, for telling
+// apart results produced with different sets of builtins.
+uint64_t tailslide_get_builtins_fingerprint();
+
+// Hash of the sources this library was built from, along with the compiler that built them
+const char *tailslide_get_build_id();
+
 }
 
 // make sure our define doesn't leak into the public API
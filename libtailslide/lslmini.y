@@ -66,6 +66,7 @@
     Tailslide::S32                             ival;
     Tailslide::F32                             fval;
     char                                       *sval;
+    const char                                 *atom;
     class Tailslide::LSLType              *type;
     class Tailslide::LSLConstant          *constant;
     class Tailslide::LSLIdentifier        *identifier;
@@ -94,8 +95,8 @@
 %token                    JUMP
 %token                    RETURN
 
-%token <sval>             IDENTIFIER
-%token <sval>             STATE_DEFAULT
+%token <atom>             IDENTIFIER
+%token <atom>             STATE_DEFAULT
 
 %token <ival>             INTEGER_CONSTANT
 
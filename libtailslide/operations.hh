@@ -1,8 +1,7 @@
 #pragma once
 
 #include "allocator.hh"
-
-struct YYLTYPE;
+#include "loctype.hh"
 
 namespace Tailslide {
 class LSLType;
@@ -0,0 +1,214 @@
+#include <algorithm>
+
+#include "control_flow.hh"
+
+namespace Tailslide {
+
+ControlFlowGraph::ControlFlowGraph(LSLASTNode *func_like) : _mFunctionLike(func_like) {
+  assert(func_like->getNodeType() == NODE_GLOBAL_FUNCTION || func_like->getNodeType() == NODE_EVENT_HANDLER);
+  newBlock();
+  newBlock();
+  _mCurrent = newBlock();
+  addEdge(ENTRY, _mCurrent);
+
+  buildStatement(func_like->getChild(2));
+  // falling off the end
+  addEdge(_mCurrent, EXIT);
+
+  for (auto &pending_jump : _mPendingJumps) {
+    auto label_iter = _mLabelBlocks.find(pending_jump.second);
+    // jumps to labels that don't exist have already been reported, just leave them dangling.
+    if (label_iter != _mLabelBlocks.end())
+      addEdge(pending_jump.first, label_iter->second);
+  }
+  _mPendingJumps.clear();
+  _mLabelBlocks.clear();
+  computeOrder();
+}
+
+uint32_t ControlFlowGraph::newBlock() {
+  _mBlocks.emplace_back();
+  return (uint32_t)_mBlocks.size() - 1;
+}
+
+void ControlFlowGraph::addEdge(uint32_t from, uint32_t to) {
+  _mBlocks[from].succs.push_back(to);
+  _mBlocks[to].preds.push_back(from);
+}
+
+void ControlFlowGraph::addNode(LSLASTNode *node) {
+  if (!node || node->getNodeType() == NODE_NULL)
+    return;
+  auto &nodes = _mBlocks[_mCurrent].nodes;
+  _mNodeLocations[node] = {_mCurrent, (uint32_t)nodes.size()};
+  nodes.push_back(node);
+}
+
+void ControlFlowGraph::startBlock(uint32_t id) {
+  addEdge(_mCurrent, id);
+  _mCurrent = id;
+}
+
+void ControlFlowGraph::leave(LSLASTNode *node, uint32_t target) {
+  addNode(node);
+  addEdge(_mCurrent, target);
+  // anything after this is unreachable unless there's a label in between
+  _mCurrent = newBlock();
+}
+
+void ControlFlowGraph::buildStatement(LSLASTNode *stmt) {
+  if (!stmt || stmt->getNodeType() == NODE_NULL)
+    return;
+  switch (stmt->getNodeSubType()) {
+    case NODE_COMPOUND_STATEMENT:
+      for (auto *child : *stmt)
+        buildStatement(child);
+      return;
+    case NODE_NOP_STATEMENT:
+      return;
+    case NODE_EXPRESSION_STATEMENT:
+      addNode(((LSLExpressionStatement *)stmt)->getExpr());
+      return;
+    case NODE_DECLARATION:
+      addNode(stmt);
+      return;
+    case NODE_RETURN_STATEMENT:
+    case NODE_STATE_STATEMENT:
+      leave(stmt, EXIT);
+      return;
+    case NODE_JUMP_STATEMENT:
+      _mPendingJumps.emplace_back(_mCurrent, stmt->getSymbol());
+      addNode(stmt);
+      _mCurrent = newBlock();
+      return;
+    case NODE_LABEL: {
+      uint32_t label_block = newBlock();
+      startBlock(label_block);
+      if (auto *sym = stmt->getSymbol())
+        _mLabelBlocks[sym] = label_block;
+      return;
+    }
+    case NODE_IF_STATEMENT: {
+      auto *if_stmt = (LSLIfStatement *)stmt;
+      addNode(if_stmt->getCheckExpr());
+      uint32_t cond_block = _mCurrent;
+      _mBlocks[cond_block].branch_cond = if_stmt->getCheckExpr();
+      uint32_t true_block = newBlock();
+      uint32_t join_block = newBlock();
+      addEdge(cond_block, true_block);
+      _mCurrent = true_block;
+      buildStatement(if_stmt->getTrueBranch());
+      addEdge(_mCurrent, join_block);
+      if (auto *false_branch = if_stmt->getFalseBranch()) {
+        uint32_t false_block = newBlock();
+        addEdge(cond_block, false_block);
+        _mCurrent = false_block;
+        buildStatement(false_branch);
+        addEdge(_mCurrent, join_block);
+      } else {
+        addEdge(cond_block, join_block);
+      }
+      _mCurrent = join_block;
+      return;
+    }
+    case NODE_WHILE_STATEMENT: {
+      auto *while_stmt = (LSLWhileStatement *)stmt;
+      buildLoop(while_stmt->getCheckExpr(), while_stmt->getBody(), nullptr, true);
+      return;
+    }
+    case NODE_FOR_STATEMENT: {
+      auto *for_stmt = (LSLForStatement *)stmt;
+      if (auto *init_exprs = for_stmt->getInitExprs()) {
+        for (auto *init_expr : *init_exprs)
+          addNode(init_expr);
+      }
+      buildLoop(for_stmt->getCheckExpr(), for_stmt->getBody(), for_stmt->getIncrExprs(), true);
+      return;
+    }
+    case NODE_DO_STATEMENT: {
+      auto *do_stmt = (LSLDoStatement *)stmt;
+      buildLoop(do_stmt->getCheckExpr(), do_stmt->getBody(), nullptr, false);
+      return;
+    }
+    default:
+      assert(0);
+      return;
+  }
+}
+
+void ControlFlowGraph::buildLoop(LSLExpression *cond, LSLStatement *body, LSLASTNode *incr_exprs, bool test_first) {
+  uint32_t body_block = newBlock();
+  // test-last loops only get their condition block once the body's been built
+  uint32_t cond_block = test_first ? newBlock() : 0;
+  if (test_first) {
+    startBlock(cond_block);
+    addEdge(cond_block, body_block);
+  } else {
+    startBlock(body_block);
+  }
+
+  _mCurrent = body_block;
+  buildStatement(body);
+  if (incr_exprs) {
+    for (auto *incr_expr : *incr_exprs)
+      addNode(incr_expr);
+  }
+
+  if (test_first) {
+    addEdge(_mCurrent, cond_block);
+  } else {
+    cond_block = newBlock();
+    startBlock(cond_block);
+    addEdge(cond_block, body_block);
+  }
+  _mCurrent = cond_block;
+  addNode(cond);
+  _mBlocks[cond_block].branch_cond = cond;
+
+  uint32_t after_block = newBlock();
+  addEdge(cond_block, after_block);
+  _mCurrent = after_block;
+}
+
+void ControlFlowGraph::computeOrder() {
+  _mReachable.assign(_mBlocks.size(), false);
+  _mReversePostorder.clear();
+  // explicit stack of (block, next successor to look at) so deeply nested code can't blow the stack.
+  std::vector<std::pair<uint32_t, uint32_t>> stack;
+  stack.emplace_back(ENTRY, 0);
+  _mReachable[ENTRY] = true;
+  while (!stack.empty()) {
+    auto &top = stack.back();
+    const auto &succs = _mBlocks[top.first].succs;
+    if (top.second < succs.size()) {
+      uint32_t succ = succs[top.second++];
+      if (!_mReachable[succ]) {
+        _mReachable[succ] = true;
+        stack.emplace_back(succ, 0);
+      }
+    } else {
+      _mReversePostorder.push_back(top.first);
+      stack.pop_back();
+    }
+  }
+  std::reverse(_mReversePostorder.begin(), _mReversePostorder.end());
+}
+
+std::pair<uint32_t, uint32_t> ControlFlowGraph::findNode(LSLASTNode *node) const {
+  auto loc_iter = _mNodeLocations.find(node);
+  if (loc_iter == _mNodeLocations.end())
+    return {NO_BLOCK, 0};
+  return loc_iter->second;
+}
+
+std::pair<uint32_t, uint32_t> ControlFlowGraph::findEnclosingNode(LSLASTNode *node) const {
+  while (node && node != _mFunctionLike) {
+    auto loc = findNode(node);
+    if (loc.first != NO_BLOCK)
+      return loc;
+    node = node->getParent();
+  }
+  return {NO_BLOCK, 0};
+}
+
+}
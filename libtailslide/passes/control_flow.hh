@@ -0,0 +1,77 @@
+#ifndef TAILSLIDE_CONTROL_FLOW_HH
+#define TAILSLIDE_CONTROL_FLOW_HH
+
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "../lslmini.hh"
+
+namespace Tailslide {
+
+const uint32_t NO_BLOCK = UINT32_MAX;
+
+/// A straight-line run of things that get evaluated within a function-like.
+/// `nodes` are the outermost nodes evaluated as a unit: expression statements'
+/// expressions, declarations, conditions, `for` init and increment expressions,
+/// `return`s, `jump`s and `state` changes. Nothing in them can branch, LSL has no
+/// short-circuiting operators.
+struct BasicBlock {
+  std::vector<LSLASTNode *> nodes;
+  std::vector<uint32_t> succs;
+  std::vector<uint32_t> preds;
+  // condition this block ends on, if it ends in a conditional branch.
+  // `succs[0]` is taken when the condition is true and `succs[1]` when it isn't.
+  LSLExpression *branch_cond = nullptr;
+};
+
+/// Control flow graph for the body of an `LSLGlobalFunction` or `LSLEventHandler`.
+/// Block 0 is the entry and block 1 is the exit everything that leaves the
+/// function-like flows into, be it via `return`, a `state` change or falling off the end.
+/// Both branches of a conditional are kept even if its condition is constant.
+class ControlFlowGraph {
+  public:
+    static constexpr uint32_t ENTRY = 0;
+    static constexpr uint32_t EXIT = 1;
+
+    explicit ControlFlowGraph(LSLASTNode *func_like);
+
+    LSLASTNode *getFunctionLike() const { return _mFunctionLike; }
+    const std::vector<BasicBlock> &getBlocks() const { return _mBlocks; }
+    const BasicBlock &getBlock(uint32_t id) const { return _mBlocks[id]; }
+    uint32_t getNumBlocks() const { return (uint32_t)_mBlocks.size(); }
+    /// Blocks reachable from the entry, in reverse postorder
+    const std::vector<uint32_t> &getReversePostorder() const { return _mReversePostorder; }
+    bool isReachable(uint32_t id) const { return _mReachable[id]; }
+    /// The block and index within it of one of the blocks' `nodes`,
+    /// or `{NO_BLOCK, 0}` if `node` isn't one of them.
+    std::pair<uint32_t, uint32_t> findNode(LSLASTNode *node) const;
+    /// Like `findNode()`, but for anything within one of the blocks' `nodes`
+    std::pair<uint32_t, uint32_t> findEnclosingNode(LSLASTNode *node) const;
+
+  protected:
+    uint32_t newBlock();
+    void addEdge(uint32_t from, uint32_t to);
+    void addNode(LSLASTNode *node);
+    // start a new block `_mCurrent` falls through to
+    void startBlock(uint32_t id);
+    void buildStatement(LSLASTNode *stmt);
+    void buildLoop(LSLExpression *cond, LSLStatement *body, LSLASTNode *incr_exprs, bool test_first);
+    void leave(LSLASTNode *node, uint32_t target);
+    void computeOrder();
+
+    LSLASTNode *_mFunctionLike;
+    std::vector<BasicBlock> _mBlocks;
+    std::vector<uint32_t> _mReversePostorder;
+    std::vector<bool> _mReachable;
+    std::unordered_map<LSLASTNode *, std::pair<uint32_t, uint32_t>> _mNodeLocations;
+    // block new nodes get added to, nothing can reach it if it was just left via a jump.
+    uint32_t _mCurrent = ENTRY;
+    // labels can be jumped to before they're seen, so edges for jumps get added at the end.
+    std::vector<std::pair<uint32_t, LSLSymbol *>> _mPendingJumps;
+    std::unordered_map<LSLSymbol *, uint32_t> _mLabelBlocks;
+};
+
+}
+
+#endif //TAILSLIDE_CONTROL_FLOW_HH
@@ -0,0 +1,447 @@
+#include <cstring>
+
+#include "dataflow.hh"
+
+namespace Tailslide {
+
+BitVector::BitVector(uint32_t num_bits, bool value)
+  : _mWords((num_bits + 63) / 64, value ? ~(uint64_t)0 : 0), _mNumBits(num_bits) {
+  // keep the bits past the end clear so whole words can be compared
+  if (value && num_bits % 64)
+    _mWords.back() = ((uint64_t)1 << (num_bits % 64)) - 1;
+}
+
+uint32_t BitVector::count() const {
+  uint32_t num_set = 0;
+  for (auto word : _mWords) {
+    for (; word; word &= word - 1)
+      ++num_set;
+  }
+  return num_set;
+}
+
+void BitVector::unionWith(const BitVector &other) {
+  assert(other._mNumBits == _mNumBits);
+  for (size_t i = 0; i < _mWords.size(); ++i)
+    _mWords[i] |= other._mWords[i];
+}
+
+void BitVector::intersectWith(const BitVector &other) {
+  assert(other._mNumBits == _mNumBits);
+  for (size_t i = 0; i < _mWords.size(); ++i)
+    _mWords[i] &= other._mWords[i];
+}
+
+void BitVector::subtract(const BitVector &other) {
+  assert(other._mNumBits == _mNumBits);
+  for (size_t i = 0; i < _mWords.size(); ++i)
+    _mWords[i] &= ~other._mWords[i];
+}
+
+
+GenKillProblem::GenKillProblem(const ControlFlowGraph &cfg, uint32_t num_bits, DataflowDirection direction, bool intersect)
+  : num_bits(num_bits), direction(direction), intersect(intersect),
+    gen(cfg.getNumBlocks(), BitVector(num_bits)), kill(cfg.getNumBlocks(), BitVector(num_bits)),
+    boundary(num_bits) {}
+
+void GenKillProblem::meet(BitVector &into, const BitVector &other) const {
+  if (intersect)
+    into.intersectWith(other);
+  else
+    into.unionWith(other);
+}
+
+void GenKillProblem::transfer(uint32_t block, const BitVector &before, BitVector &after) const {
+  after = before;
+  after.subtract(kill[block]);
+  after.unionWith(gen[block]);
+}
+
+
+FlowVariables::FlowVariables(LSLASTNode *func_like) {
+  for (auto *param : *func_like->getChild(1))
+    addSymbol(param->getSymbol());
+  _mNumParams = size();
+  collectLocals(func_like->getChild(2));
+}
+
+void FlowVariables::collectLocals(LSLASTNode *node) {
+  if (node->getNodeType() == NODE_STATEMENT) {
+    if (node->getNodeSubType() == NODE_DECLARATION)
+      addSymbol(node->getSymbol());
+    for (auto *child : *node)
+      collectLocals(child);
+  }
+}
+
+void FlowVariables::addSymbol(LSLSymbol *sym) {
+  // may be missing if there was an error resolving it
+  if (!sym || sym->getSymbolType() != SYM_VARIABLE || _mIndices[sym])
+    return;
+  _mSymbols.push_back(sym);
+  _mIndices[sym] = size();
+}
+
+uint32_t FlowVariables::getIndex(LSLSymbol *sym) {
+  if (!sym || sym->getSubType() == SYM_BUILTIN || sym->getSubType() == SYM_GLOBAL)
+    return NO_FLOW_INDEX;
+  uint32_t index = _mIndices[sym];
+  return index ? index - 1 : NO_FLOW_INDEX;
+}
+
+
+void collect_flow_accesses(LSLASTNode *node, FlowVariables &vars, std::vector<FlowAccess> &accesses) {
+  if (!node)
+    return;
+  switch (node->getNodeType()) {
+    case NODE_STATEMENT:
+      if (node->getNodeSubType() == NODE_DECLARATION) {
+        auto *decl = (LSLDeclaration *)node;
+        collect_flow_accesses(decl->getInitializer(), vars, accesses);
+        uint32_t var = vars.getIndex(decl->getSymbol());
+        if (var != NO_FLOW_INDEX)
+          accesses.push_back({var, decl, false, true, false});
+        return;
+      }
+      break;
+    case NODE_EXPRESSION: {
+      if (node->getNodeSubType() == NODE_LVALUE_EXPRESSION) {
+        uint32_t var = vars.getIndex(node->getSymbol());
+        if (var != NO_FLOW_INDEX)
+          accesses.push_back({var, node, true, false, false});
+        return;
+      }
+      auto op = ((LSLExpression *)node)->getOperation();
+      auto *target = node->getChild(0);
+      if (operation_mutates(op) && target && target->getNodeSubType() == NODE_LVALUE_EXPRESSION) {
+        auto *lvalue = (LSLLValueExpression *)target;
+        // the right-hand side is evaluated before anything gets written
+        for (auto *child = lvalue->getNext(); child; child = child->getNext())
+          collect_flow_accesses(child, vars, accesses);
+        uint32_t var = vars.getIndex(lvalue->getSymbol());
+        if (var != NO_FLOW_INDEX) {
+          bool partial = lvalue->getMember() != nullptr;
+          accesses.push_back({var, node, op != OP_ASSIGN || partial, true, partial});
+        }
+        return;
+      }
+      break;
+    }
+    case NODE_IDENTIFIER:
+      // names of functions, states and labels. variables are always read through lvalues.
+      return;
+    default:
+      break;
+  }
+  for (auto *child : *node)
+    collect_flow_accesses(child, vars, accesses);
+}
+
+
+LivenessAnalysis::LivenessAnalysis(const ControlFlowGraph &cfg, FlowVariables &vars)
+  : _mCFG(cfg), _mVars(vars) {
+  GenKillProblem problem(cfg, vars.size(), DF_BACKWARD);
+  for (uint32_t block_id = 0; block_id < cfg.getNumBlocks(); ++block_id) {
+    auto &gen = problem.gen[block_id];
+    auto &kill = problem.kill[block_id];
+    const auto &nodes = cfg.getBlock(block_id).nodes;
+    for (auto node_iter = nodes.rbegin(); node_iter != nodes.rend(); ++node_iter) {
+      transfer(*node_iter, gen);
+      for (auto &access : _mAccesses) {
+        if (access.writes && !access.partial)
+          kill.set(access.var);
+      }
+    }
+  }
+  _mResult = solve_dataflow(cfg, problem);
+}
+
+void LivenessAnalysis::transfer(LSLASTNode *node, BitVector &live) {
+  _mAccesses.clear();
+  collect_flow_accesses(node, _mVars, _mAccesses);
+  // everything `node` reads happens before whatever it writes
+  for (auto &access : _mAccesses) {
+    if (access.writes && !access.partial)
+      live.reset(access.var);
+  }
+  for (auto &access : _mAccesses) {
+    if (access.reads)
+      live.set(access.var);
+  }
+}
+
+BitVector LivenessAnalysis::getLiveAfter(LSLASTNode *node) {
+  auto loc = _mCFG.findNode(node);
+  assert(loc.first != NO_BLOCK);
+  BitVector live = _mResult.out[loc.first];
+  const auto &nodes = _mCFG.getBlock(loc.first).nodes;
+  for (auto i = (uint32_t)nodes.size(); i > loc.second + 1; --i)
+    transfer(nodes[i - 1], live);
+  return live;
+}
+
+
+ReachingDefinitions::ReachingDefinitions(const ControlFlowGraph &cfg, FlowVariables &vars)
+  : _mCFG(cfg), _mVars(vars) {
+  // number every definition before building any sets of them
+  auto *func_like = cfg.getFunctionLike();
+  for (auto *param : *func_like->getChild(1)) {
+    if (_mVars.getIndex(param->getSymbol()) != NO_FLOW_INDEX)
+      _mDefs.push_back({param->getSymbol(), param, ControlFlowGraph::ENTRY, false});
+  }
+  auto num_param_defs = (uint32_t)_mDefs.size();
+  for (uint32_t block_id = 0; block_id < cfg.getNumBlocks(); ++block_id) {
+    for (auto *node : cfg.getBlock(block_id).nodes) {
+      _mAccesses.clear();
+      collect_flow_accesses(node, _mVars, _mAccesses);
+      for (auto &access : _mAccesses) {
+        if (!access.writes)
+          continue;
+        _mDefIds[access.node] = (uint32_t)_mDefs.size();
+        _mDefs.push_back({_mVars.getSymbol(access.var), access.node, block_id, access.partial});
+      }
+    }
+  }
+
+  auto num_defs = (uint32_t)_mDefs.size();
+  _mVarDefs.assign(_mVars.size(), BitVector(num_defs));
+  for (uint32_t def_id = 0; def_id < num_defs; ++def_id)
+    _mVarDefs[_mVars.getIndex(_mDefs[def_id].symbol)].set(def_id);
+
+  GenKillProblem problem(cfg, num_defs, DF_FORWARD);
+  // parameters are defined on the way in
+  for (uint32_t def_id = 0; def_id < num_param_defs; ++def_id)
+    problem.gen[ControlFlowGraph::ENTRY].set(def_id);
+  for (uint32_t block_id = 0; block_id < cfg.getNumBlocks(); ++block_id) {
+    for (auto *node : cfg.getBlock(block_id).nodes)
+      transfer(node, problem.gen[block_id], &problem.kill[block_id]);
+  }
+  _mResult = solve_dataflow(cfg, problem);
+}
+
+void ReachingDefinitions::transfer(LSLASTNode *node, BitVector &reaching, BitVector *killed) {
+  _mAccesses.clear();
+  collect_flow_accesses(node, _mVars, _mAccesses);
+  for (auto &access : _mAccesses) {
+    if (!access.writes)
+      continue;
+    // writing part of a value leaves the rest of what was there before
+    if (!access.partial) {
+      reaching.subtract(_mVarDefs[access.var]);
+      if (killed)
+        killed->unionWith(_mVarDefs[access.var]);
+    }
+    reaching.set(_mDefIds[access.node]);
+  }
+}
+
+std::vector<const DefinitionSite *> ReachingDefinitions::getReachingDefs(LSLLValueExpression *lvalue) {
+  std::vector<const DefinitionSite *> defs;
+  uint32_t var = _mVars.getIndex(lvalue->getSymbol());
+  auto loc = _mCFG.findEnclosingNode(lvalue);
+  if (var == NO_FLOW_INDEX || loc.first == NO_BLOCK)
+    return defs;
+
+  BitVector reaching = _mResult.in[loc.first];
+  const auto &nodes = _mCFG.getBlock(loc.first).nodes;
+  for (uint32_t i = 0; i < loc.second; ++i)
+    transfer(nodes[i], reaching);
+  reaching.intersectWith(_mVarDefs[var]);
+  for (uint32_t def_id = 0; def_id < _mDefs.size(); ++def_id) {
+    if (reaching.test(def_id))
+      defs.push_back(&_mDefs[def_id]);
+  }
+  return defs;
+}
+
+
+static bool constants_equal(LSLConstant *a, LSLConstant *b) {
+  if (a == b)
+    return true;
+  if (a->getIType() != b->getIType())
+    return false;
+  // compare floats bitwise, `-0.0` and `0.0` aren't interchangeable and NaN is the same as NaN.
+  switch (a->getIType()) {
+    case LST_INTEGER:
+      return ((LSLIntegerConstant *)a)->getValue() == ((LSLIntegerConstant *)b)->getValue();
+    case LST_FLOATINGPOINT: {
+      double a_val = ((LSLFloatConstant *)a)->getValue();
+      double b_val = ((LSLFloatConstant *)b)->getValue();
+      return !memcmp(&a_val, &b_val, sizeof(double));
+    }
+    case LST_STRING:
+    case LST_KEY:
+      return !strcmp(((LSLStringConstant *)a)->getValue(), ((LSLStringConstant *)b)->getValue());
+    case LST_VECTOR:
+      return !memcmp(((LSLVectorConstant *)a)->getValue(), ((LSLVectorConstant *)b)->getValue(), sizeof(Vector3));
+    case LST_QUATERNION:
+      return !memcmp(((LSLQuaternionConstant *)a)->getValue(), ((LSLQuaternionConstant *)b)->getValue(), sizeof(Quaternion));
+    default:
+      // not worth comparing lists element by element, just say they might differ.
+      return false;
+  }
+}
+
+bool FlowConstant::operator==(const FlowConstant &other) const {
+  if (kind != other.kind)
+    return false;
+  return kind != CONSTANT || constants_equal(value, other.value);
+}
+
+ConstantPropagation::ConstantPropagation(const ControlFlowGraph &cfg, FlowVariables &vars,
+                                         AOperationBehavior *behavior, ScriptAllocator *allocator)
+  : _mCFG(cfg), _mVars(vars), _mOperationBehavior(behavior),
+    _mOne(allocator->newTracked<LSLIntegerConstant>(1)) {
+  _mResult = solve_dataflow(cfg, *this);
+}
+
+ConstantPropagation::Value ConstantPropagation::getBoundary() const {
+  // We can't know what parameters were passed. Locals would normally be given a value by
+  // their declaration, but a jump can skip past that and leave whatever was in their slot.
+  return Value(_mVars.size(), {FlowConstant::OVERDEFINED, nullptr});
+}
+
+void ConstantPropagation::meet(Value &into, const Value &other) const {
+  for (size_t i = 0; i < into.size(); ++i) {
+    auto &into_val = into[i];
+    const auto &other_val = other[i];
+    if (other_val.kind == FlowConstant::UNDEFINED || into_val.kind == FlowConstant::OVERDEFINED)
+      continue;
+    if (into_val.kind == FlowConstant::UNDEFINED)
+      into_val = other_val;
+    else if (into_val != other_val)
+      into_val = {FlowConstant::OVERDEFINED, nullptr};
+  }
+}
+
+void ConstantPropagation::transfer(uint32_t block, const Value &before, Value &after) {
+  after = before;
+  for (auto *node : _mCFG.getBlock(block).nodes)
+    transfer(node, after);
+}
+
+void ConstantPropagation::transfer(LSLASTNode *node, Value &state) {
+  _mAccesses.clear();
+  collect_flow_accesses(node, _mVars, _mAccesses);
+  size_t num_writes = 0;
+  for (auto &access : _mAccesses)
+    num_writes += access.writes;
+  if (!num_writes)
+    return;
+
+  // Anything written gets evaluated against the state from before `node`.
+  // That's only right if there's a single write, there's no telling what
+  // `(x = 1) + x` should be without getting into evaluation order.
+  Value old_state;
+  if (num_writes == 1)
+    old_state = state;
+  for (auto &access : _mAccesses) {
+    if (!access.writes)
+      continue;
+    LSLConstant *cv = (num_writes == 1) ? evaluateWrite(access, old_state) : nullptr;
+    if (cv)
+      state[access.var] = {FlowConstant::CONSTANT, cv};
+    else
+      state[access.var] = {FlowConstant::OVERDEFINED, nullptr};
+  }
+}
+
+LSLConstant *ConstantPropagation::evaluateWrite(const FlowAccess &access, const Value &state) {
+  if (access.partial)
+    return nullptr;
+  auto *sym = _mVars.getSymbol(access.var);
+  LSLConstant *cv;
+  if (access.node->getNodeType() == NODE_STATEMENT) {
+    auto *init = ((LSLDeclaration *)access.node)->getInitializer();
+    cv = init ? evaluate(init, state) : sym->getType()->getDefaultValue();
+  } else {
+    auto *expr = (LSLExpression *)access.node;
+    auto op = expr->getOperation();
+    const FlowConstant &old_val = state[access.var];
+    LSLConstant *old_cv = (old_val.kind == FlowConstant::CONSTANT) ? old_val.value : nullptr;
+    switch (op) {
+      case OP_ASSIGN:
+        cv = evaluate(expr->getChild(1), state);
+        break;
+      case OP_PRE_INCR:
+      case OP_POST_INCR:
+      case OP_PRE_DECR:
+      case OP_POST_DECR: {
+        bool incr = op == OP_PRE_INCR || op == OP_POST_INCR;
+        cv = old_cv ? _mOperationBehavior->operation(incr ? OP_PLUS : OP_MINUS, old_cv, _mOne, expr->getLoc()) : nullptr;
+        break;
+      }
+      default: {
+        auto *rhs_cv = evaluate(expr->getChild(1), state);
+        if (old_cv && rhs_cv)
+          cv = _mOperationBehavior->operation(decouple_compound_operation(op), old_cv, rhs_cv, expr->getLoc());
+        else
+          cv = nullptr;
+        break;
+      }
+    }
+  }
+
+  // same promotion an assignment would do, `float f = 1;` holds `1.0`.
+  if (cv && cv->getType() != sym->getType()) {
+    if (cv->getType()->canCoerce(sym->getType()))
+      cv = _mOperationBehavior->cast(sym->getType(), cv, cv->getLoc());
+    else
+      cv = nullptr;
+  }
+  return cv;
+}
+
+LSLConstant *ConstantPropagation::evaluate(LSLASTNode *node, const Value &state) {
+  if (!node || node->getIType() == LST_ERROR)
+    return nullptr;
+  switch (node->getNodeSubType()) {
+    case NODE_LVALUE_EXPRESSION: {
+      auto *lvalue = (LSLLValueExpression *)node;
+      uint32_t var = _mVars.getIndex(lvalue->getSymbol());
+      if (var == NO_FLOW_INDEX)
+        return lvalue->getConstantValue();
+      if (lvalue->getMember() || state[var].kind != FlowConstant::CONSTANT)
+        return nullptr;
+      return state[var].value;
+    }
+    case NODE_PARENTHESIS_EXPRESSION:
+      return evaluate(node->getChild(0), state);
+    case NODE_TYPECAST_EXPRESSION: {
+      auto *cv = evaluate(node->getChild(0), state);
+      return cv ? _mOperationBehavior->cast(node->getType(), cv, node->getLoc()) : nullptr;
+    }
+    case NODE_BINARY_EXPRESSION:
+    case NODE_UNARY_EXPRESSION: {
+      auto op = ((LSLExpression *)node)->getOperation();
+      if (operation_mutates(op))
+        return nullptr;
+      auto *left_cv = evaluate(node->getChild(0), state);
+      if (!left_cv)
+        return nullptr;
+      LSLConstant *right_cv = nullptr;
+      if (node->getNodeSubType() == NODE_BINARY_EXPRESSION) {
+        right_cv = evaluate(node->getChild(1), state);
+        if (!right_cv)
+          return nullptr;
+      }
+      return _mOperationBehavior->operation(op, left_cv, right_cv, node->getLoc());
+    }
+    default:
+      // anything else is only constant if it'd be constant no matter where it was
+      return node->getConstantValue();
+  }
+}
+
+LSLConstant *ConstantPropagation::getConstantValue(LSLExpression *expr) {
+  auto loc = _mCFG.findEnclosingNode(expr);
+  if (loc.first == NO_BLOCK)
+    return nullptr;
+  Value state = _mResult.in[loc.first];
+  const auto &nodes = _mCFG.getBlock(loc.first).nodes;
+  for (uint32_t i = 0; i < loc.second; ++i)
+    transfer(nodes[i], state);
+  return evaluate(expr, state);
+}
+
+}
@@ -0,0 +1,270 @@
+#ifndef TAILSLIDE_DATAFLOW_HH
+#define TAILSLIDE_DATAFLOW_HH
+
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
+#include "../lslmini.hh"
+#include "../operations.hh"
+#include "control_flow.hh"
+
+namespace Tailslide {
+
+/// Fixed-size set of small integers, for dataflow facts about variables or definitions
+class BitVector {
+  public:
+    BitVector() = default;
+    explicit BitVector(uint32_t num_bits, bool value=false);
+
+    uint32_t size() const { return _mNumBits; }
+    bool test(uint32_t bit) const { return (_mWords[bit / 64] >> (bit % 64)) & 1; }
+    void set(uint32_t bit) { _mWords[bit / 64] |= (uint64_t)1 << (bit % 64); }
+    void reset(uint32_t bit) { _mWords[bit / 64] &= ~((uint64_t)1 << (bit % 64)); }
+    uint32_t count() const;
+
+    void unionWith(const BitVector &other);
+    void intersectWith(const BitVector &other);
+    void subtract(const BitVector &other);
+    bool operator==(const BitVector &other) const { return _mWords == other._mWords; }
+    bool operator!=(const BitVector &other) const { return _mWords != other._mWords; }
+
+  private:
+    std::vector<uint64_t> _mWords;
+    uint32_t _mNumBits = 0;
+};
+
+enum DataflowDirection { DF_FORWARD, DF_BACKWARD };
+
+/// Facts at the start and end of each block, in program order no matter
+/// which direction the problem flows in.
+template <typename T>
+struct DataflowResult {
+  std::vector<T> in;
+  std::vector<T> out;
+};
+
+/// Iterate a dataflow problem over `cfg` to a fixed point with a worklist.
+/// `Problem` provides:
+///  * `Value`, the type of the facts flowing between blocks, comparable with `!=`
+///  * `getDirection()`
+///  * `getInitial()`, the identity for `meet()` that every block starts out with
+///  * `getBoundary()`, what flows into the entry, or out of the exit for backward problems
+///  * `meet(Value &into, const Value &other)`
+///  * `transfer(uint32_t block, const Value &before, Value &after)`, where `before`
+///    and `after` are in the direction of flow.
+/// Blocks that can't be reached from the entry are left as `getInitial()`.
+template <typename Problem>
+DataflowResult<typename Problem::Value> solve_dataflow(const ControlFlowGraph &cfg, Problem &problem) {
+  typedef typename Problem::Value Value;
+  const bool forward = problem.getDirection() == DF_FORWARD;
+  const uint32_t num_blocks = cfg.getNumBlocks();
+  DataflowResult<Value> result;
+  result.in.assign(num_blocks, problem.getInitial());
+  result.out.assign(num_blocks, problem.getInitial());
+  // facts flowing into and out of blocks in the direction of flow
+  auto &flow_in = forward ? result.in : result.out;
+  auto &flow_out = forward ? result.out : result.in;
+  const uint32_t boundary_block = forward ? ControlFlowGraph::ENTRY : ControlFlowGraph::EXIT;
+
+  // visiting in reverse postorder (or its reverse going backward) means most
+  // blocks only need to be looked at once outside of loops.
+  const auto &rpo = cfg.getReversePostorder();
+  std::deque<uint32_t> worklist;
+  if (forward)
+    worklist.assign(rpo.begin(), rpo.end());
+  else
+    worklist.assign(rpo.rbegin(), rpo.rend());
+  std::vector<bool> queued(num_blocks, false);
+  for (auto block_id : worklist)
+    queued[block_id] = true;
+
+  while (!worklist.empty()) {
+    uint32_t block_id = worklist.front();
+    worklist.pop_front();
+    queued[block_id] = false;
+    const auto &block = cfg.getBlock(block_id);
+
+    Value before = problem.getInitial();
+    if (block_id == boundary_block)
+      problem.meet(before, problem.getBoundary());
+    for (auto neighbor : forward ? block.preds : block.succs) {
+      if (cfg.isReachable(neighbor))
+        problem.meet(before, flow_out[neighbor]);
+    }
+    Value after = problem.getInitial();
+    problem.transfer(block_id, before, after);
+    flow_in[block_id] = std::move(before);
+    if (after != flow_out[block_id]) {
+      flow_out[block_id] = std::move(after);
+      for (auto neighbor : forward ? block.succs : block.preds) {
+        if (!queued[neighbor] && cfg.isReachable(neighbor)) {
+          queued[neighbor] = true;
+          worklist.push_back(neighbor);
+        }
+      }
+    }
+  }
+  return result;
+}
+
+/// A problem where each block's effect on a set is `after = gen | (before & ~kill)`,
+/// and sets meet by union or intersection.
+struct GenKillProblem {
+  typedef BitVector Value;
+
+  GenKillProblem(const ControlFlowGraph &cfg, uint32_t num_bits, DataflowDirection direction, bool intersect=false);
+
+  DataflowDirection getDirection() const { return direction; }
+  BitVector getInitial() const { return BitVector(num_bits, intersect); }
+  const BitVector &getBoundary() const { return boundary; }
+  void meet(BitVector &into, const BitVector &other) const;
+  void transfer(uint32_t block, const BitVector &before, BitVector &after) const;
+
+  uint32_t num_bits;
+  DataflowDirection direction;
+  bool intersect;
+  std::vector<BitVector> gen;
+  std::vector<BitVector> kill;
+  BitVector boundary;
+};
+
+const uint32_t NO_FLOW_INDEX = UINT32_MAX;
+
+/// Local variables and parameters of a function-like, numbered densely so
+/// sets of them fit in `BitVector`s. Globals aren't tracked since any function
+/// call could change them.
+class FlowVariables {
+  public:
+    explicit FlowVariables(LSLASTNode *func_like);
+    uint32_t size() const { return (uint32_t)_mSymbols.size(); }
+    LSLSymbol *getSymbol(uint32_t index) const { return _mSymbols[index]; }
+    /// `NO_FLOW_INDEX` if `sym` isn't tracked
+    uint32_t getIndex(LSLSymbol *sym);
+    uint32_t getNumParams() const { return _mNumParams; }
+
+  protected:
+    void collectLocals(LSLASTNode *node);
+    void addSymbol(LSLSymbol *sym);
+    // parameters come first
+    std::vector<LSLSymbol *> _mSymbols;
+    // index + 1, so default-constructed entries mean "not tracked"
+    SymbolDataVector<uint32_t> _mIndices;
+    uint32_t _mNumParams = 0;
+};
+
+/// A read or write of a tracked variable within one of a CFG block's nodes
+struct FlowAccess {
+  uint32_t var;
+  // the lvalue being read, or the declaration or mutating expression doing the writing
+  LSLASTNode *node;
+  bool reads;
+  bool writes;
+  // writes that don't replace the whole value, like `vec.x = 1.0`
+  bool partial;
+};
+
+/// Reads and writes of tracked variables in `node`, in the order they take effect.
+/// Reads by compound assignments and increments are folded into their write.
+void collect_flow_accesses(LSLASTNode *node, FlowVariables &vars, std::vector<FlowAccess> &accesses);
+
+/// Which variables may still be read before being overwritten
+class LivenessAnalysis {
+  public:
+    LivenessAnalysis(const ControlFlowGraph &cfg, FlowVariables &vars);
+    const BitVector &getLiveIn(uint32_t block) const { return _mResult.in[block]; }
+    const BitVector &getLiveOut(uint32_t block) const { return _mResult.out[block]; }
+    /// Variables live right after `node`, one of the CFG blocks' nodes
+    BitVector getLiveAfter(LSLASTNode *node);
+
+  protected:
+    // step `live` backward over `node`
+    void transfer(LSLASTNode *node, BitVector &live);
+
+    const ControlFlowGraph &_mCFG;
+    FlowVariables &_mVars;
+    DataflowResult<BitVector> _mResult;
+    std::vector<FlowAccess> _mAccesses;
+};
+
+struct DefinitionSite {
+  LSLSymbol *symbol;
+  // the parameter's identifier, the declaration or the mutating expression
+  LSLASTNode *node;
+  uint32_t block;
+  bool partial;
+};
+
+/// Which definitions of variables may reach each point without being overwritten
+class ReachingDefinitions {
+  public:
+    ReachingDefinitions(const ControlFlowGraph &cfg, FlowVariables &vars);
+    const std::vector<DefinitionSite> &getDefinitions() const { return _mDefs; }
+    const BitVector &getReachingIn(uint32_t block) const { return _mResult.in[block]; }
+    const BitVector &getReachingOut(uint32_t block) const { return _mResult.out[block]; }
+    /// Definitions of `lvalue`'s variable that may reach the start of the CFG node it's in
+    std::vector<const DefinitionSite *> getReachingDefs(LSLLValueExpression *lvalue);
+
+  protected:
+    // step `reaching` forward over `node`
+    void transfer(LSLASTNode *node, BitVector &reaching, BitVector *killed=nullptr);
+
+    const ControlFlowGraph &_mCFG;
+    FlowVariables &_mVars;
+    std::vector<DefinitionSite> _mDefs;
+    std::unordered_map<LSLASTNode *, uint32_t> _mDefIds;
+    // every definition of each variable
+    std::vector<BitVector> _mVarDefs;
+    DataflowResult<BitVector> _mResult;
+    std::vector<FlowAccess> _mAccesses;
+};
+
+/// Where a variable sits in the constant lattice: nothing has been assigned to it
+/// yet, it has one particular value, or it may have more than one.
+struct FlowConstant {
+  enum Kind : uint8_t { UNDEFINED, CONSTANT, OVERDEFINED };
+  Kind kind = UNDEFINED;
+  LSLConstant *value = nullptr;
+
+  bool operator==(const FlowConstant &other) const;
+  bool operator!=(const FlowConstant &other) const { return !(*this == other); }
+};
+
+/// Which variables are known to hold a single constant value at each point.
+/// Branch conditions aren't taken into account, both sides of every branch are
+/// assumed to be taken.
+class ConstantPropagation {
+  public:
+    typedef std::vector<FlowConstant> Value;
+
+    ConstantPropagation(const ControlFlowGraph &cfg, FlowVariables &vars,
+                        AOperationBehavior *behavior, ScriptAllocator *allocator);
+    const Value &getIn(uint32_t block) const { return _mResult.in[block]; }
+    const Value &getOut(uint32_t block) const { return _mResult.out[block]; }
+    /// Value of `expr` as of the start of the CFG node it's in, or null if it may have more than one
+    LSLConstant *getConstantValue(LSLExpression *expr);
+
+    // for `solve_dataflow()`
+    DataflowDirection getDirection() const { return DF_FORWARD; }
+    Value getInitial() const { return Value(_mVars.size()); }
+    Value getBoundary() const;
+    void meet(Value &into, const Value &other) const;
+    void transfer(uint32_t block, const Value &before, Value &after);
+
+  protected:
+    // step `state` forward over `node`
+    void transfer(LSLASTNode *node, Value &state);
+    LSLConstant *evaluate(LSLASTNode *node, const Value &state);
+    LSLConstant *evaluateWrite(const FlowAccess &access, const Value &state);
+
+    const ControlFlowGraph &_mCFG;
+    FlowVariables &_mVars;
+    AOperationBehavior *_mOperationBehavior;
+    LSLConstant *_mOne;
+    DataflowResult<Value> _mResult;
+    std::vector<FlowAccess> _mAccesses;
+};
+
+}
+
+#endif //TAILSLIDE_DATAFLOW_HH
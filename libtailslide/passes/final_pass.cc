@@ -37,6 +37,14 @@ class AllPathsReturnVisitor: public ASTVisitor {
     bool mAllReturn = false;
 };
 
+bool FinalPassVisitor::visitSpecific(LSLASTNode *node) {
+  if (_mCheckSymbols) {
+    if (auto *symtab = node->getSymbolTable())
+      symtab->checkSymbols();
+  }
+  return ASTVisitor::visitSpecific(node);
+}
+
 bool FinalPassVisitor::visit(LSLGlobalFunction *glob_func) {
   AllPathsReturnVisitor visitor;
   glob_func->getStatements()->visit(&visitor);
@@ -7,11 +7,16 @@ namespace Tailslide {
 
 class FinalPassVisitor : public ASTVisitor {
   public:
+    // `check_symbols` also does `checkSymbols()` for each node's symbol table.
+    explicit FinalPassVisitor(bool check_symbols=false): _mCheckSymbols(check_symbols) {}
+    virtual bool visitSpecific(LSLASTNode *node);
     virtual bool visit(LSLGlobalFunction *glob_func);
     virtual bool visit(LSLEventHandler *handler);
     virtual bool visit(LSLIfStatement *if_stmt);
     virtual bool visit(LSLBinaryExpression *bin_expr);
     virtual bool visit(LSLExpressionStatement *expr_stmt);
+  protected:
+    bool _mCheckSymbols;
 };
 
 }
@@ -9,36 +9,40 @@
 
 namespace Tailslide {
 
-class LSOBytecodeCompiler : public ASTVisitor {
+class LSOBytecodeCompiler : public StaticASTVisitor<LSOBytecodeCompiler> {
+  friend StaticASTVisitor;
   public:
-    explicit LSOBytecodeCompiler(LSOSymbolDataMap &symbol_data_map) : _mSymData (symbol_data_map) {}
+    /// Bytecode is written straight into `code_bs` at its current position.
+    LSOBytecodeCompiler(LSOSymbolDataMap &symbol_data_map, LSOBitStream &code_bs)
+      : _mSymData (symbol_data_map), mCodeBS(code_bs) {}
 
   protected:
+    using StaticASTVisitor::visit;
     void buildFunction(LSLASTNode *func);
-    bool visit(LSLEventHandler *handler) override;
-    bool visit(LSLGlobalFunction *glob_func) override;
-
-    bool visit(LSLConstantExpression *constant_expr) override;
-    bool visit(LSLVectorExpression *vec_expr) override;
-    bool visit(LSLQuaternionExpression *quat_expr) override;
-    bool visit(LSLListExpression *list_expr) override;
-    bool visit(LSLUnaryExpression *unary_expr) override;
-    bool visit(LSLBinaryExpression *bin_expr) override;
-    bool visit(LSLLValueExpression *lvalue) override;
-    bool visit(LSLTypecastExpression *cast_expr) override;
-    bool visit(LSLPrintExpression *print_expr) override;
-    bool visit(LSLFunctionExpression *func_expr) override;
-
-    bool visit(LSLExpressionStatement *expr_stmt) override;
-    bool visit(LSLJumpStatement *jump_stmt) override;
-    bool visit(LSLLabel *label_stmt) override;
-    bool visit(LSLIfStatement *if_stmt) override;
-    bool visit(LSLForStatement *for_stmt) override;
-    bool visit(LSLWhileStatement *while_stmt) override;
-    bool visit(LSLDoStatement *do_stmt) override;
-    bool visit(LSLDeclaration *decl_stmt) override;
-    bool visit(LSLReturnStatement *ret_stmt) override;
-    bool visit(LSLStateStatement *state_stmt) override;
+    bool visit(LSLEventHandler *handler);
+    bool visit(LSLGlobalFunction *glob_func);
+
+    bool visit(LSLConstantExpression *constant_expr);
+    bool visit(LSLVectorExpression *vec_expr);
+    bool visit(LSLQuaternionExpression *quat_expr);
+    bool visit(LSLListExpression *list_expr);
+    bool visit(LSLUnaryExpression *unary_expr);
+    bool visit(LSLBinaryExpression *bin_expr);
+    bool visit(LSLLValueExpression *lvalue);
+    bool visit(LSLTypecastExpression *cast_expr);
+    bool visit(LSLPrintExpression *print_expr);
+    bool visit(LSLFunctionExpression *func_expr);
+
+    bool visit(LSLExpressionStatement *expr_stmt);
+    bool visit(LSLJumpStatement *jump_stmt);
+    bool visit(LSLLabel *label_stmt);
+    bool visit(LSLIfStatement *if_stmt);
+    bool visit(LSLForStatement *for_stmt);
+    bool visit(LSLWhileStatement *while_stmt);
+    bool visit(LSLDoStatement *do_stmt);
+    bool visit(LSLDeclaration *decl_stmt);
+    bool visit(LSLReturnStatement *ret_stmt);
+    bool visit(LSLStateStatement *state_stmt);
 
     void pushConstant(LSLConstant *constant);
     int32_t calculateLValueOffset(LSLLValueExpression *lvalue);
@@ -55,7 +59,7 @@ class LSOBytecodeCompiler : public ASTVisitor {
     std::map<std::string, uint32_t> _mLabelMap;
 
   public:
-    LSOBitStream mCodeBS {ENDIAN_BIG};
+    LSOBitStream &mCodeBS;
 };
 
 }
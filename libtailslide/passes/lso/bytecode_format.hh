@@ -301,18 +301,19 @@ inline uint8_t pack_lso_types(LSLIType left, LSLIType right) {
 /// LSO-specific bitstream with LSO-specific serialization helpers
 class LSOBitStream : public BitStream {
   public:
-  explicit LSOBitStream(Endianness endian=ENDIAN_BIG) : BitStream(endian) {}
+  /// LSO is always big-endian, so the byte order is baked into every read and write.
+  LSOBitStream() : BitStream(ENDIAN_BIG) {}
   LSOBitStream(LSOBitStream &&other) noexcept: BitStream(std::move(other)) {}
   LSOBitStream(const LSOBitStream &other) = delete;
   /// need to help the type system realize that this returns an LSOBitStream.
   /// should be fine because we never refer to BitStream subclasses by their base class.
   template<typename T>
   LSOBitStream &operator<<(const T &data) {
-    return static_cast<LSOBitStream&>(BitStream::operator<<(data));
+    return static_cast<LSOBitStream&>(BitStream::writeValue<ENDIAN_BIG>(data));
   };
   template<typename T>
   LSOBitStream &operator>>(T &data) {
-    return static_cast<LSOBitStream&>(BitStream::operator>>(data));
+    return static_cast<LSOBitStream&>(BitStream::readValue<ENDIAN_BIG>(data));
   };
 };
 
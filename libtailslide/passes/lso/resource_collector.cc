@@ -5,8 +5,7 @@
 namespace Tailslide {
 bool LSOResourceVisitor::visit(LSLScript *script) {
   // build up symbol data for library functions
-  for (auto builtin_val: script->mContext->builtins->getMap()) {
-    auto *sym = builtin_val.second;
+  for (auto *sym : script->mContext->builtins->getSymbols()) {
     if (sym->getSymbolType() != SYM_FUNCTION)
       continue;
     auto sym_data = getSymbolData(sym);
@@ -118,11 +117,7 @@ void LSOResourceVisitor::handleFuncDecl(LSOSymbolData *func_sym_data, LSLASTNode
 }
 
 LSOSymbolData *LSOResourceVisitor::getSymbolData(LSLSymbol *sym) {
-  auto sym_iter = _mSymData->find(sym);
-  if (sym_iter != _mSymData->end())
-    return &sym_iter->second;
-  (*_mSymData)[sym] = {};
-  return &_mSymData->find(sym)->second;
+  return &(*_mSymData)[sym];
 }
 
 }
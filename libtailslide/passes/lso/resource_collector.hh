@@ -1,6 +1,5 @@
 #pragma once
 
-#include <map>
 #include <vector>
 
 #include "bytecode_format.hh"
@@ -23,7 +22,7 @@ struct LSOSymbolData {
   std::vector<LSLIType> function_args{};
 };
 
-typedef std::map<Tailslide::LSLSymbol *, LSOSymbolData> LSOSymbolDataMap;
+typedef SymbolDataVector<LSOSymbolData> LSOSymbolDataMap;
 
 // Walks the script, figuring out how much space to reserve for data slots
 // and what order to place them in.
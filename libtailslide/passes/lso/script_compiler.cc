@@ -1,3 +1,7 @@
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
 #include "../desugaring.hh"
 #include "bytecode_compiler.hh"
 #include "bytecode_format.hh"
@@ -19,21 +23,43 @@ uint64_t pack_handled_events(LSOSymbolData *state_data) {
 
 LSLExpression *resolve_sa_identifier(LSLExpression *rvalue);
 
+// Most nodes turn into an opcode and maybe an operand or two
+const uint32_t ESTIMATED_BYTES_PER_NODE = 4;
+
+// Rough guess at how many bytes a function or state will take up, so its section
+// can be presized rather than growing a few bytes at a time.
+static uint32_t estimate_size(LSLASTNode *node) {
+  uint32_t size = ESTIMATED_BYTES_PER_NODE;
+  for (auto *child : *node)
+    size += estimate_size(child);
+  return size;
+}
+
 bool LSOScriptCompiler::visit(LSLScript *script) {
   LLConformantDeSugaringVisitor de_sugaring_visitor(_mAllocator, false);
   script->visit(&de_sugaring_visitor);
+  // every symbol's data has to stay put while the resource visitor holds onto it
+  _mSymData.reserveIds(get_num_builtin_symbol_ids(), script->mContext->num_symbol_ids);
   LSOResourceVisitor resource_visitor(&_mSymData);
   script->visit(&resource_visitor);
 
   _mRegistersBS.makeSpace(LSO_REGISTER_OFFSETS[LREG_MAX]);
 
+  // presize the code sections, nothing can be bigger than the script's memory anyway.
+  uint32_t funcs_estimate = 0;
+  for (auto *global : *script->getGlobals()) {
+    if (global->getNodeType() == NODE_GLOBAL_FUNCTION)
+      funcs_estimate += estimate_size(global);
+  }
+  uint32_t states_estimate = estimate_size(script->getStates());
+  _mFunctionsBS.reserve(std::min(funcs_estimate, (uint32_t)TOTAL_LSO_MEMORY));
+  _mStatesBS.reserve(std::min(states_estimate, (uint32_t)TOTAL_LSO_MEMORY));
+
   // figure out if we have any functions, and if so what the highest index is.
   uint32_t num_funcs = 0;
-  for (auto &sym_data : _mSymData) {
-    auto *sym = sym_data.first;
-    if (sym->getSymbolType() != SYM_FUNCTION || sym->getSubType() == SYM_BUILTIN)
-      continue;
-    ++num_funcs;
+  for (auto *global : *script->getGlobals()) {
+    if (global->getNodeType() == NODE_GLOBAL_FUNCTION)
+      ++num_funcs;
   }
 
   // only need to write the function header if we actually have any functions
@@ -69,10 +95,7 @@ bool LSOScriptCompiler::visit(LSLScript *script) {
       // TODO: LSO v1 compat
       _mStatesBS << (uint32_t)state_pos << pack_handled_events(state_data);
     }
-    // resize keeps the underlying buffer allocated
-    _mStateBS.resize(0);
     state->visit(this);
-    _mStatesBS.writeBitStream(_mStateBS);
     if (checkStackHeapCollision()) {
       NODE_ERROR(script, E_STACK_HEAP_COLLISION);
       return false;
@@ -86,21 +109,22 @@ bool LSOScriptCompiler::visit(LSLScript *script) {
   writeRegister(LREG_BP, TOTAL_LSO_MEMORY - 1);
   writeRegister(LREG_SP, TOTAL_LSO_MEMORY - 1);
 
-  // record where the variables start
+  // Every section's size is known by now, so lay them out back to back
+  // after the registers and fill in where each one starts.
   // TODO: This will break if we're writing v1 bytecode, the registers end earlier!
-  writeRegister(LREG_GVR, LSO_REGISTER_OFFSETS[LREG_MAX]);
-  // allocate all of the script memory and fill with zeros
-  mScriptBS.makeSpace(TOTAL_LSO_MEMORY);
-  // Write in the global variables
-  mScriptBS.moveTo(LSO_REGISTER_OFFSETS[LREG_MAX]);
-  mScriptBS.writeBitStream(_mGlobalVarManager.mGlobalsBS);
+  const uint32_t globals_start = LSO_REGISTER_OFFSETS[LREG_MAX];
+  const uint32_t funcs_start = globals_start + (uint32_t)_mGlobalVarManager.mGlobalsBS.size();
+  const uint32_t states_start = funcs_start + (uint32_t)_mFunctionsBS.size();
+  const uint32_t heap_start = states_start + (uint32_t)_mStatesBS.size();
+  const uint32_t heap_end = heap_start + (uint32_t)_mHeapManager.mHeapBS.size();
+  assert(heap_end <= TOTAL_LSO_MEMORY);
 
+  // record where the variables start
+  writeRegister(LREG_GVR, globals_start);
   // mark the end of the globals as the start of the functions
-  writeRegister(LREG_GFR, mScriptBS.pos());
-  mScriptBS.writeBitStream(_mFunctionsBS);
+  writeRegister(LREG_GFR, funcs_start);
   // mark the start of the state entries, marks the end of the functions
-  writeRegister(LREG_SR, mScriptBS.pos());
-  mScriptBS.writeBitStream(_mStatesBS);
+  writeRegister(LREG_SR, states_start);
 
   // Initial current event is _always_ state_entry, even if there's no state_entry handler
   // defined! The consumer is expected to do a bitwise and against the handled events bitfield.
@@ -109,13 +133,25 @@ bool LSOScriptCompiler::visit(LSLScript *script) {
   writeEventRegister(LREG_NER, pack_handled_events(&_mSymData[states->getChild(0)->getSymbol()]));
 
   // mark where the heap starts
-  writeRegister(LREG_HR, mScriptBS.pos());
-  mScriptBS.writeBitStream(_mHeapManager.mHeapBS);
+  writeRegister(LREG_HR, heap_start);
   // mark the top of the heap
-  writeRegister(LREG_HP, mScriptBS.pos());
-  // go back and write in the registers
-  mScriptBS.moveTo(0);
-  mScriptBS.writeBitStream(_mRegistersBS);
+  writeRegister(LREG_HP, heap_end);
+
+  // allocate all of the script memory and fill with zeros, then copy each section
+  // straight to where it belongs.
+  mScriptBS.resize(TOTAL_LSO_MEMORY);
+  const std::pair<uint32_t, const LSOBitStream *> sections[] = {
+      {0, &_mRegistersBS},
+      {globals_start, &_mGlobalVarManager.mGlobalsBS},
+      {funcs_start, &_mFunctionsBS},
+      {states_start, &_mStatesBS},
+      {heap_start, &_mHeapManager.mHeapBS},
+  };
+  for (auto &section : sections) {
+    if (!section.second->empty())
+      memcpy(mScriptBS.data() + section.first, section.second->data(), section.second->size());
+  }
+  mScriptBS.moveTo(globals_start);
   return false;
 }
 
@@ -203,9 +239,8 @@ bool LSOScriptCompiler::visit(LSLGlobalFunction *glob_func) {
     ScopedBitStreamSeek seek(_mFunctionsBS, function_start);
     _mFunctionsBS << (uint32_t)(func_header_end - function_start);
   }
-  LSOBytecodeCompiler visitor(_mSymData);
+  LSOBytecodeCompiler visitor(_mSymData, _mFunctionsBS);
   glob_func->visit(&visitor);
-  _mFunctionsBS.writeBitStream(visitor.mCodeBS);
   return false;
 }
 
@@ -214,10 +249,12 @@ bool LSOScriptCompiler::visit(LSLState *state) {
   const uint32_t jump_table_base = 5;
   const uint32_t jump_table_size = sizeof(uint32_t) + sizeof(uint32_t);
   auto *state_data = &_mSymData[state->getSymbol()];
+  // offsets within the state are relative to its start in the states section
+  auto state_start = _mStatesBS.pos();
 
-  _mStateBS << jump_table_base << '\0';
+  _mStatesBS << jump_table_base << '\0';
   // skip past the jump tables to the start of the first state data struct
-  _mStateBS.moveBy((int32_t)(jump_table_size * state_data->handlers.size()), true);
+  _mStatesBS.moveBy((int32_t)(jump_table_size * state_data->handlers.size()), true);
 
   for (auto *event_handler : *state->getEventHandlers()) {
     auto *event_data = &_mSymData[event_handler->getSymbol()];
@@ -225,11 +262,11 @@ bool LSOScriptCompiler::visit(LSLState *state) {
     auto table_iter = state_data->handlers.find((LSOHandlerType)event_data->index);
     auto table_idx = (uint32_t)std::distance(state_data->handlers.begin(), table_iter);
 
-    auto event_start_pos = _mStateBS.pos();
+    auto event_start_pos = _mStatesBS.pos() - state_start;
     {
-      ScopedBitStreamSeek seek(_mStateBS, jump_table_base + (jump_table_size * table_idx));
+      ScopedBitStreamSeek seek(_mStatesBS, state_start + jump_table_base + (jump_table_size * table_idx));
       // offset from jump table to state data, stack required for handler's locals + params
-      _mStateBS << (uint32_t)(event_start_pos - jump_table_base) << (uint32_t)event_data->size;
+      _mStatesBS << (uint32_t)(event_start_pos - jump_table_base) << (uint32_t)event_data->size;
     }
     event_handler->visit(this);
   }
@@ -238,10 +275,9 @@ bool LSOScriptCompiler::visit(LSLState *state) {
 
 bool LSOScriptCompiler::visit(LSLEventHandler *handler) {
   // offset to code + empty name
-  _mStateBS << (uint32_t)5 << '\0';
-  LSOBytecodeCompiler visitor(_mSymData);
+  _mStatesBS << (uint32_t)5 << '\0';
+  LSOBytecodeCompiler visitor(_mSymData, _mStatesBS);
   handler->visit(&visitor);
-  _mStateBS.writeBitStream(visitor.mCodeBS);
   return false;
 }
 
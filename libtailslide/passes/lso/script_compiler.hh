@@ -14,7 +14,7 @@ class LSOHeapManager {
   public:
     uint32_t writeConstant(LSLConstant *constant);
     uint32_t writeTerminalBlock();
-    LSOBitStream mHeapBS {ENDIAN_BIG};
+    LSOBitStream mHeapBS;
   protected:
     void writeHeader(uint32_t size, LSLIType type, uint16_t ref_count=1);
 };
@@ -24,7 +24,7 @@ class LSOGlobalVarManager {
     explicit LSOGlobalVarManager(LSOHeapManager *heap_manager): _mHeapManager(heap_manager) {}
     void writeVar(LSLConstant *constant, const char *name=nullptr);
     void writePlaceholder(LSLIType type);
-    LSOBitStream mGlobalsBS {ENDIAN_BIG};
+    LSOBitStream mGlobalsBS;
   protected:
     LSOHeapManager *_mHeapManager;
 };
@@ -32,7 +32,7 @@ class LSOGlobalVarManager {
 class LSOScriptCompiler : public ASTVisitor {
   public:
     explicit LSOScriptCompiler(ScriptAllocator *allocator) : _mAllocator(allocator) {};
-    LSOBitStream mScriptBS {ENDIAN_BIG};
+    LSOBitStream mScriptBS;
   protected:
     virtual bool visit(LSLScript *script);
     virtual bool visit(LSLGlobalVariable *glob_var);
@@ -44,11 +44,9 @@ class LSOScriptCompiler : public ASTVisitor {
     void writeEventRegister(LSORegisters reg, uint64_t val);
     bool checkStackHeapCollision();
 
-    LSOBitStream _mRegistersBS {ENDIAN_BIG};
-    LSOBitStream _mFunctionsBS {ENDIAN_BIG};
-    LSOBitStream _mStatesBS {ENDIAN_BIG};
-    LSOBitStream _mStateBS {ENDIAN_BIG};
-    LSOBitStream _mCodeBS {ENDIAN_BIG};
+    LSOBitStream _mRegistersBS;
+    LSOBitStream _mFunctionsBS;
+    LSOBitStream _mStatesBS;
     LSOHeapManager _mHeapManager;
     LSOGlobalVarManager _mGlobalVarManager {&_mHeapManager};
     ScriptAllocator *_mAllocator;
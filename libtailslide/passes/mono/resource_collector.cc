@@ -32,11 +32,7 @@ bool MonoResourceVisitor::visit(LSLDeclaration *decl_stmt) {
 }
 
 MonoSymbolData *MonoResourceVisitor::getSymbolData(LSLSymbol *sym) {
-  auto sym_iter = _mSymData->find(sym);
-  if (sym_iter != _mSymData->end())
-    return &sym_iter->second;
-  (*_mSymData)[sym] = {};
-  return &_mSymData->find(sym)->second;
+  return &(*_mSymData)[sym];
 }
 
 }
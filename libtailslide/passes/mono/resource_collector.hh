@@ -1,6 +1,5 @@
 #pragma once
 
-#include <map>
 #include <vector>
 
 #include "../../visitor.hh"
@@ -13,7 +12,7 @@ struct MonoSymbolData {
   std::vector<LSLIType> locals{};
 };
 
-typedef std::map<Tailslide::LSLSymbol *, MonoSymbolData> MonoSymbolDataMap;
+typedef SymbolDataVector<MonoSymbolData> MonoSymbolDataMap;
 
 // Walks the script, figuring out how much space to reserve for data slots
 // and what order to place them in.
@@ -1,3 +1,5 @@
+#include <map>
+
 #include "script_compiler.hh"
 #include "../desugaring.hh"
 
@@ -59,6 +61,8 @@ bool MonoScriptCompiler::visit(LSLScript *script) {
   LLConformantDeSugaringVisitor de_sugaring_visitor(_mAllocator, true);
   script->visit(&de_sugaring_visitor);
 
+  // every symbol's data has to stay put while the resource visitor holds onto it
+  _mSymData.reserveIds(0, script->mContext->num_symbol_ids);
   MonoResourceVisitor resource_visitor(&_mSymData);
   script->visit(&resource_visitor);
   _mScriptClassName = "LSL_00000000_0000_0000_0000_000000000000";
@@ -14,15 +14,17 @@ struct MonoCompilationOptions {
   bool omit_unnecessary_pushes = false;
 };
 
-class MonoScriptCompiler : public ASTVisitor {
+class MonoScriptCompiler : public StaticASTVisitor<MonoScriptCompiler> {
+  friend StaticASTVisitor;
   public:
     explicit MonoScriptCompiler(ScriptAllocator *allocator, MonoCompilationOptions options={}) :
         _mAllocator(allocator), _mOptions(options) {};
 
     std::stringstream mCIL {};
   protected:
-    virtual bool visit(LSLScript *script);
-    virtual bool visit(LSLGlobalVariable *glob_var);
+    using StaticASTVisitor::visit;
+    bool visit(LSLScript *script);
+    bool visit(LSLGlobalVariable *glob_var);
 
     void pushLValueContainer(LSLLValueExpression *lvalue);
     void pushLValue(LSLLValueExpression *lvalue);
@@ -33,33 +35,33 @@ class MonoScriptCompiler : public ASTVisitor {
     std::string getGlobalVarSpecifier(LSLSymbol *sym);
     std::string getLValueAccessorSpecifier(LSLLValueExpression *lvalue);
 
-    virtual bool visit(LSLEventHandler *handler);
-    virtual bool visit(LSLGlobalFunction *glob_func);
+    bool visit(LSLEventHandler *handler);
+    bool visit(LSLGlobalFunction *glob_func);
     void buildFunction(LSLASTNode *func);
 
-    virtual bool visit(LSLExpressionStatement *expr_stmt);
-    virtual bool visit(LSLReturnStatement *ret_stmt);
-    virtual bool visit(LSLLabel *label_stmt);
-    virtual bool visit(LSLJumpStatement *jump_stmt);
-    virtual bool visit(LSLDeclaration *decl_stmt);
-    virtual bool visit(LSLIfStatement *if_stmt);
-    virtual bool visit(LSLForStatement *for_stmt);
-    virtual bool visit(LSLWhileStatement *while_stmt);
-    virtual bool visit(LSLDoStatement *do_stmt);
-    virtual bool visit(LSLStateStatement *state_stmt);
-
-    virtual bool visit(LSLConstantExpression *constant_expr);
-    virtual bool visit(LSLTypecastExpression *cast_expr);
-    virtual bool visit(LSLBoolConversionExpression *bool_expr);
-    virtual bool visit(LSLVectorExpression *vec_expr);
-    virtual bool visit(LSLQuaternionExpression *quat_expr);
-    virtual bool visit(LSLLValueExpression *lvalue);
-    virtual bool visit(LSLListExpression *list_expr);
-    virtual bool visit(LSLFunctionExpression *func_expr);
-    virtual bool visit(LSLBinaryExpression *bin_expr);
+    bool visit(LSLExpressionStatement *expr_stmt);
+    bool visit(LSLReturnStatement *ret_stmt);
+    bool visit(LSLLabel *label_stmt);
+    bool visit(LSLJumpStatement *jump_stmt);
+    bool visit(LSLDeclaration *decl_stmt);
+    bool visit(LSLIfStatement *if_stmt);
+    bool visit(LSLForStatement *for_stmt);
+    bool visit(LSLWhileStatement *while_stmt);
+    bool visit(LSLDoStatement *do_stmt);
+    bool visit(LSLStateStatement *state_stmt);
+
+    bool visit(LSLConstantExpression *constant_expr);
+    bool visit(LSLTypecastExpression *cast_expr);
+    bool visit(LSLBoolConversionExpression *bool_expr);
+    bool visit(LSLVectorExpression *vec_expr);
+    bool visit(LSLQuaternionExpression *quat_expr);
+    bool visit(LSLLValueExpression *lvalue);
+    bool visit(LSLListExpression *list_expr);
+    bool visit(LSLFunctionExpression *func_expr);
+    bool visit(LSLBinaryExpression *bin_expr);
     void compileBinaryExpression(LSLOperator op, LSLExpression *left, LSLExpression *right, LSLIType ret_type);
-    virtual bool visit(LSLUnaryExpression *unary_expr);
-    virtual bool visit(LSLPrintExpression *print_expr);
+    bool visit(LSLUnaryExpression *unary_expr);
+    bool visit(LSLPrintExpression *print_expr);
 
     bool maybeOmitPush(LSLExpression *expr) {
         bool need_push = !_mOptions.omit_unnecessary_pushes || expr->getResultNeeded();
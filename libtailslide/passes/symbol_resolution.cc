@@ -5,6 +5,7 @@ namespace Tailslide {
 
 bool SymbolResolutionVisitor::visit(LSLScript *script) {
   replaceSymbolTable(script, SYMTAB_GLOBAL);
+  enterScope(script);
   auto *globals = script->getGlobals();
   // all global var definitions are implicitly hoisted above function definitions
   // all functions and states have their declarations implicitly hoisted as well.
@@ -51,9 +52,21 @@ bool SymbolResolutionVisitor::visit(LSLScript *script) {
   }
   // then state bodies
   states->visit(this);
+  leaveScope();
   return false;
 }
 
+void SymbolResolutionVisitor::resolveReplacement(LSLASTNode *global, LSLSymbol *symbol) {
+  // same as what `visit(LSLScript*)` does for the prototype, minus defining the symbol.
+  // `enterScope()` picks up the script's scope from the global's parent.
+  if (global->getNodeType() == NODE_STATE)
+    replaceSymbolTable(global, SYMTAB_STATE);
+  else
+    replaceSymbolTable(global, SYMTAB_FUNCTION);
+  ((LSLIdentifier *)global->getChild(0))->setSymbol(symbol);
+  global->visit(this);
+}
+
 bool SymbolResolutionVisitor::visit(LSLGlobalVariable *glob_var) {
   // descend first so we can resolve any symbol references present in the rvalue
   // before we've defined the identifier from the lvalue.
@@ -94,21 +107,55 @@ void SymbolResolutionVisitor::replaceSymbolTable(LSLASTNode *node, LSLSymbolTabl
   node->mContext->table_manager->registerTable(symtab);
 }
 
+/// Start resolving identifiers against `node`'s symbol table before any outer ones
+void SymbolResolutionVisitor::enterScope(LSLASTNode *node) {
+  if (_mScopes.empty()) {
+    // We didn't start from the script, pick up the scopes we're already inside of.
+    std::vector<LSLASTNode *> outer_scopes;
+    for (auto *ancestor = node->getParent(); ancestor; ancestor = ancestor->getParent()) {
+      if (ancestor->getSymbolTable())
+        outer_scopes.push_back(ancestor);
+    }
+    if (node->getNodeType() == NODE_SCRIPT || (!outer_scopes.empty() && outer_scopes.back()->getNodeType() == NODE_SCRIPT))
+      _mScopes.setBuiltins(node->mContext->builtins);
+    for (auto i = outer_scopes.rbegin(); i != outer_scopes.rend(); ++i)
+      _mScopes.push((*i)->getSymbolTable());
+  }
+  _mScopes.push(node->getSymbolTable());
+}
+
+void SymbolResolutionVisitor::leaveScope() {
+  _mScopes.pop();
+}
+
 bool SymbolResolutionVisitor::visit(LSLLValueExpression *lvalue) {
-  lvalue->getIdentifier()->resolveSymbol(SYM_VARIABLE);
+  lvalue->getIdentifier()->resolveSymbol(SYM_VARIABLE, _mScopes.empty() ? nullptr : &_mScopes);
   return false;
 }
 
 bool SymbolResolutionVisitor::visit(LSLFunctionExpression *func_expr) {
-  func_expr->getIdentifier()->resolveSymbol(SYM_FUNCTION);
+  auto *id = func_expr->getIdentifier();
+  id->resolveSymbol(SYM_FUNCTION, _mScopes.empty() ? nullptr : &_mScopes);
+  id->setEnclosingFunction(_mEnclosingFunction);
   return true;
 }
 
 bool SymbolResolutionVisitor::visit(LSLGlobalFunction *glob_func) {
   assert(_mPendingJumps.empty());
+  enterScope(glob_func);
+  _mEnclosingFunction = glob_func->getSymbol();
   visitChildren(glob_func);
+  _mEnclosingFunction = nullptr;
   glob_func->getSymbolTable()->setLabels(_mCollectedLabels);
   resolvePendingJumps(glob_func);
+  leaveScope();
+  return false;
+}
+
+bool SymbolResolutionVisitor::visit(LSLState *state) {
+  enterScope(state);
+  visitChildren(state);
+  leaveScope();
   return false;
 }
 
@@ -117,7 +164,7 @@ bool SymbolResolutionVisitor::visit(LSLEventHandler *handler) {
 
   auto *id = handler->getIdentifier();
   // look for a prototype for this event in the builtin namespace
-  auto *sym = handler->getRoot()->lookupSymbol(id->getName(), SYM_EVENT);
+  auto *sym = handler->getRoot()->lookupAtom(id->getName(), SYM_EVENT);
   if (sym) {
     id->setSymbol(_mAllocator->newTracked<LSLSymbol>(
         id->getName(), id->getType(), SYM_EVENT, SYM_BUILTIN, handler->getLoc(), handler->getArguments()
@@ -128,9 +175,11 @@ bool SymbolResolutionVisitor::visit(LSLEventHandler *handler) {
   }
 
   assert(_mPendingJumps.empty());
+  enterScope(handler);
   visitChildren(handler);
   handler->getSymbolTable()->setLabels(_mCollectedLabels);
   resolvePendingJumps(handler);
+  leaveScope();
   return false;
 }
 
@@ -174,19 +223,22 @@ bool SymbolResolutionVisitor::visit(LSLJumpStatement *jump_stmt) {
   // can only resolve the labels they refer to after we leave the enclosing
   // function or event handler, having passed the last place the label it
   // refers to could have been defined.
-  _mPendingJumps.emplace_back(jump_stmt);
+  _mPendingJumps.emplace_back(jump_stmt, _mScopes);
   _mEnclosingLoops[jump_stmt] = _mCurrentLoop;
   return true;
 }
 
 bool SymbolResolutionVisitor::visit(LSLStateStatement *state_stmt) {
-  state_stmt->getIdentifier()->resolveSymbol(SYM_STATE);
+  state_stmt->getIdentifier()->resolveSymbol(SYM_STATE, _mScopes.empty() ? nullptr : &_mScopes);
   return true;
 }
 
 bool SymbolResolutionVisitor::visit(LSLCompoundStatement *compound_stmt) {
   replaceSymbolTable(compound_stmt, SYMTAB_LEXICAL);
-  return true;
+  enterScope(compound_stmt);
+  visitChildren(compound_stmt);
+  leaveScope();
+  return false;
 }
 
 bool SymbolResolutionVisitor::visit(LSLDoStatement *do_stmt) {
@@ -209,10 +261,11 @@ void SymbolResolutionVisitor::visitLoop(LSLASTNode *loop_stmt) {
 }
 
 void SymbolResolutionVisitor::resolvePendingJumps(LSLASTNode *func_like) {
-  for (auto *jump : _mPendingJumps) {
+  for (auto &pending_jump : _mPendingJumps) {
+    auto *jump = pending_jump.first;
     auto *id = jump->getIdentifier();
     // First do the lookup by lexical scope, triggering an error if it fails.
-    id->resolveSymbol(SYM_LABEL);
+    id->resolveSymbol(SYM_LABEL, pending_jump.second.empty() ? nullptr : &pending_jump.second);
 
     // That's all we have to do unless we want to match SL exactly.
     if (!_mLindenJumpSemantics)
@@ -278,7 +331,8 @@ void SymbolResolutionVisitor::resolvePendingJumps(LSLASTNode *func_like) {
   //  while something like `while(1){jump foo; 1; @foo; {}}`
   //  or `while(1){if(something){jump foo; 1; @foo;}else{}}` is not.
   bool has_unstructured_jumps = false;
-  for (auto jump : _mPendingJumps) {
+  for (auto &pending_jump : _mPendingJumps) {
+    auto *jump = pending_jump.first;
     auto *sym = jump->getSymbol();
     if (!sym)
       continue;
@@ -1,6 +1,7 @@
 #ifndef TAILSLIDE_SYMBOL_RESOLUTION_HH
 #define TAILSLIDE_SYMBOL_RESOLUTION_HH
 
+#include <utility>
 #include <vector>
 
 #include "../lslmini.hh"
@@ -13,6 +14,10 @@ class SymbolResolutionVisitor : public ASTVisitor {
     SymbolResolutionVisitor(bool linden_jump_semantics, ScriptAllocator *allocator)
       : _mAllocator(allocator), _mLindenJumpSemantics(linden_jump_semantics) {}
 
+    /// Resolve symbols within a global function or state that took the place of one
+    /// with the same name and signature, reusing the old one's `symbol`.
+    void resolveReplacement(LSLASTNode *global, LSLSymbol *symbol);
+
   protected:
     virtual bool visit(LSLDeclaration *decl_stmt);
     virtual bool visit(LSLGlobalVariable *glob_var);
@@ -21,6 +26,7 @@ class SymbolResolutionVisitor : public ASTVisitor {
     virtual bool visit(LSLFunctionExpression *func_expr);
     virtual bool visit(LSLScript *script);
     virtual bool visit(LSLFunctionDec *func_dec);
+    virtual bool visit(LSLState *state);
     virtual bool visit(LSLEventHandler *handler);
     virtual bool visit(LSLEventDec *event_dec);
     virtual bool visit(LSLLabel *label_stmt);
@@ -33,13 +39,21 @@ class SymbolResolutionVisitor : public ASTVisitor {
     void visitLoop(LSLASTNode *loop_stmt);
 
     void replaceSymbolTable(LSLASTNode *node, LSLSymbolTableType symtab_type);
+    void enterScope(LSLASTNode *node);
+    void leaveScope();
 
     void resolvePendingJumps(LSLASTNode *func_like);
     ScriptAllocator *_mAllocator;
-    std::vector<LSLJumpStatement*> _mPendingJumps;
+    // every scope we're currently inside of, so identifiers can be resolved
+    // without walking up the tree.
+    LSLScopeChain _mScopes;
+    // along with the scopes they were in, labels can't be resolved until the whole function has been seen.
+    std::vector<std::pair<LSLJumpStatement*, LSLScopeChain>> _mPendingJumps;
     std::vector<LSLLabel*> _mCollectedLabels;
     std::unordered_map<LSLASTNode *, LSLASTNode *> _mEnclosingLoops;
     LSLASTNode *_mCurrentLoop = nullptr;
+    // symbol of the global function we're in, if any
+    LSLSymbol *_mEnclosingFunction = nullptr;
     bool _mLindenJumpSemantics;
 };
 
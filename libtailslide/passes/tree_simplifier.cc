@@ -2,20 +2,55 @@
 
 namespace Tailslide {
 
-bool TreeSimplifyingVisitor::visit(LSLDeclaration *decl_stmt) {
+void TreeSimplifyingVisitor::simplify(LSLScript *script) {
+  _mDeclarations.reserveIds(0, script->mContext->num_symbol_ids);
+  _mRoundUsage.reserveIds(0, script->mContext->num_symbol_ids);
+  // Folding only depends on constant values, not on usage, so everything that can be
+  // folded gets folded by the first walk.
+  script->visit(this);
+  ++_mRound;
+
+  // After that, a declaration can only become prunable by losing a use, so only those
+  // get revisited. Globals go first so that a pruned function's locals are left alone,
+  // just as if the walk had never descended into it.
+  while (!_mWorklist.empty()) {
+    std::vector<LSLSymbol *> worklist;
+    std::swap(worklist, _mWorklist);
+    for (auto *sym : worklist) {
+      auto *decl = _mDeclarations[sym];
+      if (decl && decl->getNodeType() != NODE_STATEMENT && canPruneGlobal(decl))
+        pruneGlobal(decl);
+    }
+    for (auto *sym : worklist) {
+      auto *decl = _mDeclarations[sym];
+      if (decl && decl->getNodeType() == NODE_STATEMENT && canPruneLocal((LSLDeclaration *)decl))
+        pruneLocal((LSLDeclaration *)decl);
+    }
+    ++_mRound;
+  }
+}
+
+bool TreeSimplifyingVisitor::canPruneLocal(LSLDeclaration *decl_stmt) {
   if (!mOpts.prune_unused_locals)
-    return true;
+    return false;
 
   auto *sym = decl_stmt->getSymbol();
-  if (!sym || sym->getReferences() != 1 || sym->getAssignments() != 0)
-    return true;
+  if (!sym)
+    return false;
+  auto usage = getRoundUsage(sym);
+  if (usage.references != 1 || usage.assignments != 0)
+    return false;
   LSLASTNode *rvalue = decl_stmt->getInitializer();
   // rvalue can't be reduced to a constant, don't know that we don't need
   // the side-effects of evaluating the expression.
   if(rvalue && !rvalue->getConstantValue())
-    return true;
+    return false;
+  return true;
+}
 
+void TreeSimplifyingVisitor::pruneLocal(LSLDeclaration *decl_stmt) {
   ++mFoldedLevel;
+  auto *sym = decl_stmt->getSymbol();
   LSLASTNode *ancestor = decl_stmt;
   // walk up and remove it from whatever symbol table it's in
   while (ancestor != nullptr) {
@@ -26,7 +61,20 @@ bool TreeSimplifyingVisitor::visit(LSLDeclaration *decl_stmt) {
     ancestor = ancestor->getParent();
   }
   assert(decl_stmt->getParent() != nullptr);
+  forgetUsage(decl_stmt);
   decl_stmt->getParent()->removeChild(decl_stmt);
+}
+
+bool TreeSimplifyingVisitor::visit(LSLDeclaration *decl_stmt) {
+  if (!mOpts.prune_unused_locals)
+    return true;
+
+  if (!canPruneLocal(decl_stmt)) {
+    if (auto *sym = decl_stmt->getSymbol())
+      _mDeclarations[sym] = decl_stmt;
+    return true;
+  }
+  pruneLocal(decl_stmt);
   // child is totally gone now, can't recurse.
   return false;
 }
@@ -68,7 +116,7 @@ bool TreeSimplifyingVisitor::visit(LSLExpression *expr) {
   // so we need a copy.
   auto *new_expr = expr->mContext->allocator->newTracked<LSLConstantExpression>(cv);
   new_expr->setLoc(expr->getLoc());
-  LSLASTNode::replaceNode(expr, new_expr);
+  replaceNode(expr, new_expr);
   ++mFoldedLevel;
 
   return false;
@@ -138,10 +186,7 @@ bool TreeSimplifyingVisitor::visit(LSLLValueExpression *lvalue) {
   if (cv && !cv->containsNaN()) {
     auto *new_expr = lvalue->mContext->allocator->newTracked<LSLConstantExpression>(cv);
     new_expr->setLoc(lvalue->getLoc());
-    LSLASTNode::replaceNode(
-        lvalue,
-        new_expr
-    );
+    replaceNode(lvalue, new_expr);
     ++mFoldedLevel;
     return false;
   }
@@ -154,6 +199,16 @@ bool TreeSimplifyingVisitor::visit(LSLConstantExpression *constant_expr) {
 }
 
 bool TreeSimplifyingVisitor::handleGlobal(LSLASTNode *glob) {
+  if (canPruneGlobal(glob)) {
+    pruneGlobal(glob);
+    return false;
+  }
+  if (auto *sym = glob->getSymbol())
+    _mDeclarations[sym] = glob;
+  return true;
+}
+
+bool TreeSimplifyingVisitor::canPruneGlobal(LSLASTNode *glob) {
   // globals are either a single var or a single function.
   // and they both keep their identifier in the first child!
   auto *id = (LSLIdentifier *) (glob->getChild(0));
@@ -162,18 +217,55 @@ bool TreeSimplifyingVisitor::handleGlobal(LSLASTNode *glob) {
   LSLNodeType node_type = glob->getNodeType();
   auto *sym = id->getSymbol();
 
-  if (((node_type == NODE_GLOBAL_FUNCTION && mOpts.prune_unused_functions) ||
-       (node_type == NODE_GLOBAL_VARIABLE && mOpts.prune_unused_globals))
-      && sym->getReferences() == 1) {
-    ++mFoldedLevel;
-    // these reside in the global scope, look for the root symbol table and the entry
-    LSLASTNode *script = glob->getRoot();
-    script->getSymbolTable()->remove(sym);
-    // remove the node itself
-    glob->getParent()->removeChild(glob);
-    return false;
+  return ((node_type == NODE_GLOBAL_FUNCTION && mOpts.prune_unused_functions) ||
+          (node_type == NODE_GLOBAL_VARIABLE && mOpts.prune_unused_globals))
+         && getRoundUsage(sym).references == 1;
+}
+
+void TreeSimplifyingVisitor::pruneGlobal(LSLASTNode *glob) {
+  ++mFoldedLevel;
+  // these reside in the global scope, look for the root symbol table and the entry
+  LSLASTNode *script = glob->getRoot();
+  script->getSymbolTable()->remove(glob->getSymbol());
+  // remove the node itself
+  forgetUsage(glob);
+  glob->getParent()->removeChild(glob);
+}
+
+void TreeSimplifyingVisitor::replaceNode(LSLASTNode *old_node, LSLASTNode *new_node) {
+  forgetUsage(old_node);
+  LSLASTNode::replaceNode(old_node, new_node);
+}
+
+TreeSimplifyingVisitor::RoundUsage TreeSimplifyingVisitor::getRoundUsage(LSLSymbol *sym) {
+  auto &usage = _mRoundUsage[sym];
+  // hasn't changed since the round started
+  if (usage.round != _mRound)
+    return {_mRound, sym->getReferences(), sym->getAssignments()};
+  return usage;
+}
+
+/// Note what's used within a subtree that's about to be removed, must be called
+/// while it's still in the tree.
+void TreeSimplifyingVisitor::forgetUsage(LSLASTNode *node) {
+  if (node->getNodeType() == NODE_IDENTIFIER) {
+    auto *sym = node->getSymbol();
+    if (sym && sym->getSubType() != SYM_BUILTIN) {
+      // removing the node will change the counts, remember what they were.
+      _mRoundUsage[sym] = getRoundUsage(sym);
+      _mWorklist.push_back(sym);
+    }
   }
-  return true;
+
+  // anything declared in here is going away as well
+  if (node->getNodeType() == NODE_GLOBAL_VARIABLE || node->getNodeType() == NODE_GLOBAL_FUNCTION
+      || node->getNodeSubType() == NODE_DECLARATION) {
+    if (auto *sym = node->getSymbol())
+      _mDeclarations[sym] = nullptr;
+  }
+
+  for (auto *child : *node)
+    forgetUsage(child);
 }
 
 }
@@ -1,6 +1,9 @@
 #ifndef TAILSLIDE_TREE_SIMPLIFIER_HH
 #define TAILSLIDE_TREE_SIMPLIFIER_HH
 
+#include <vector>
+
+#include "../lslmini.hh"
 #include "../visitor.hh"
 
 namespace Tailslide {
@@ -19,6 +22,9 @@ struct OptimizationOptions {
 class TreeSimplifyingVisitor: public ASTVisitor {
   public:
     explicit TreeSimplifyingVisitor(const OptimizationOptions &opts): mOpts(opts) {};
+    /// Simplify the script until nothing else can be removed. Symbol usage data
+    /// must be up to date beforehand, see `ScriptContext::usage_tracked`.
+    void simplify(LSLScript *script);
     OptimizationOptions mOpts;
     int mFoldedLevel = 0;
 
@@ -30,6 +36,31 @@ class TreeSimplifyingVisitor: public ASTVisitor {
     virtual bool visit(LSLConstantExpression *constant_expr);
 
     bool handleGlobal(LSLASTNode *glob);
+
+  protected:
+    struct RoundUsage {
+      uint32_t round = 0;
+      int references = 0;
+      int assignments = 0;
+    };
+
+    bool canPruneLocal(LSLDeclaration *decl_stmt);
+    bool canPruneGlobal(LSLASTNode *glob);
+    void pruneLocal(LSLDeclaration *decl_stmt);
+    void pruneGlobal(LSLASTNode *glob);
+    void replaceNode(LSLASTNode *old_node, LSLASTNode *new_node);
+    // usage as of the start of the round, so every decision in a round
+    // is made against the same counts no matter what's been removed so far.
+    RoundUsage getRoundUsage(LSLSymbol *sym);
+    void forgetUsage(LSLASTNode *node);
+
+    // declarations that weren't prunable when we last looked, null once removed.
+    SymbolDataVector<LSLASTNode *> _mDeclarations;
+    // usage of symbols that changed during the current round, from before they did.
+    SymbolDataVector<RoundUsage> _mRoundUsage;
+    uint32_t _mRound = 1;
+    // symbols that lost a use this round, their declarations may be prunable next round.
+    std::vector<LSLSymbol *> _mWorklist;
 };
 }
 
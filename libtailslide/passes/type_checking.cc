@@ -2,6 +2,12 @@
 
 namespace Tailslide {
 
+bool TypeCheckVisitor::visitSpecific(LSLASTNode *node) {
+  if (_mTrackReferences)
+    track_symbol_usage(node);
+  return StaticASTVisitor::visitSpecific(node);
+}
+
 bool TypeCheckVisitor::visit(LSLASTNode *node) {
   if (!node->getType())
     node->setType(LSLType::get(LST_NULL));
@@ -211,7 +217,7 @@ bool TypeCheckVisitor::visit(LSLExpression *expr) {
       // either because this operation is unsupported.
       type = TYPE(LST_ERROR);
     } else if (operation == OP_MUL_ASSIGN && l_type == TYPE(LST_INTEGER) && r_type == TYPE(LST_FLOATINGPOINT)) {
-      // see note in `LSLType::getResultType` for details on this case.
+      // see note in `get_result_type_by_scan()` for details on this case.
       NODE_ERROR(expr, W_INT_FLOAT_MUL_ASSIGN);
     }
   }
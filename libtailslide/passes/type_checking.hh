@@ -4,28 +4,37 @@
 #include "../visitor.hh"
 
 namespace Tailslide {
-class TypeCheckVisitor: public DepthFirstASTVisitor {
+class TypeCheckVisitor: public StaticASTVisitor<TypeCheckVisitor, true> {
+  friend StaticASTVisitor;
+  public:
+    // `track_references` also counts symbol references and assignments as
+    // we go, like `LSLScript::recalculateReferenceData()`.
+    explicit TypeCheckVisitor(bool track_references=false): _mTrackReferences(track_references) {}
   protected:
-    virtual bool visit(LSLASTNode *node);
-    virtual bool visit(LSLGlobalVariable *glob_var);
-    virtual bool visit(LSLDeclaration *decl_stmt);
-    virtual bool visit(LSLStateStatement *state_stmt);
-    virtual bool visit(LSLReturnStatement *ret_stmt);
-    virtual bool visit(LSLIfStatement *if_stmt);
-    virtual bool visit(LSLForStatement *for_stmt);
-    virtual bool visit(LSLDoStatement *do_stmt);
-    virtual bool visit(LSLWhileStatement *while_stmt);
-    virtual bool visit(LSLExpression *expr);
-    virtual bool visit(LSLEventHandler *handler);
-    virtual bool visit(LSLFunctionExpression *func_expr);
-    virtual bool visit(LSLLValueExpression *lvalue);
-    virtual bool visit(LSLTypecastExpression *cast_expr);
-    virtual bool visit(LSLVectorExpression *vec_expr);
-    virtual bool visit(LSLQuaternionExpression *quat_expr);
-    virtual bool visit(LSLListConstant *list_const);
-    virtual bool visit(LSLListExpression *list_expr);
-    virtual bool visit(LSLPrintExpression *print_expr);
+    using StaticASTVisitor::visit;
+    bool visitSpecific(LSLASTNode *node);
+    bool visit(LSLASTNode *node);
+    bool visit(LSLGlobalVariable *glob_var);
+    bool visit(LSLDeclaration *decl_stmt);
+    bool visit(LSLStateStatement *state_stmt);
+    bool visit(LSLReturnStatement *ret_stmt);
+    bool visit(LSLIfStatement *if_stmt);
+    bool visit(LSLForStatement *for_stmt);
+    bool visit(LSLDoStatement *do_stmt);
+    bool visit(LSLWhileStatement *while_stmt);
+    bool visit(LSLExpression *expr);
+    bool visit(LSLEventHandler *handler);
+    bool visit(LSLFunctionExpression *func_expr);
+    bool visit(LSLLValueExpression *lvalue);
+    bool visit(LSLTypecastExpression *cast_expr);
+    bool visit(LSLVectorExpression *vec_expr);
+    bool visit(LSLQuaternionExpression *quat_expr);
+    bool visit(LSLListConstant *list_const);
+    bool visit(LSLListExpression *list_expr);
+    bool visit(LSLPrintExpression *print_expr);
     
     void handleDeclaration(LSLASTNode *decl_node);
+
+    bool _mTrackReferences;
 };
 }
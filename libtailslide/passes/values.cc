@@ -16,6 +16,12 @@ bool ConstantDeterminingVisitor::beforeDescend(LSLASTNode *node) {
     // absolutely no chance of us figuring out a constant value
     // for this node, don't descend.
     node->setConstantPrecluded(true);
+    // the final pass still needs to look at everything under this node,
+    // constant values down there will be exactly as they were.
+    if (_mFinalPass) {
+      for (auto *child : *node)
+        child->visit(_mFinalPass);
+    }
     return false;
   }
 
@@ -26,13 +32,25 @@ bool ConstantDeterminingVisitor::beforeDescend(LSLASTNode *node) {
   return true;
 }
 
+bool ConstantDeterminingVisitor::visitSpecific(LSLASTNode *node) {
+  bool ret = StaticASTVisitor::visitSpecific(node);
+  // children are done and this node's constant value is final
+  if (_mFinalPass)
+    _mFinalPass->visitSpecific(node);
+  return ret;
+}
+
 bool ConstantDeterminingVisitor::visit(LSLScript *script) {
   // need to iterate over global vars FIRST since expressions in
   // global functions may make use of them.
+  // They get visited again below, so hold off on the final pass until then.
+  auto *final_pass = _mFinalPass;
+  _mFinalPass = nullptr;
   for (auto *child : *script->getGlobals()) {
     if (child->getNodeType() == NODE_GLOBAL_VARIABLE)
       child->visit(this);
   }
+  _mFinalPass = final_pass;
   // safe to descend into functions and event handlers now
   visitChildren(script);
   return false;
@@ -4,27 +4,36 @@
 #include "../lslmini.hh"
 #include "../visitor.hh"
 #include "../operations.hh"
+#include "final_pass.hh"
 
 namespace Tailslide {
-class ConstantDeterminingVisitor : public DepthFirstASTVisitor {
+class ConstantDeterminingVisitor : public StaticASTVisitor<ConstantDeterminingVisitor, true> {
+  friend StaticASTVisitor;
   public:
     explicit ConstantDeterminingVisitor(AOperationBehavior *behavior, ScriptAllocator *allocator)
         : _mOperationBehavior(behavior), _mAllocator(allocator) {}
 
-    virtual bool beforeDescend(LSLASTNode *node);
+    // Also run `final_pass` over each node once its constant value is known,
+    // saving a separate walk over the tree.
+    void setFinalPass(FinalPassVisitor *final_pass) { _mFinalPass = final_pass; }
 
-    virtual bool visit(LSLScript *script);
-    virtual bool visit(LSLDeclaration *decl_stmt);
-    virtual bool visit(LSLExpression *expr);
-    virtual bool visit(LSLGlobalVariable *glob_var);
-    virtual bool visit(LSLLValueExpression *lvalue);
-    virtual bool visit(LSLListExpression *list_expr);
-    virtual bool visit(LSLVectorExpression *vec_expr);
-    virtual bool visit(LSLQuaternionExpression *quat_expr);
-    virtual bool visit(LSLTypecastExpression *cast_expr);
+    bool beforeDescend(LSLASTNode *node);
+    bool visitSpecific(LSLASTNode *node);
+    using StaticASTVisitor::visit;
+
+    bool visit(LSLScript *script);
+    bool visit(LSLDeclaration *decl_stmt);
+    bool visit(LSLExpression *expr);
+    bool visit(LSLGlobalVariable *glob_var);
+    bool visit(LSLLValueExpression *lvalue);
+    bool visit(LSLListExpression *list_expr);
+    bool visit(LSLVectorExpression *vec_expr);
+    bool visit(LSLQuaternionExpression *quat_expr);
+    bool visit(LSLTypecastExpression *cast_expr);
   protected:
     AOperationBehavior *_mOperationBehavior = nullptr;
     ScriptAllocator *_mAllocator;
+    FinalPassVisitor *_mFinalPass = nullptr;
 
     void handleDeclaration(LSLASTNode *decl_node);
 };
@@ -0,0 +1,146 @@
+#include <algorithm>
+#include <cassert>
+#include <map>
+
+#include "lslmini.hh"
+#include "profiler.hh"
+#include "strings.hh"
+
+namespace Tailslide {
+
+// shared by every profiler so traces from different threads line up
+static std::chrono::steady_clock::time_point get_profiler_epoch() {
+  static const auto epoch = std::chrono::steady_clock::now();
+  return epoch;
+}
+
+void PassProfiler::beginPass(ScriptContext *ctx, const char *name) {
+  auto epoch = get_profiler_epoch();
+  auto alloc_stats = ctx->allocator->getStats();
+  PassRecord record {};
+  record.name = name;
+  record.script = _mScriptName;
+  record.thread_id = _mThreadId;
+  record.depth = (uint32_t)_mOpenPasses.size();
+  _mRecords.emplace_back(std::move(record));
+  _mOpenPasses.push_back({
+    _mRecords.size() - 1,
+    std::chrono::steady_clock::now(),
+    ctx->counters,
+    alloc_stats.objects + alloc_stats.strings,
+    alloc_stats.bytes_used,
+  });
+  _mRecords.back().start_us = std::chrono::duration<double, std::micro>(
+      _mOpenPasses.back().start - epoch
+  ).count();
+}
+
+void PassProfiler::endPass(ScriptContext *ctx) {
+  auto end = std::chrono::steady_clock::now();
+  assert(!_mOpenPasses.empty());
+  auto &open_pass = _mOpenPasses.back();
+  auto &record = _mRecords[open_pass.record_idx];
+  auto alloc_stats = ctx->allocator->getStats();
+  record.duration_us = std::chrono::duration<double, std::micro>(end - open_pass.start).count();
+  record.nodes_visited = ctx->counters.nodes_visited - open_pass.counters.nodes_visited;
+  record.symbol_lookups = ctx->counters.symbol_lookups - open_pass.counters.symbol_lookups;
+  // the allocator may have been reset mid-pass, don't underflow.
+  uint64_t allocations = alloc_stats.objects + alloc_stats.strings;
+  record.allocations = allocations > open_pass.allocations ? allocations - open_pass.allocations : 0;
+  record.bytes_allocated = alloc_stats.bytes_used > open_pass.bytes_allocated
+      ? alloc_stats.bytes_used - open_pass.bytes_allocated : 0;
+  _mOpenPasses.pop_back();
+}
+
+void PassProfiler::merge(const PassProfiler &other) {
+  _mRecords.insert(_mRecords.end(), other._mRecords.begin(), other._mRecords.end());
+}
+
+void PassProfiler::writeSummary(FILE *out) const {
+  struct PassTotals {
+    const char *name;
+    uint64_t calls = 0;
+    double duration_us = 0.0;
+    uint64_t nodes_visited = 0;
+    uint64_t symbol_lookups = 0;
+    uint64_t allocations = 0;
+    uint64_t bytes_allocated = 0;
+  };
+  std::map<std::string, PassTotals> totals_map;
+  double total_us = 0.0;
+  for (auto &record : _mRecords) {
+    auto &totals = totals_map[record.name];
+    totals.name = record.name;
+    ++totals.calls;
+    totals.duration_us += record.duration_us;
+    totals.nodes_visited += record.nodes_visited;
+    totals.symbol_lookups += record.symbol_lookups;
+    totals.allocations += record.allocations;
+    totals.bytes_allocated += record.bytes_allocated;
+    // nested passes are already counted in their parent's time
+    if (!record.depth)
+      total_us += record.duration_us;
+  }
+
+  std::vector<PassTotals> totals;
+  for (auto &totals_pair : totals_map)
+    totals.push_back(totals_pair.second);
+  std::sort(totals.begin(), totals.end(), [](const PassTotals &a, const PassTotals &b) {
+    return a.duration_us > b.duration_us;
+  });
+
+  fprintf(out, "===-------------------------------------------------------------------------===\n");
+  fprintf(out, "                         Pass execution timing report\n");
+  fprintf(out, "===-------------------------------------------------------------------------===\n");
+  fprintf(out, "  Total Execution Time: %.3f ms\n\n", total_us / 1000.0);
+  fprintf(out, "  %10s %6s %7s %10s %10s %10s %10s  %s\n",
+          "Wall (ms)", "%", "Calls", "Nodes", "Lookups", "Allocs", "KiB", "Name");
+  for (auto &pass : totals) {
+    fprintf(out, "  %10.3f %5.1f%% %7llu %10llu %10llu %10llu %10.1f  %s\n",
+            pass.duration_us / 1000.0,
+            total_us > 0.0 ? pass.duration_us * 100.0 / total_us : 0.0,
+            (unsigned long long)pass.calls,
+            (unsigned long long)pass.nodes_visited,
+            (unsigned long long)pass.symbol_lookups,
+            (unsigned long long)pass.allocations,
+            (double)pass.bytes_allocated / 1024.0,
+            pass.name);
+  }
+}
+
+static void write_json_string(std::ostream &out, const std::string &str) {
+  out << '"' << json_escape(str) << '"';
+}
+
+void PassProfiler::writeTrace(std::ostream &out) const {
+  out << "{\"traceEvents\": [\n";
+  bool first = true;
+  for (auto &record : _mRecords) {
+    if (!first)
+      out << ",\n";
+    first = false;
+    out << "{\"name\": ";
+    write_json_string(out, record.name);
+    out << ", \"cat\": \"pass\", \"ph\": \"X\", \"pid\": 1, \"tid\": " << record.thread_id
+        << ", \"ts\": " << record.start_us << ", \"dur\": " << record.duration_us
+        << ", \"args\": {\"script\": ";
+    write_json_string(out, record.script);
+    out << ", \"nodes_visited\": " << record.nodes_visited
+        << ", \"symbol_lookups\": " << record.symbol_lookups
+        << ", \"allocations\": " << record.allocations
+        << ", \"bytes_allocated\": " << record.bytes_allocated << "}}";
+  }
+  out << "\n], \"displayTimeUnit\": \"ms\"}\n";
+}
+
+ScopedPass::ScopedPass(ScriptContext *ctx, const char *name) : _mContext(ctx) {
+  if (_mContext->profiler)
+    _mContext->profiler->beginPass(_mContext, name);
+}
+
+ScopedPass::~ScopedPass() {
+  if (_mContext->profiler)
+    _mContext->profiler->endPass(_mContext);
+}
+
+}
@@ -0,0 +1,86 @@
+#ifndef TAILSLIDE_PROFILER_HH
+#define TAILSLIDE_PROFILER_HH
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace Tailslide {
+
+struct ScriptContext;
+
+// Bumped while a script is being worked on, but only if it has a profiler.
+struct ScriptCounters {
+  uint64_t nodes_visited = 0;
+  // symbol table probes, one for every scope a lookup searches
+  uint64_t symbol_lookups = 0;
+};
+
+struct PassRecord {
+  const char *name;
+  std::string script;
+  uint32_t thread_id;
+  // how many passes this one is nested in
+  uint32_t depth;
+  // microseconds since the first pass began in this process
+  double start_us;
+  double duration_us;
+  uint64_t nodes_visited;
+  uint64_t symbol_lookups;
+  // objects and strings made through the script's allocator
+  uint64_t allocations;
+  uint64_t bytes_allocated;
+};
+
+/// Opt-in record of how long each pass took and how much work it did.
+/// Point `ScriptContext::profiler` at one to use it. Profilers aren't thread-safe,
+/// give each thread its own and `merge()` them afterwards.
+class PassProfiler {
+  public:
+    explicit PassProfiler(uint32_t thread_id=0) : _mThreadId(thread_id) {}
+
+    /// Script name to attach to passes from here on out
+    void setScriptName(std::string name) { _mScriptName = std::move(name); }
+    void beginPass(ScriptContext *ctx, const char *name);
+    void endPass(ScriptContext *ctx);
+
+    void merge(const PassProfiler &other);
+    const std::vector<PassRecord> &getRecords() const { return _mRecords; }
+
+    /// Table of per-pass totals, slowest first
+    void writeSummary(FILE *out) const;
+    /// Chrome trace-event JSON, loadable in chrome://tracing or Perfetto
+    void writeTrace(std::ostream &out) const;
+
+  private:
+    struct OpenPass {
+      size_t record_idx;
+      std::chrono::steady_clock::time_point start;
+      ScriptCounters counters;
+      uint64_t allocations;
+      uint64_t bytes_allocated;
+    };
+    std::vector<PassRecord> _mRecords {};
+    std::vector<OpenPass> _mOpenPasses {};
+    std::string _mScriptName;
+    uint32_t _mThreadId;
+};
+
+/// Records a pass for as long as it's in scope, if the script has a profiler.
+class ScopedPass {
+  public:
+    ScopedPass(ScriptContext *ctx, const char *name);
+    ~ScopedPass();
+    ScopedPass(const ScopedPass &other) = delete;
+    ScopedPass &operator=(const ScopedPass &other) = delete;
+
+  private:
+    ScriptContext *_mContext;
+};
+
+}
+
+#endif
@@ -1,6 +1,8 @@
 #ifndef TAILSLIDE_STRINGS_HH
 #define TAILSLIDE_STRINGS_HH
 
+#include <string>
+
 #include "loctype.hh"
 
 namespace Tailslide {
@@ -8,6 +10,8 @@ class ScriptAllocator;
 
 char *parse_string(ScriptAllocator *allocator, char *input, YYLTYPE *lloc=nullptr);
 std::string escape_string(const char *str);
+// Escape `str` for use inside a JSON string literal
+std::string json_escape(const std::string &str);
 }
 
 #endif
@@ -1,6 +1,5 @@
 #include <algorithm>
 #include <vector>       // vector::iterator
-#include <set>
 #include <string>
 
 #include "lslmini.hh"
@@ -8,8 +7,114 @@
 
 namespace Tailslide {
 
+const char *intern_name(ScriptContext *ctx, const char *name) {
+  if (!name || !ctx || !ctx->allocator)
+    return name;
+  return ctx->allocator->intern(name);
+}
+
+static uint32_t gNumBuiltinIds = 0;
+static bool gBuiltinIdsFrozen = false;
+
+uint32_t assign_symbol_id(ScriptContext *ctx, LSLSymbolSubType sub_type) {
+  if (takes_builtin_id(ctx, sub_type)) {
+    // builtins are only ever made while the builtins table is set up, before any threads are started.
+    assert(!gBuiltinIdsFrozen);
+    return gNumBuiltinIds++;
+  }
+  if (!ctx)
+    return NO_SYMBOL_ID;
+  return ctx->num_symbol_ids++;
+}
+
+uint32_t get_num_builtin_symbol_ids() {
+  return gNumBuiltinIds;
+}
+
+void freeze_builtin_symbol_ids() {
+  gBuiltinIdsFrozen = true;
+}
+
+// Atoms are at least pointer-aligned so the low bits are useless,
+// mix everything into the high bits and take those.
+static inline size_t hash_atom(const char *atom, size_t num_slots) {
+  uint64_t hash = (uint64_t)(uintptr_t)atom * 0x9E3779B97F4A7C15ULL;
+  return (size_t)(hash >> 32) & (num_slots - 1);
+}
+
+// Marks a slot whose name was removed, so lookups know to keep probing past it
+static const char TOMBSTONE_NAME[] = "";
+
+LSLSymbolTable::LSLSymbolTable(ScriptContext *ctx, LSLSymbolTableType symtab_type)
+  : TrackableObject(ctx), _mSymbolTableType(symtab_type) {
+  if (ctx && ctx->allocator)
+    _mAtoms = &ctx->allocator->getAtoms();
+}
+
+LSLSymbolTable::Slot *LSLSymbolTable::findSlot(const char *atom) {
+  if (_mSlots.empty())
+    return nullptr;
+  size_t mask = _mSlots.size() - 1;
+  for (size_t i = hash_atom(atom, _mSlots.size()); ; i = (i + 1) & mask) {
+    Slot &slot = _mSlots[i];
+    if (slot.name == atom)
+      return &slot;
+    if (!slot.name)
+      return nullptr;
+  }
+}
+
+uint32_t LSLSymbolTable::findEntry(const char *atom) {
+  Slot *slot = findSlot(atom);
+  return slot ? slot->entry : NO_ENTRY;
+}
+
+void LSLSymbolTable::insertSlot(const char *atom, uint32_t entry) {
+  size_t mask = _mSlots.size() - 1;
+  for (size_t i = hash_atom(atom, _mSlots.size()); ; i = (i + 1) & mask) {
+    Slot &slot = _mSlots[i];
+    if (!slot.name || slot.name == TOMBSTONE_NAME) {
+      if (slot.name)
+        --_mNumTombstones;
+      slot = {atom, entry};
+      ++_mNumNames;
+      return;
+    }
+  }
+}
+
+void LSLSymbolTable::rehash(size_t num_slots) {
+  std::vector<Slot> old_slots(num_slots, Slot {nullptr, NO_ENTRY});
+  old_slots.swap(_mSlots);
+  _mNumNames = 0;
+  _mNumTombstones = 0;
+  for (auto &slot : old_slots) {
+    if (slot.name && slot.name != TOMBSTONE_NAME)
+      insertSlot(slot.name, slot.entry);
+  }
+}
+
 void LSLSymbolTable::define(LSLSymbol *symbol) {
-  _mSymbols.insert(UnorderedCStrMap<LSLSymbol*>::value_type(symbol->getName(), symbol));
+  assert(!_mFrozen);
+  // symbols always intern their names when they can, so this should be an atom already.
+  assert(!_mAtoms || _mAtoms->find(symbol->getName()) == symbol->getName());
+  const char *name = symbol->getName();
+  auto entry = (uint32_t)_mSymbols.size();
+  if (Slot *slot = findSlot(name)) {
+    // shadows an earlier symbol with the same name
+    _mSymbols.push_back({symbol, slot->entry});
+    slot->entry = entry;
+  } else {
+    _mSymbols.push_back({symbol, NO_ENTRY});
+    // keep the table at most 3/4 full, tombstones included
+    if ((_mNumNames + _mNumTombstones + 1) * 4 > _mSlots.size() * 3) {
+      size_t num_slots = 8;
+      while (num_slots < (_mNumNames + 1) * 2)
+        num_slots *= 2;
+      rehash(num_slots);
+    }
+    insertSlot(name, entry);
+  }
   DEBUG(
     LOG_DEBUG_SPAM,
     NULL,
@@ -21,17 +126,40 @@ void LSLSymbolTable::define(LSLSymbol *symbol) {
 }
 
 LSLSymbol *LSLSymbolTable::lookup(const char *name, LSLSymbolType type) {
-  auto sym_range = _mSymbols.equal_range(name);
-  for (auto it = sym_range.first; it != sym_range.second; ++it) {
-    if (type == SYM_ANY || type == it->second->getSymbolType())
-      return it->second;
+  if (_mFindIndex || !_mAtoms)
+    return lookupAtom(name, type);
+  // nothing could have been defined with this name if it was never interned.
+  const char *atom = _mAtoms->find(name);
+  if (!atom)
+    return nullptr;
+  return lookupAtom(atom, type);
+}
+
+LSLSymbol *LSLSymbolTable::lookupAtom(const char *atom, LSLSymbolType type) {
+  if (_mFindIndex) {
+    int idx = _mFindIndex(atom);
+    if (idx < 0)
+      return nullptr;
+    LSLSymbol *sym = _mIndexedSymbols[idx];
+    return (type == SYM_ANY || type == sym->getSymbolType()) ? sym : nullptr;
+  }
+  for (uint32_t entry = findEntry(atom); entry != NO_ENTRY; entry = _mSymbols[entry].shadowed) {
+    LSLSymbol *sym = _mSymbols[entry].symbol;
+    if (type == SYM_ANY || type == sym->getSymbolType())
+      return sym;
   }
   return nullptr;
 }
 
+size_t LSLSymbolTable::countAtom(const char *atom) {
+  size_t count = 0;
+  for (uint32_t entry = findEntry(atom); entry != NO_ENTRY; entry = _mSymbols[entry].shadowed)
+    ++count;
+  return count;
+}
+
 void LSLSymbolTable::checkSymbols() {
-  for (auto &symbol: _mSymbols) {
-    LSLSymbol *sym = symbol.second;
+  for (auto *sym : getSymbols()) {
     if (sym->getSubType() != SYM_BUILTIN && sym->getSubType() != SYM_EVENT_PARAMETER &&
         sym->getReferences() <= 1) {
       // We don't really care if the default state never gets explicitly referenced.
@@ -43,18 +171,71 @@ void LSLSymbolTable::checkSymbols() {
 }
 
 bool LSLSymbolTable::remove(LSLSymbol *symbol) {
-  for (auto iter = _mSymbols.begin(); iter != _mSymbols.end(); ++iter) {
-    if (iter->second == symbol) {
-      _mSymbols.erase(iter);
-      return true;
+  assert(!_mFrozen);
+  Slot *slot = findSlot(symbol->getName());
+  if (!slot)
+    return false;
+  // unlink it from the chain of symbols with its name
+  uint32_t *link = &slot->entry;
+  while (*link != NO_ENTRY && _mSymbols[*link].symbol != symbol)
+    link = &_mSymbols[*link].shadowed;
+  if (*link == NO_ENTRY)
+    return false;
+  uint32_t entry = *link;
+  *link = _mSymbols[entry].shadowed;
+  _mSymbols[entry] = {nullptr, NO_ENTRY};
+  if (slot->entry == NO_ENTRY) {
+    slot->name = TOMBSTONE_NAME;
+    --_mNumNames;
+    ++_mNumTombstones;
+  }
+  // don't let the holes left behind pile up
+  if (++_mNumRemoved > 16 && _mNumRemoved * 2 > _mSymbols.size())
+    compact();
+  return true;
+}
+
+void LSLSymbolTable::compact() {
+  std::vector<LSLSymbolRange::Entry> old_symbols;
+  old_symbols.swap(_mSymbols);
+  _mSlots.clear();
+  _mNumNames = 0;
+  _mNumTombstones = 0;
+  _mNumRemoved = 0;
+  // defining them again in the same order rebuilds the same chains
+  for (auto &entry : old_symbols) {
+    if (entry.symbol)
+      define(entry.symbol);
+  }
+}
+
+LSLSymbol *LSLScopeChain::lookupAtom(const char *atom, LSLSymbolType type) const {
+  if (_mTables.empty())
+    return nullptr;
+  // only counted while profiling
+  auto *ctx = _mTables.back()->mContext;
+  if (ctx && !ctx->profiler)
+    ctx = nullptr;
+  for (size_t i = _mTables.size(); i-- > 0;) {
+    // the script checks the builtins before its own globals
+    if (i == 0 && _mBuiltins) {
+      if (ctx)
+        ++ctx->counters.symbol_lookups;
+      // the builtins may have been interned elsewhere, they need to be found by name.
+      if (auto *sym = _mBuiltins->lookup(atom, type))
+        return sym;
     }
+    if (ctx)
+      ++ctx->counters.symbol_lookups;
+    if (auto *sym = _mTables[i]->lookupAtom(atom, type))
+      return sym;
   }
-  return false;
+  return nullptr;
 }
 
 void LSLSymbolTable::resetTracking() {
-  for (auto &symbol: _mSymbols) {
-    symbol.second->resetTracking();
+  for (auto *symbol : getSymbols()) {
+    symbol->resetTracking();
   }
 }
 
@@ -62,33 +243,31 @@ void LSLSymbolTable::resetTracking() {
 void LSLSymbolTableManager::setMangledNames() {
   int seq = 0;
   for (auto &desc_table: _mTables) {
-    auto &node_symbols = desc_table->getMap();
-    // We want mangled symbol name to be consistent across STL implementations,
-    // and our symbol map is specifically unsorted. Place the symbol names in an std::set
-    // which will de-dupe and has a specification-imposed iteration order.
-    std::set<std::string> key_names;
-    for (auto &it: node_symbols) {
-      key_names.insert(it.first);
-    }
-    for (auto &key_name: key_names) {
-      auto range = node_symbols.equal_range(key_name.c_str());
-      for (auto &symbol = range.first; symbol != range.second; ++symbol) {
-        LSLSymbol *sym = symbol->second;
-        // can't rename events or builtin names, obviously!
-        if (sym->getSymbolType() == SYM_EVENT || sym->getSubType() == SYM_BUILTIN)
-          continue;
-        // default state _must_ be named default, can't mangle the name.
-        if (sym->getSymbolType() == SYM_STATE && !strcmp("default", sym->getName()))
-          continue;
-
-        char *mangled_id = _mAllocator->alloc(30);
-        while (true) {
-          snprintf(mangled_id, 30, "_%x", seq++);
-          // Make sure this name isn't already in use
-          if (!desc_table->lookup(mangled_id, SYM_ANY)) {
-            sym->setMangledName(mangled_id);
-            break;
-          }
+    // We want mangled symbol names to be consistent across runs, so go through the
+    // symbols by name rather than in whatever order they happened to be defined.
+    // Symbols sharing a name go newest first, same as lookups see them.
+    std::vector<LSLSymbol *> symbols;
+    for (auto *sym : desc_table->getSymbols())
+      symbols.push_back(sym);
+    std::reverse(symbols.begin(), symbols.end());
+    std::stable_sort(symbols.begin(), symbols.end(), [](LSLSymbol *a, LSLSymbol *b) {
+      return strcmp(a->getName(), b->getName()) < 0;
+    });
+    for (auto *sym : symbols) {
+      // can't rename events or builtin names, obviously!
+      if (sym->getSymbolType() == SYM_EVENT || sym->getSubType() == SYM_BUILTIN)
+        continue;
+      // default state _must_ be named default, can't mangle the name.
+      if (sym->getSymbolType() == SYM_STATE && !strcmp("default", sym->getName()))
+        continue;
+
+      char *mangled_id = _mAllocator->alloc(30);
+      while (true) {
+        snprintf(mangled_id, 30, "_%x", seq++);
+        // Make sure this name isn't already in use
+        if (!desc_table->lookup(mangled_id, SYM_ANY)) {
+          sym->setMangledName(mangled_id);
+          break;
         }
       }
     }
@@ -4,11 +4,10 @@
 #include <cassert>
 #include <clocale>
 #include <cstddef>
-#include <unordered_map>
+#include <cstdint>
 #include <vector>
 
 #include "allocator.hh"
-#include "unordered_cstr_map.hh"
 
 namespace Tailslide {
 
@@ -29,25 +28,56 @@ enum LSLSymbolType       { SYM_ANY = -1, SYM_VARIABLE, SYM_FUNCTION, SYM_STATE,
 enum LSLSymbolTableType  { SYMTAB_GLOBAL, SYMTAB_STATE, SYMTAB_FUNCTION, SYMTAB_LEXICAL, SYMTAB_BUILTINS };
 enum LSLSymbolSubType    { SYM_LOCAL, SYM_GLOBAL, SYM_BUILTIN, SYM_FUNCTION_PARAMETER, SYM_EVENT_PARAMETER };
 
+struct ScriptContext;
+// Intern `name` with the script's allocator so it can be looked up by identity.
+// Returned as-is if there's no allocator to intern it with, like for builtins.
+const char *intern_name(ScriptContext *ctx, const char *name);
+
+// For symbols that never got an ID, like ones made without a script context
+const uint32_t NO_SYMBOL_ID = UINT32_MAX;
+// Every symbol gets a dense ID when it's made so passes can keep data about symbols
+// in vectors. The global builtins are shared between scripts and numbered separately
+// from each script's own symbols, which count up from 0 per script. Builtin-ish
+// symbols a script makes for itself, like its event handlers, count as its own.
+inline bool takes_builtin_id(ScriptContext *ctx, LSLSymbolSubType sub_type) {
+  return !ctx && sub_type == SYM_BUILTIN;
+}
+uint32_t assign_symbol_id(ScriptContext *ctx, LSLSymbolSubType sub_type);
+uint32_t get_num_builtin_symbol_ids();
+// Called once the builtins are set up, no more builtin IDs may be handed out after this.
+void freeze_builtin_symbol_ids();
+
 class LSLSymbol: public TrackableObject {
   public:
     LSLSymbol( ScriptContext *ctx, const char *name, class LSLType *type, LSLSymbolType symbol_type, LSLSymbolSubType sub_type, YYLTYPE *lloc, class LSLParamList *function_decl = NULL, class LSLASTNode *var_decl = NULL, class LSLLabel *label_decl = NULL  )
-      : TrackableObject(ctx), _mName(name), _mType(type), _mSymbolType(symbol_type), _mSubType(sub_type), _mLoc(*lloc), _mFunctionDecl(function_decl), _mVarDecl(var_decl),
-        _mLabelDecl(label_decl), _mConstantValue(NULL), _mReferences(0), _mAssignments(0), _mMangledName(NULL) {};
+      : TrackableObject(ctx), _mName(intern_name(ctx, name)), _mType(type), _mSymbolType(symbol_type), _mSubType(sub_type), _mLoc(*lloc), _mFunctionDecl(function_decl), _mVarDecl(var_decl),
+        _mLabelDecl(label_decl), _mConstantValue(NULL), _mReferences(0), _mAssignments(0), _mMangledName(NULL),
+        _mId(assign_symbol_id(ctx, sub_type)), _mHasBuiltinId(takes_builtin_id(ctx, sub_type)) {};
 
     LSLSymbol( ScriptContext *ctx, const char *name, class LSLType *type, LSLSymbolType symbol_type, LSLSymbolSubType sub_type, class LSLParamList *function_decl = NULL, class LSLASTNode *var_decl = NULL, class LSLLabel *label_decl = NULL )
-      : TrackableObject(ctx), _mName(name), _mType(type), _mSymbolType(symbol_type), _mSubType(sub_type), _mLoc({}), _mFunctionDecl(function_decl), _mVarDecl(var_decl),
-        _mLabelDecl(label_decl), _mConstantValue(NULL), _mReferences(0), _mAssignments(0), _mMangledName(NULL) {};
+      : TrackableObject(ctx), _mName(intern_name(ctx, name)), _mType(type), _mSymbolType(symbol_type), _mSubType(sub_type), _mLoc({}), _mFunctionDecl(function_decl), _mVarDecl(var_decl),
+        _mLabelDecl(label_decl), _mConstantValue(NULL), _mReferences(0), _mAssignments(0), _mMangledName(NULL),
+        _mId(assign_symbol_id(ctx, sub_type)), _mHasBuiltinId(takes_builtin_id(ctx, sub_type)) {};
+
+    static constexpr bool TRIVIAL_TEARDOWN = true;
 
     const char          *getName()         { return _mName; }
+    uint32_t             getId() const     { return _mId; }
+    // whether `getId()` is from the shared builtin numbering rather than the script's
+    bool                 hasBuiltinId() const { return _mHasBuiltinId; }
     class LSLType  *getType()         { return _mType; }
     LSLIType getIType();
 
+    // Builtin symbols may be shared by scripts being parsed on other threads,
+    // so their usage is never tracked.
     int                  getReferences() const   { return _mReferences; }
-    int                  addReference()    { return ++_mReferences; }
+    int                  addReference()    { return _mSubType == SYM_BUILTIN ? _mReferences : ++_mReferences; }
     int                  getAssignments() const  { return _mAssignments; }
-    int                  addAssignment()   { return ++_mAssignments; }
+    int                  addAssignment()   { return _mSubType == SYM_BUILTIN ? _mAssignments : ++_mAssignments; }
+    int                  removeReference()  { return _mSubType == SYM_BUILTIN ? _mReferences : --_mReferences; }
+    int                  removeAssignment() { return _mSubType == SYM_BUILTIN ? _mAssignments : --_mAssignments; }
     void                 resetTracking()   { _mAssignments = 0; _mReferences = 0; }
+    void setTracking(int references, int assignments) { _mReferences = references; _mAssignments = assignments; }
 
     LSLSymbolType         getSymbolType()  { return _mSymbolType; }
     LSLSymbolSubType      getSubType()     { return _mSubType;    }
@@ -64,6 +94,7 @@ class LSLSymbol: public TrackableObject {
 
     YYLTYPE             *getLoc()         { return &_mLoc; }
     class LSLParamList *getFunctionDecl() { return _mFunctionDecl; }
+    void setFunctionDecl(class LSLParamList *function_decl) { _mFunctionDecl = function_decl; }
     class LSLASTNode        *getVarDecl() { return _mVarDecl; }
     class LSLLabel        *getLabelDecl() { return _mLabelDecl; }
 
@@ -101,25 +132,97 @@ class LSLSymbol: public TrackableObject {
     bool _mHasJumps = false;
     // if the function contains jumps that are not break-like or continue-like
     bool _mHasUnstructuredJumps = false;
+    uint32_t _mId;
+    bool _mHasBuiltinId;
+};
+
+// Iterates over a table's symbols in the order they were defined, skipping removed ones
+class LSLSymbolRange {
+  public:
+    struct Entry {
+      LSLSymbol *symbol;
+      // the entry for the previous definition with the same name, if any
+      uint32_t shadowed;
+    };
+
+    class iterator {
+      public:
+        iterator(const Entry *pos, const Entry *end) : _mPos(pos), _mEnd(end) { skipRemoved(); }
+        LSLSymbol *operator*() const { return _mPos->symbol; }
+        iterator &operator++() { ++_mPos; skipRemoved(); return *this; }
+        bool operator!=(const iterator &other) const { return _mPos != other._mPos; }
+      private:
+        void skipRemoved() { while (_mPos != _mEnd && !_mPos->symbol) ++_mPos; }
+        const Entry *_mPos;
+        const Entry *_mEnd;
+    };
+
+    explicit LSLSymbolRange(const std::vector<Entry> &entries) : _mEntries(entries) {}
+    iterator begin() const { return {_mEntries.data(), _mEntries.data() + _mEntries.size()}; }
+    iterator end() const {
+      auto *end = _mEntries.data() + _mEntries.size();
+      return {end, end};
+    }
+  private:
+    const std::vector<Entry> &_mEntries;
 };
 
 class LSLSymbolTable: public TrackableObject {
   public:
-    explicit LSLSymbolTable(ScriptContext *ctx, LSLSymbolTableType symtab_type)
-      : TrackableObject(ctx), _mSymbolTableType(symtab_type) {};
+    explicit LSLSymbolTable(ScriptContext *ctx, LSLSymbolTableType symtab_type);
     LSLSymbol *lookup( const char *name, LSLSymbolType type = SYM_ANY );
+    // Skips finding the atom for the name, `atom` must come from this table's atoms
+    LSLSymbol *lookupAtom( const char *atom, LSLSymbolType type = SYM_ANY );
+    // How many symbols named `atom` are defined in this table
+    size_t countAtom( const char *atom );
     void            define( LSLSymbol *symbol );
     bool            remove( LSLSymbol *symbol );
     void            checkSymbols();
     void resetTracking();
+    // No more symbols may be defined or removed after this
+    void freeze() { _mFrozen = true; }
+    bool isFrozen() const { return _mFrozen; }
+    // Look symbols up through a perfect hash over their names instead of the map.
+    // `find_index` gives the index of a name's symbol in `symbols`, or -1.
+    // Only makes sense for frozen tables with unique names, like the builtins.
+    void setPerfectHash(int (*find_index)(const char *name), LSLSymbol * const *symbols) {
+      _mFindIndex = find_index;
+      _mIndexedSymbols = symbols;
+    }
+    // Where our symbols' names are interned, the script's allocator by default
+    void setAtoms(AtomTable *atoms) { _mAtoms = atoms; }
 
   private:
-    UnorderedCStrMap<LSLSymbol *> _mSymbols;
+    // where the newest symbol with a given name is in `_mSymbols`
+    struct Slot {
+      const char *name;
+      uint32_t entry;
+    };
+    static constexpr uint32_t NO_ENTRY = UINT32_MAX;
+
+    uint32_t findEntry(const char *atom);
+    Slot *findSlot(const char *atom);
+    void insertSlot(const char *atom, uint32_t entry);
+    void rehash(size_t num_slots);
+    void compact();
+
+    // Flat open-addressing index over names, which are atoms so they're hashed and
+    // compared by address. Symbols that share a name are chained newest first through
+    // their entries, so the newest one wins lookups.
+    std::vector<Slot> _mSlots;
+    std::vector<LSLSymbolRange::Entry> _mSymbols;
+    size_t _mNumNames = 0;
+    size_t _mNumTombstones = 0;
+    size_t _mNumRemoved = 0;
     std::vector<class LSLLabel *> _mLabels;
     LSLSymbolTableType _mSymbolTableType;
+    bool _mFrozen = false;
+    int (*_mFindIndex)(const char *name) = nullptr;
+    LSLSymbol * const *_mIndexedSymbols = nullptr;
+    AtomTable *_mAtoms = nullptr;
 
   public:
-    UnorderedCStrMap<LSLSymbol*> &getMap() {return _mSymbols;}
+    LSLSymbolRange getSymbols() const { return LSLSymbolRange(_mSymbols); }
     LSLSymbolTableType getTableType() { return _mSymbolTableType; }
 
     // Used for tracking all labels in a function. Labels in LSL are
@@ -134,10 +237,61 @@ class LSLSymbolTable: public TrackableObject {
     }
 };
 
+/// The symbol tables in scope at some point in a script, outermost first. Lets a pass
+/// that's walking the tree resolve names against the scopes it has already entered
+/// instead of walking back up through every ancestor to find them.
+class LSLScopeChain {
+  public:
+    void push(LSLSymbolTable *table) { _mTables.push_back(table); }
+    void pop() { _mTables.pop_back(); }
+    bool empty() const { return _mTables.empty(); }
+    /// Set once the outermost scope is the script's, builtins are checked just before it.
+    void setBuiltins(LSLSymbolTable *builtins) { _mBuiltins = builtins; }
+    /// Finds the same symbol `LSLASTNode::lookupAtom()` would from inside the innermost scope
+    LSLSymbol *lookupAtom(const char *atom, LSLSymbolType type) const;
+
+  private:
+    std::vector<LSLSymbolTable *> _mTables;
+    LSLSymbolTable *_mBuiltins = nullptr;
+};
+
+/// Data a pass keeps about each symbol, in vectors indexed by symbol ID
+/// rather than a map keyed on the symbols' addresses.
+template <typename T>
+class SymbolDataVector {
+  public:
+    /// Make room for the given number of IDs up front. Entries are only
+    /// guaranteed to stay put as long as no symbol past those is looked up.
+    void reserveIds(uint32_t num_builtin_ids, uint32_t num_script_ids) {
+      if (_mBuiltinData.size() < num_builtin_ids)
+        _mBuiltinData.resize(num_builtin_ids);
+      if (_mScriptData.size() < num_script_ids)
+        _mScriptData.resize(num_script_ids);
+    }
+
+    T &operator[](LSLSymbol *sym) {
+      auto &data = sym->hasBuiltinId() ? _mBuiltinData : _mScriptData;
+      uint32_t id = sym->getId();
+      assert(id != NO_SYMBOL_ID);
+      if (id >= data.size())
+        data.resize(id + 1);
+      return data[id];
+    }
+
+  private:
+    std::vector<T> _mBuiltinData;
+    std::vector<T> _mScriptData;
+};
+
 class LSLSymbolTableManager {
   public:
     explicit LSLSymbolTableManager(ScriptAllocator *allocator) {_mAllocator = allocator;};
     void registerTable(LSLSymbolTable *table) {_mTables.push_back(table);};
+    const std::vector<LSLSymbolTable *> &getTables() const { return _mTables; }
+    // registration order decides mangled names, this is for when tables get swapped out.
+    void setTables(std::vector<LSLSymbolTable *> tables) { _mTables = std::move(tables); }
+    // forget about all registered tables, they're owned by the allocator.
+    void reset() {_mTables.clear();};
     void setMangledNames();
     void resetTracking();
   protected:
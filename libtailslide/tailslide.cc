@@ -1,6 +1,16 @@
+#include <fstream>
+#include <sstream>
 #include <string>
 
+#ifndef _WIN32
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
 #include "tailslide.hh"
+#include "ast_serialization.hh"
 #include "lslmini.tab.hh"
 
 int tailslide_lex_init_extra(Tailslide::ScriptContext *, void **);
@@ -8,6 +18,7 @@ void tailslide_set_in(FILE *, void *);
 struct yy_buffer_state *tailslide__scan_bytes ( const char *bytes, int len, void *);
 
 int tailslide_lex_destroy(void *);
+void tailslide_reset_scanner(void *);
 
 namespace Tailslide {
 
@@ -21,6 +32,29 @@ ScopedScriptParser::ScopedScriptParser(LSLSymbolTable *builtins) : logger(&alloc
     context.builtins = builtins;
   else
     context.builtins = &gBuiltinsSymbolTable;
+  allocator.setContext(&context);
+}
+
+ScopedScriptParser::~ScopedScriptParser() {
+  // clean up flex
+  if (context.scanner)
+    tailslide_lex_destroy(context.scanner);
+}
+
+void ScopedScriptParser::reset() {
+  // Logger and table manager only hold pointers into the allocator's memory,
+  // so clear them out before it goes away.
+  logger.reset();
+  table_manager.reset();
+  allocator.reset();
+  script = nullptr;
+  ast_sane = false;
+  context.script = nullptr;
+  context.ast_sane = true;
+  context.parsing = false;
+  context.glloc = {};
+  context.num_symbol_ids = 0;
+  context.usage_tracked = false;
 }
 
 // make sure we don't leak an FH if we throw
@@ -32,7 +66,7 @@ class FileCloser {
 };
 
 LSLScript *ScopedScriptParser::parseLSLFile(const std::string &filename) {
-  // can only be used to parse a single script.
+  // can only hold a single script at a time, reset() first.
   assert(!script);
   FILE *yyin = fopen(filename.c_str(), "rb");
   if (yyin == nullptr) {
@@ -58,25 +92,78 @@ LSLScript *ScopedScriptParser::parseLSLBytes(const char *buf, int buf_len) {
   return script;
 }
 
-void ScopedScriptParser::initScanner() {
+LSLScript *ScopedScriptParser::parseFragment(const char *buf, int buf_len) {
+  LSLScript *old_script = script;
+  bool old_ast_sane = ast_sane;
+  auto old_glloc = context.glloc;
+  script = nullptr;
+  context.script = nullptr;
+  context.ast_sane = true;
+  parseLSLBytes(buf, buf_len);
+  LSLScript *fragment = context.ast_sane ? script : nullptr;
+
+  script = old_script;
+  ast_sane = old_ast_sane;
+  context.script = old_script;
+  context.ast_sane = old_ast_sane;
+  context.glloc = old_glloc;
+  return fragment;
+}
+
+LSLScript *ScopedScriptParser::loadSerialized(const char *buf, size_t buf_len) {
+  // can only hold a single script at a time, reset() first.
   assert(!script);
-  // ScopedScriptParser owns the allocator and context instance because we can't
-  // reasonably re-use Allocator instances with our current model of having
-  // it magically pass along the current script context.
-  allocator.setContext(&context);
+  context.script = deserialize_script(&context, buf, buf_len);
+  script = context.script;
+  ast_sane = script && context.ast_sane;
+  return script;
+}
+
+LSLScript *ScopedScriptParser::loadSerializedFile(const std::string &filename) {
+#ifndef _WIN32
+  int fd = open(filename.c_str(), O_RDONLY);
+  if (fd < 0)
+    throw "couldn't open file";
+  struct stat st {};
+  if (fstat(fd, &st) == 0 && st.st_size > 0) {
+    void *mapped = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapped != MAP_FAILED) {
+      // nothing in the tree points into the file, so it can be unmapped right away.
+      LSLScript *loaded = loadSerialized((const char *)mapped, (size_t)st.st_size);
+      munmap(mapped, (size_t)st.st_size);
+      return loaded;
+    }
+  } else {
+    close(fd);
+  }
+#endif
+  std::ifstream f(filename, std::ios::binary);
+  if (!f)
+    throw "couldn't open file";
+  std::stringstream contents;
+  contents << f.rdbuf();
+  std::string data = contents.str();
+  return loadSerialized(data.data(), data.size());
+}
 
-  // initialize flex
-  tailslide_lex_init_extra(&context, &context.scanner);
+void ScopedScriptParser::initScanner() {
+  assert(!script);
+  // initialize flex, or just clear out the existing scanner's state
+  // if we've parsed something before.
+  if (context.scanner)
+    tailslide_reset_scanner(context.scanner);
+  else
+    tailslide_lex_init_extra(&context, &context.scanner);
 }
 
 void ScopedScriptParser::parseInternal() {
+  ScopedPass pass(&context, "parse");
   // parse
   context.parsing = true;
   tailslide_parse(context.scanner);
   context.parsing = false;
 
-  // clean up flex
-  tailslide_lex_destroy(context.scanner);
   ast_sane = context.ast_sane;
   script = context.script;
 }
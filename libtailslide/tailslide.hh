@@ -15,6 +15,7 @@ namespace Tailslide {
 
 struct ScopedScriptParser {
     explicit ScopedScriptParser(LSLSymbolTable *builtins);
+    ~ScopedScriptParser();
     ScriptAllocator allocator {};
     Logger logger;
     LSLScript *script = nullptr;
@@ -25,6 +26,18 @@ struct ScopedScriptParser {
     LSLScript *parseLSLFile(FILE *yyin);
     LSLScript *parseLSLFile(const std::string &filename);
     LSLScript *parseLSLBytes(const char *buf, int buf_len);
+    /// Parse `buf` with this parser's allocator without replacing the current script,
+    /// for re-parsing pieces of an edited script. Errors go to the same logger.
+    LSLScript *parseFragment(const char *buf, int buf_len);
+    /// Load a script written by `serialize_script()`, already analyzed and without
+    /// going through the lexer or parser. Returns nullptr if it couldn't be loaded.
+    LSLScript *loadSerialized(const char *buf, size_t buf_len);
+    /// Same as `loadSerialized()`, but mapping the file into memory if possible
+    LSLScript *loadSerializedFile(const std::string &filename);
+    /// Throw away the current script and everything allocated for it so the
+    /// parser may be used for another script. Memory blocks and scanner state
+    /// are kept around so subsequent parses are cheap.
+    void reset();
 
   protected:
     void initScanner();
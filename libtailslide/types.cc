@@ -8,7 +8,7 @@
 namespace Tailslide {
 // TODO: use structs or something here
 
-const static int COERCION_TABLE[][2] = {
+static constexpr int COERCION_TABLE[][2] = {
         // wanted type      acceptable type
         {LST_FLOATINGPOINT, LST_INTEGER},
         {LST_STRING,        LST_KEY},
@@ -17,7 +17,7 @@ const static int COERCION_TABLE[][2] = {
 };
 
 // from->to allowed lookup table
-const static int LEGAL_CAST_TABLE[LST_MAX][LST_MAX] = {
+static constexpr int LEGAL_CAST_TABLE[LST_MAX][LST_MAX] = {
     /* NULL   */ {0},
     /* INT    */ {0, 1, 1, 1, 0, 0, 0, 1, 0},
     /* FLOAT  */ {0, 1, 1, 1, 0, 0, 0, 1, 0},
@@ -29,7 +29,7 @@ const static int LEGAL_CAST_TABLE[LST_MAX][LST_MAX] = {
     /* ERROR  */ {0},
 };
 
-const static int OPERATOR_RESULTS[][4] = {
+static constexpr int OPERATOR_RESULTS[][4] = {
 
         // operator   left type           right type          result type
         // ++
@@ -181,6 +181,96 @@ const static int OPERATOR_RESULTS[][4] = {
         {-1,          -1,                -1,                -1},
 };
 
+// The tables above are easiest to read and maintain, but scanning them for every expression
+// is slow. Flatten them into matrices at compile time so lookups are a single load.
+
+// where a missing right-hand side goes in `OperatorResultMatrix`
+static constexpr int RHS_NONE = LST_MAX;
+static constexpr int8_t NO_RESULT = -1;
+
+struct OperatorResultMatrix {
+  // [operator][left type][right type or RHS_NONE], NO_RESULT if the operation isn't valid
+  int8_t results[256][LST_MAX][LST_MAX + 1];
+};
+
+static constexpr OperatorResultMatrix build_operator_result_matrix() {
+  OperatorResultMatrix matrix {};
+  for (auto &op_results : matrix.results) {
+    for (auto &left_results : op_results) {
+      for (auto &result : left_results)
+        result = NO_RESULT;
+    }
+  }
+
+  // the first matching entry wins, like when scanning the table
+  for (int i = 0; OPERATOR_RESULTS[i][0] != -1; ++i) {
+    const int *entry = OPERATOR_RESULTS[i];
+    for (int left = 0; left < LST_MAX; ++left) {
+      if (entry[1] != left && entry[1] != LST_ANY)
+        continue;
+      for (int right = 0; right <= RHS_NONE; ++right) {
+        bool match = right == RHS_NONE ? entry[2] == LST_NONE : (entry[2] == LST_ANY || entry[2] == right);
+        int8_t &result = matrix.results[entry[0]][left][right];
+        if (match && result == NO_RESULT)
+          result = (int8_t)entry[3];
+      }
+    }
+  }
+
+  // Compound assignments are valid when the operation they're sugar for gives back
+  // the lvalue's type, see `get_result_type_by_scan()` for the details.
+  const int compound_ops[][2] = {
+      {OP_ADD_ASSIGN, OP_PLUS},
+      {OP_SUB_ASSIGN, OP_MINUS},
+      {OP_MUL_ASSIGN, OP_MUL},
+      {OP_DIV_ASSIGN, OP_DIV},
+      {OP_MOD_ASSIGN, OP_MOD},
+  };
+  for (const auto &compound_op : compound_ops) {
+    for (int left = 0; left < LST_MAX; ++left) {
+      for (int right = 0; right <= RHS_NONE; ++right) {
+        int8_t base_result = matrix.results[compound_op[1]][left][right];
+        int8_t &result = matrix.results[compound_op[0]][left][right];
+        if (base_result == left)
+          result = base_result;
+        else if (base_result != NO_RESULT && compound_op[1] == OP_MUL && left == LST_INTEGER && right == LST_FLOATINGPOINT)
+          result = LST_FLOATINGPOINT;
+      }
+    }
+  }
+  return matrix;
+}
+
+static constexpr OperatorResultMatrix OPERATOR_RESULT_MATRIX = build_operator_result_matrix();
+
+struct CoercionMatrix {
+  // [from][to]
+  bool allowed[LST_MAX][LST_MAX];
+};
+
+static constexpr CoercionMatrix build_coercion_matrix() {
+  CoercionMatrix matrix {};
+  for (int from = 0; from < LST_MAX; ++from) {
+    for (int to = 0; to < LST_MAX; ++to) {
+      // error type matches anything, and every type can be used as itself
+      matrix.allowed[from][to] = from == LST_ERROR || to == LST_ERROR || from == to;
+    }
+  }
+  for (int i = 0; COERCION_TABLE[i][1] != -1; ++i)
+    matrix.allowed[COERCION_TABLE[i][1]][COERCION_TABLE[i][0]] = true;
+  return matrix;
+}
+
+static constexpr CoercionMatrix COERCION_MATRIX = build_coercion_matrix();
+
+static_assert(OPERATOR_RESULT_MATRIX.results['+'][LST_INTEGER][LST_FLOATINGPOINT] == LST_FLOATINGPOINT, "");
+static_assert(OPERATOR_RESULT_MATRIX.results['+'][LST_LIST][LST_LIST] == LST_LIST, "");
+static_assert(OPERATOR_RESULT_MATRIX.results['-'][LST_VECTOR][RHS_NONE] == LST_VECTOR, "");
+static_assert(OPERATOR_RESULT_MATRIX.results[OP_ADD_ASSIGN][LST_INTEGER][LST_FLOATINGPOINT] == NO_RESULT, "");
+static_assert(OPERATOR_RESULT_MATRIX.results[OP_MUL_ASSIGN][LST_INTEGER][LST_FLOATINGPOINT] == LST_FLOATINGPOINT, "");
+static_assert(COERCION_MATRIX.allowed[LST_INTEGER][LST_FLOATINGPOINT], "");
+static_assert(!COERCION_MATRIX.allowed[LST_FLOATINGPOINT][LST_INTEGER], "");
+
 LSLType LSLType::_sTypes[LST_MAX] = { // NOLINT(cert-err58-cpp)
         LSLType(LST_NULL, true),
         LSLType(LST_INTEGER, true),
@@ -194,29 +284,48 @@ LSLType LSLType::_sTypes[LST_MAX] = { // NOLINT(cert-err58-cpp)
 };
 
 bool LSLType::canCoerce(LSLType *to) {
+  return COERCION_MATRIX.allowed[getIType()][to->getIType()];
+}
+
+class LSLType *LSLType::getResultType(LSLOperator op, LSLType *right) {
+  // error on either side is always error
+  if (getIType() == LST_ERROR || (right != nullptr && right->getIType() == LST_ERROR))
+    return TYPE(LST_ERROR);
+
+  if (op == '(') {
+    return right;
+  }
+
+  int8_t result = OPERATOR_RESULT_MATRIX.results[op][getIType()][right ? right->getIType() : RHS_NONE];
+  if (result == NO_RESULT)
+    return nullptr;
+  return TYPE((LSLIType) result);
+}
+
+bool can_coerce_by_scan(LSLType *from, LSLType *to) {
   int i;
 
   // error type matches anything
-  if (getIType() == LST_ERROR || to->getIType() == LST_ERROR)
+  if (from->getIType() == LST_ERROR || to->getIType() == LST_ERROR)
     return true;
 
   // if we're already of the target type, then of course we can be used for it
-  if (getIType() == to->getIType())
+  if (from->getIType() == to->getIType())
     return true;
 
   for (i = 0; COERCION_TABLE[i][1] != -1; i++) {
-    if (COERCION_TABLE[i][1] == getIType() && COERCION_TABLE[i][0] == to->getIType()) {
+    if (COERCION_TABLE[i][1] == from->getIType() && COERCION_TABLE[i][0] == to->getIType()) {
       return true;
     }
   }
   return false;
 }
 
-class LSLType *LSLType::getResultType(LSLOperator op, LSLType *right) {
+LSLType *get_result_type_by_scan(LSLType *left, LSLOperator op, LSLType *right) {
   int i;
 
   // error on either side is always error
-  if (getIType() == LST_ERROR || (right != nullptr && right->getIType() == LST_ERROR))
+  if (left->getIType() == LST_ERROR || (right != nullptr && right->getIType() == LST_ERROR))
     return TYPE(LST_ERROR);
 
   if (op == '(') {
@@ -236,7 +345,7 @@ class LSLType *LSLType::getResultType(LSLOperator op, LSLType *right) {
       continue;
 
     // the left side must match our left side
-    if (OPERATOR_RESULTS[i][1] != getIType() && OPERATOR_RESULTS[i][1] != LST_ANY)
+    if (OPERATOR_RESULTS[i][1] != left->getIType() && OPERATOR_RESULTS[i][1] != LST_ANY)
       continue;
 
     bool match;
@@ -260,7 +369,7 @@ class LSLType *LSLType::getResultType(LSLOperator op, LSLType *right) {
     // compound assignment.
     // For example, `int_val += 1.0` and `vec *= <1,1,1>` are forbidden.
     // but something like `float_val += 1` is fine.
-    if (compound_assignment && ret_type != this) {
+    if (compound_assignment && ret_type != left) {
       // ... is mostly true, but not entirely. There's one case in LL's compiler
       // (that was probably a mistake) where `int_val *= float_val` is allowed.
       // `int_val = int_val * float_val` is not legal since `int_val` must be promoted
@@ -270,7 +379,7 @@ class LSLType *LSLType::getResultType(LSLOperator op, LSLType *right) {
       // In Mono it causes a runtime VM error due to invalid IL if you actually try to use
       // the retval in something like `llOwnerSay((string)(int_val *= float_val))`.
       // For now let's just warn and pretend it returns a float, because it sort of does in LSO.
-      if (op == OP_MUL && getIType() == LST_INTEGER && right && right->getIType() == LST_FLOATINGPOINT) {
+      if (op == OP_MUL && left->getIType() == LST_INTEGER && right && right->getIType() == LST_FLOATINGPOINT) {
         return TYPE(LST_FLOATINGPOINT);
       }
       return nullptr;
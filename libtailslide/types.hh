@@ -44,6 +44,7 @@ enum LSLOperator : uint8_t {
 class LSLType : public LSLASTNode {
   public:
     explicit LSLType(LSLIType type, bool static_def=false) : LSLASTNode(nullptr), _mIType(type) {
+      _mNodeType = NODE_TYPE;
       // Parenting the global LSLType instances to a specific script's tree is illegal
       if (static_def)
         markStatic();
@@ -70,12 +71,12 @@ class LSLType : public LSLASTNode {
         default:                return "!invalid!";
       }
     }
-    virtual LSLNodeType getNodeType() { return NODE_TYPE; };
 
+    // These are shared by every script and only set once by `tailslide_init_builtins()`
     class LSLConstant *getDefaultValue() { return _mDefaultVal; }
-    void setDefaultValue(class LSLConstant *default_val) { _mDefaultVal = default_val; }
+    void setDefaultValue(class LSLConstant *default_val) { assert(!_mDefaultVal); _mDefaultVal = default_val; }
     class LSLConstant *getOneValue() { return _mOneVal; }
-    void setOneValue(class LSLConstant *one_val) { _mOneVal = one_val; }
+    void setOneValue(class LSLConstant *one_val) { assert(!_mOneVal); _mOneVal = one_val; }
   private:
     LSLIType _mIType;
     class LSLConstant *_mDefaultVal = nullptr;
@@ -93,6 +94,10 @@ bool operation_mutates(LSLOperator operation);
 const char *operation_str(LSLOperator operation);
 const char *operation_repr_str(LSLOperator operation);
 bool is_cast_legal(LSLIType from, LSLIType to);
+// Scan the tables `canCoerce()` and `getResultType()` are generated from.
+// Only meant for checking the generated lookup tables against.
+bool can_coerce_by_scan(LSLType *from, LSLType *to);
+LSLType *get_result_type_by_scan(LSLType *left, LSLOperator op, LSLType *right);
 
 
 }
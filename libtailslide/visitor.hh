@@ -5,6 +5,116 @@
 
 namespace Tailslide {
 
+/// Call `func` with `node` cast to the most specific type its node kind allows
+template<typename F>
+inline bool dispatch_node_kind(LSLASTNode *node, F &&func) {
+  switch(node->getNodeType()) {
+    case NODE_NODE:
+      return func(node);
+    case NODE_NULL:
+      return func((LSLASTNullNode *)node);
+    case NODE_AST_NODE_LIST:
+      return func((LSLASTNodeList<LSLASTNode> *)node);
+    case NODE_SCRIPT:
+      return func((LSLScript *)node);
+    case NODE_GLOBAL_FUNCTION:
+      return func((LSLGlobalFunction *)node);
+    case NODE_GLOBAL_VARIABLE:
+      return func((LSLGlobalVariable *)node);
+    case NODE_IDENTIFIER:
+      return func((LSLIdentifier *)node);
+    case NODE_CONSTANT: {
+      switch(node->getNodeSubType()) {
+        case NODE_INTEGER_CONSTANT:
+          return func((LSLIntegerConstant *)node);
+        case NODE_FLOAT_CONSTANT:
+          return func((LSLFloatConstant *)node);
+        case NODE_STRING_CONSTANT:
+          return func((LSLStringConstant *)node);
+        case NODE_KEY_CONSTANT:
+          return func((LSLKeyConstant *)node);
+        case NODE_VECTOR_CONSTANT:
+          return func((LSLVectorConstant *)node);
+        case NODE_QUATERNION_CONSTANT:
+          return func((LSLQuaternionConstant *)node);
+        case NODE_LIST_CONSTANT:
+          return func((LSLListConstant *)node);
+        default:
+          return func((LSLConstant *)node);
+      }
+    }
+    case NODE_FUNCTION_DEC:
+      return func((LSLFunctionDec *)node);
+    case NODE_EVENT_DEC:
+      return func((LSLEventDec *)node);
+    case NODE_STATE:
+      return func((LSLState *)node);
+    case NODE_EVENT_HANDLER:
+      return func((LSLEventHandler *)node);
+    case NODE_STATEMENT:
+      switch(node->getNodeSubType()) {
+        case NODE_COMPOUND_STATEMENT:
+          return func((LSLCompoundStatement *)node);
+        case NODE_EXPRESSION_STATEMENT:
+          return func((LSLExpressionStatement *)node);
+        case NODE_RETURN_STATEMENT:
+          return func((LSLReturnStatement *)node);
+        case NODE_LABEL:
+          return func((LSLLabel *)node);
+        case NODE_JUMP_STATEMENT:
+          return func((LSLJumpStatement *)node);
+        case NODE_IF_STATEMENT:
+          return func((LSLIfStatement *)node);
+        case NODE_FOR_STATEMENT:
+          return func((LSLForStatement *)node);
+        case NODE_DO_STATEMENT:
+          return func((LSLDoStatement *)node);
+        case NODE_WHILE_STATEMENT:
+          return func((LSLWhileStatement *)node);
+        case NODE_DECLARATION:
+          return func((LSLDeclaration *)node);
+        case NODE_STATE_STATEMENT:
+          return func((LSLStateStatement *)node);
+        case NODE_NOP_STATEMENT:
+          return func((LSLNopStatement *)node);
+        default:
+          return func((LSLStatement *)node);
+      }
+    case NODE_EXPRESSION:
+      switch(node->getNodeSubType()) {
+        case NODE_TYPECAST_EXPRESSION:
+          return func((LSLTypecastExpression *)node);
+        case NODE_BOOL_CONVERSION_EXPRESSION:
+          return func((LSLBoolConversionExpression *)node);
+        case NODE_PRINT_EXPRESSION:
+          return func((LSLPrintExpression *)node);
+        case NODE_FUNCTION_EXPRESSION:
+          return func((LSLFunctionExpression *)node);
+        case NODE_VECTOR_EXPRESSION:
+          return func((LSLVectorExpression *)node);
+        case NODE_QUATERNION_EXPRESSION:
+          return func((LSLQuaternionExpression *)node);
+        case NODE_LIST_EXPRESSION:
+          return func((LSLListExpression *)node);
+        case NODE_LVALUE_EXPRESSION:
+          return func((LSLLValueExpression *)node);
+        case NODE_PARENTHESIS_EXPRESSION:
+          return func((LSLParenthesisExpression *)node);
+        case NODE_BINARY_EXPRESSION:
+          return func((LSLBinaryExpression *)node);
+        case NODE_UNARY_EXPRESSION:
+          return func((LSLUnaryExpression *)node);
+        case NODE_CONSTANT_EXPRESSION:
+          return func((LSLConstantExpression *)node);
+        default:
+          return func((LSLExpression *)node);
+      }
+    case NODE_TYPE:
+      return func((LSLType *)node);
+  }
+  return func(node);
+}
+
 class ASTVisitor {
   public:
     virtual bool visit(LSLASTNode *node) { return true; }
@@ -154,6 +264,193 @@ class DepthFirstASTVisitor: public ASTVisitor {
     virtual bool isDepthFirst() {return true;}
 };
 
+// Used to tell apart statically dispatched visitors
+class StaticASTVisitorBase {};
+
+/// Like ASTVisitor, but dispatches to the most specific `visit()` handler at
+/// compile-time rather than through virtual calls. Subclasses pass their own type
+/// as `Derived`, must have `using StaticASTVisitor::visit;` so unhandled node
+/// types fall back to their base class' handler, and must befriend
+/// `StaticASTVisitor` if their handlers aren't public.
+template<class Derived, bool DEPTH_FIRST=false>
+class StaticASTVisitor : public StaticASTVisitorBase {
+  public:
+    bool visit(LSLASTNode *node) { return true; }
+    bool visit(LSLASTNullNode *node) { return false; }
+    bool visit(LSLASTNodeList<LSLASTNode> *node) { return true; };
+    bool visit(LSLScript *script) {
+      return self()->visit((LSLASTNode *) script);
+    };
+    bool visit(LSLIdentifier *id) {
+      return self()->visit((LSLASTNode *) id);
+    };
+    bool visit(LSLGlobalVariable *glob_var) {
+      return self()->visit((LSLASTNode *) glob_var);
+    };
+    bool visit(LSLConstant *constant) {
+      return self()->visit((LSLASTNode *) constant);
+    };
+    bool visit(LSLIntegerConstant *int_const) {
+      return self()->visit((LSLConstant *) int_const);
+    };
+    bool visit(LSLFloatConstant *float_const) {
+      return self()->visit((LSLConstant *) float_const);
+    };
+    bool visit(LSLStringConstant *str_const) {
+      return self()->visit((LSLConstant *) str_const);
+    };
+    bool visit(LSLKeyConstant *key_const) {
+      return self()->visit((LSLConstant *) key_const);
+    };
+    bool visit(LSLListConstant *list_const) {
+      return self()->visit((LSLConstant *) list_const);
+    };
+    bool visit(LSLVectorConstant *vec_const) {
+      return self()->visit((LSLConstant *) vec_const);
+    };
+    bool visit(LSLQuaternionConstant *quat_const) {
+      return self()->visit((LSLConstant *) quat_const);
+    };
+    bool visit(LSLGlobalFunction *glob_func) {
+      return self()->visit((LSLASTNode *) glob_func);
+    };
+    bool visit(LSLParamList *params) {
+      return self()->visit((LSLASTNodeList<LSLASTNode> *) params);
+    };
+    bool visit(LSLFunctionDec *func_dec) {
+      return self()->visit((LSLParamList *) func_dec);
+    };
+    bool visit(LSLEventDec *event_dec) {
+      return self()->visit((LSLParamList *) event_dec);
+    };
+    bool visit(LSLState *state) {
+      return self()->visit((LSLASTNode *) state);
+    };
+    bool visit(LSLEventHandler *handler) {
+      return self()->visit((LSLASTNode *) handler);
+    };
+    bool visit(LSLStatement *stmt) {
+      return self()->visit((LSLASTNode *) stmt);
+    };
+    bool visit(LSLCompoundStatement *compound_stmt) {
+      return self()->visit((LSLStatement *) compound_stmt);
+    };
+    bool visit(LSLNopStatement *nop_stmt) {
+      return self()->visit((LSLStatement *) nop_stmt);
+    };
+    bool visit(LSLExpressionStatement *expr_stmt) {
+      return self()->visit((LSLStatement *) expr_stmt);
+    };
+    bool visit(LSLStateStatement *state_stmt) {
+      return self()->visit((LSLStatement *) state_stmt);
+    };
+    bool visit(LSLJumpStatement *jump_stmt) {
+      return self()->visit((LSLStatement *) jump_stmt);
+    };
+    bool visit(LSLLabel *label_stmt) {
+      return self()->visit((LSLStatement *) label_stmt);
+    };
+    bool visit(LSLReturnStatement *ret_stmt) {
+      return self()->visit((LSLStatement *) ret_stmt);
+    };
+    bool visit(LSLIfStatement *if_stmt) {
+      return self()->visit((LSLStatement *) if_stmt);
+    };
+    bool visit(LSLForStatement *for_stmt) {
+      return self()->visit((LSLStatement *) for_stmt);
+    };
+    bool visit(LSLDoStatement *do_stmt) {
+      return self()->visit((LSLStatement *) do_stmt);
+    };
+    bool visit(LSLWhileStatement *while_stmt) {
+      return self()->visit((LSLStatement *) while_stmt);
+    };
+    bool visit(LSLDeclaration *decl_stmt) {
+      return self()->visit((LSLStatement *) decl_stmt);
+    };
+    bool visit(LSLExpression *expr) {
+      return self()->visit((LSLASTNode *) expr);
+    };
+    bool visit(LSLBinaryExpression *bin_expr) {
+      return self()->visit((LSLExpression *) bin_expr);
+    };
+    bool visit(LSLUnaryExpression *unary_expr) {
+      return self()->visit((LSLExpression *) unary_expr);
+    };
+    bool visit(LSLConstantExpression *constant_expr) {
+      return self()->visit((LSLExpression *) constant_expr);
+    };
+    bool visit(LSLParenthesisExpression *parens_expr) {
+      return self()->visit((LSLExpression *) parens_expr);
+    };
+    bool visit(LSLTypecastExpression *cast_expr) {
+      return self()->visit((LSLExpression *) cast_expr);
+    };
+    bool visit(LSLBoolConversionExpression *bool_expr) {
+      return self()->visit((LSLExpression *) bool_expr);
+    };
+    bool visit(LSLPrintExpression *print_expr) {
+      return self()->visit((LSLExpression *) print_expr);
+    };
+    bool visit(LSLFunctionExpression *func_expr) {
+      return self()->visit((LSLExpression *) func_expr);
+    };
+    bool visit(LSLVectorExpression *vec_expr) {
+      return self()->visit((LSLExpression *) vec_expr);
+    };
+    bool visit(LSLQuaternionExpression *quat_expr) {
+      return self()->visit((LSLExpression *) quat_expr);
+    };
+    bool visit(LSLListExpression *list_expr) {
+      return self()->visit((LSLExpression *) list_expr);
+    };
+    bool visit(LSLLValueExpression *lvalue) {
+      return self()->visit((LSLExpression *) lvalue);
+    };
+    bool visit(LSLType *node) {
+      return self()->visit((LSLASTNode*)node);
+    }
+
+    void visitNode(LSLASTNode *node) {
+      // same as LSLASTNode::visit(ASTVisitor*)
+      if (node->mContext && node->mContext->profiler)
+        ++node->mContext->counters.nodes_visited;
+      if (!DEPTH_FIRST) {
+        if (!self()->visitSpecific(node))
+          return;
+        visitChildren(node);
+      } else {
+        if (self()->beforeDescend(node))
+          visitChildren(node);
+        self()->visitSpecific(node);
+      }
+    }
+    bool visitSpecific(LSLASTNode *node) {
+      return dispatch_node_kind(node, [this](auto *specific_node) {
+        return self()->visit(specific_node);
+      });
+    }
+    void visitChildren(LSLASTNode *node) {
+      auto child_iter = node->begin();
+      auto end = node->end();
+
+      while (child_iter != end) {
+        auto *child = *child_iter;
+        // increment before visiting, we may swap this node's siblings!
+        ++child_iter;
+        assert(child != node);
+        assert(child);
+        visitNode(child);
+      }
+    }
+    // only used for depth-first visitors
+    bool beforeDescend(LSLASTNode *node) {return true;}
+    static constexpr bool isDepthFirst() {return DEPTH_FIRST;}
+
+  private:
+    Derived *self() { return static_cast<Derived *>(this); }
+};
+
 }
 
 #endif //TAILSLIDE_VISITOR_HH
@@ -1,9 +1,35 @@
-#include <iostream>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#ifndef _WIN32
+#include <cerrno>
+#include <csignal>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
 
 #include "cxxopt.hh"
 
 #include "tailslide.hh"
+#include "compile_cache.hh"
+#include "incremental.hh"
 #include "passes/pretty_print.hh"
 #include "passes/tree_print.hh"
 #include "passes/tree_simplifier.hh"
@@ -19,12 +45,997 @@ void version() {
 }
 
 
-int main(int argc, char **argv) {
-  FILE *yyin = nullptr;
+enum DiagnosticsFormat {
+  DIAGNOSTICS_TEXT,
+  DIAGNOSTICS_JSONL,
+  DIAGNOSTICS_SARIF,
+};
+
+struct CLIOptions {
   bool show_tree = false;
   bool pretty_print = true;
+  bool check_assertions = false;
+  bool mono_semantics = true;
+  // record pass timings for `--time-passes` or `--trace-file`
+  bool profile = false;
+  bool lso_compile = false;
+  bool mono_compile = false;
+  // only count warnings and errors rather than listing them
+  bool summary_only = false;
+  bool no_warnings = false;
+  // bit `code - W_WARNING` is set for every warning given to `--suppress`
+  uint64_t suppressed_warnings = 0;
+  DiagnosticsFormat diagnostics_format = DIAGNOSTICS_TEXT;
   OptimizationOptions optim_ctx {};
   PrettyPrintOpts pretty_opts {};
+  // only set if `--cache-dir` was
+  CompileCache *cache = nullptr;
+};
+
+// Run all the passes the options ask for over an already-parsed script
+static void process_script(ScopedScriptParser &parser, const CLIOptions &opts, CompileResult &output) {
+  Logger *logger = &parser.logger;
+  auto *script = parser.script;
+
+  // the lint passes run separately below, assertions need to be checked first.
+  script->analyze(opts.mono_semantics, false);
+
+  if (opts.check_assertions) {
+    logger->filterAssertErrors();
+    logger->setCheckAssertions(false);
+  }
+  // Don't try to optimize if we have a possibly broken tree
+  if (!logger->getErrors()) {
+    script->optimize(opts.optim_ctx);
+
+    // do these last since symbol usage and expressions may change
+    // when rewriting the tree
+    script->validateGlobals(opts.mono_semantics);
+    script->checkSymbols();
+    if (opts.pretty_print) {
+      ScopedPass pass(&parser.context, "pretty print");
+      parser.table_manager.setMangledNames();
+
+      PrettyPrintVisitor print_visitor(opts.pretty_opts);
+      script->visit(&print_visitor);
+      output.pretty = print_visitor.mStream.str();
+    }
+  } else {
+    script->validateGlobals(opts.mono_semantics);
+    script->checkSymbols();
+  }
+  if (opts.show_tree) {
+    TreePrintingVisitor visitor;
+    script->visit(&visitor);
+    output.tree = visitor.mStream.str();
+  }
+}
+
+// Flags that change how scripts are optimized and printed. Presets come last
+// so they override the individual flags.
+static const char * const OUTPUT_FLAGS[] = {
+    "mangle-globals", "mangle-locals", "mangle-funcs", "show-unmangled",
+    "fold-constants", "prune-globals", "prune-funcs", "prune-locals",
+    "O2", "O3", "obfuscate",
+};
+
+// Apply one of `OUTPUT_FLAGS`, returns false if it isn't one
+static bool apply_output_flag(CLIOptions &opts, const std::string &flag) {
+  OptimizationOptions &optim_ctx = opts.optim_ctx;
+  PrettyPrintOpts &pretty_opts = opts.pretty_opts;
+  if (flag == "mangle-globals") {
+    pretty_opts.mangle_global_names = true;
+  } else if (flag == "mangle-locals") {
+    pretty_opts.mangle_local_names = true;
+  } else if (flag == "mangle-funcs") {
+    pretty_opts.mangle_func_names = true;
+  } else if (flag == "show-unmangled") {
+    pretty_opts.show_unmangled = true;
+  } else if (flag == "fold-constants") {
+    optim_ctx.fold_constants = true;
+  } else if (flag == "prune-globals") {
+    optim_ctx.prune_unused_globals = true;
+  } else if (flag == "prune-funcs") {
+    optim_ctx.prune_unused_functions = true;
+  } else if (flag == "prune-locals") {
+    optim_ctx.prune_unused_locals = true;
+  } else if (flag == "O2") {
+    optim_ctx.prune_unused_globals = true;
+    optim_ctx.prune_unused_locals = true;
+    optim_ctx.prune_unused_functions = true;
+    optim_ctx.fold_constants = true;
+  } else if (flag == "O3") {
+    optim_ctx.prune_unused_globals = true;
+    optim_ctx.prune_unused_locals = true;
+    optim_ctx.prune_unused_functions = true;
+    optim_ctx.fold_constants = true;
+    // the length of global vars / functions and their params has an impact on bytecode size
+    pretty_opts.mangle_global_names = true;
+    pretty_opts.mangle_func_names = true;
+    pretty_opts.show_unmangled = true;
+  } else if (flag == "obfuscate") {
+    optim_ctx.prune_unused_globals = true;
+    optim_ctx.prune_unused_locals = true;
+    optim_ctx.prune_unused_functions = true;
+    optim_ctx.fold_constants = true;
+    pretty_opts.mangle_global_names = true;
+    pretty_opts.mangle_func_names = true;
+    pretty_opts.mangle_local_names = true;
+    pretty_opts.show_unmangled = false;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+static bool write_file(const std::string &dest, const char *data, size_t len) {
+  std::ofstream f(dest, std::ios::binary);
+  f.write(data, (std::streamsize) len);
+  f.close();
+  return !f.fail();
+}
+
+static bool read_file(const std::string &path, std::string &contents) {
+  std::ifstream f(path, std::ios::binary);
+  if (!f)
+    return false;
+  std::stringstream ss;
+  ss << f.rdbuf();
+  contents = ss.str();
+  return true;
+}
+
+static std::string compile_lso(ScopedScriptParser &parser) {
+  LSOScriptCompiler lso_visitor(&parser.allocator);
+  {
+    ScopedPass pass(&parser.context, "lso compile");
+    parser.script->visit(&lso_visitor);
+  }
+  return {(const char *) lso_visitor.mScriptBS.data(), lso_visitor.mScriptBS.size()};
+}
+
+static std::string compile_cil(ScopedScriptParser &parser) {
+  MonoScriptCompiler mono_visitor(&parser.allocator);
+  {
+    ScopedPass pass(&parser.context, "mono compile");
+    parser.script->visit(&mono_visitor);
+  }
+  return mono_visitor.mCIL.str();
+}
+
+// Anything in the options that changes the output but isn't part of an options struct
+static uint64_t get_cache_flags(const CLIOptions &opts) {
+  return (uint64_t)opts.show_tree
+      | (uint64_t)opts.pretty_print << 1
+      | (uint64_t)opts.check_assertions << 2
+      | (uint64_t)opts.mono_semantics << 3
+      | (uint64_t)opts.lso_compile << 4
+      | (uint64_t)opts.mono_compile << 5
+      | (uint64_t)opts.summary_only << 6
+      | (uint64_t)opts.no_warnings << 7
+      | opts.suppressed_warnings << 8
+      | (uint64_t)opts.diagnostics_format << 32;
+}
+
+// Filter out anything the options don't want before it gets logged
+static void setup_logger(Logger &logger, const CLIOptions &opts) {
+  logger.setCheckAssertions(opts.check_assertions);
+  // assertions need the messages to match against
+  logger.setStoreMessages(!opts.summary_only || opts.check_assertions);
+  logger.setMaxLevel(opts.no_warnings ? LOG_ERROR : LOG_DEBUG_SPAM);
+  for (int code = W_WARNING + 1; code < W_LAST; ++code)
+    logger.suppressCode((ErrorCode)code, (opts.suppressed_warnings >> (code - W_WARNING)) & 1);
+}
+
+// Parse a list of warning codes like "20009,E20010" into a bitmask for `CLIOptions`
+static bool parse_suppressed_warnings(const std::vector<std::string> &codes, uint64_t &mask) {
+  for (const auto &code_str : codes) {
+    const char *num_start = code_str.c_str();
+    if (*num_start == 'E' || *num_start == 'W')
+      ++num_start;
+    char *num_end = nullptr;
+    long code = strtol(num_start, &num_end, 10);
+    if (!*num_start || *num_end || code <= W_WARNING || code >= W_LAST) {
+      fprintf(stderr, "%s isn't a warning code\n", code_str.c_str());
+      return false;
+    }
+    mask |= (uint64_t)1 << (code - W_WARNING);
+  }
+  return true;
+}
+
+// Parse `source` and produce everything the options ask for, or pull it from the cache
+// if the same source was compiled with the same options before. Returns whether it was cached.
+static bool compile_source(ScopedScriptParser &parser, const CLIOptions &opts, const std::string &source,
+                           CompileResult &result) {
+  std::string key;
+  if (opts.cache) {
+    ScopedPass pass(&parser.context, "cache lookup");
+    key = CompileCache::makeKey(source, opts.optim_ctx, opts.pretty_opts, {}, get_cache_flags(opts));
+    if (opts.cache->lookup(key, result))
+      return true;
+  }
+
+  setup_logger(parser.logger, opts);
+  parser.parseLSLBytes(source.c_str(), (int)source.size());
+  result.parsed = parser.script != nullptr;
+  if (parser.script)
+    process_script(parser, opts, result);
+  if (result.parsed && !parser.logger.getErrors()) {
+    if (opts.lso_compile)
+      result.lso = compile_lso(parser);
+    else if (opts.mono_compile)
+      result.cil = compile_cil(parser);
+  }
+  // the compilers may complain too, like when the script is too big.
+  if (opts.diagnostics_format == DIAGNOSTICS_TEXT)
+    result.diagnostics = parser.logger.formatReport();
+  else
+    result.messages = parser.logger.getDiagnostics();
+  result.errors = parser.logger.getErrors();
+  result.warnings = parser.logger.getWarnings();
+
+  if (opts.cache) {
+    ScopedPass pass(&parser.context, "cache store");
+    opts.cache->store(key, result);
+  }
+  return false;
+}
+
+static const char *get_level_name(LogLevel level) {
+  switch (level) {
+    case LOG_ERROR: return "error";
+    case LOG_WARN: return "warning";
+    default: return "note";
+  }
+}
+
+// One JSON object per line for every message, `file` is left out if it's empty
+static std::string format_jsonl_diagnostics(const std::vector<Diagnostic> &messages, const std::string &file) {
+  std::string out;
+  std::string file_field;
+  if (!file.empty())
+    file_field = "\"file\": \"" + json_escape(file) + "\", ";
+  for (const auto &message : messages) {
+    char buf[160];
+    snprintf(buf, sizeof(buf),
+             "\"level\": \"%s\", \"code\": %d, \"line\": %d, \"column\": %d, \"end_line\": %d, \"end_column\": %d, ",
+             get_level_name(message.level), (int)message.code, message.loc.first_line, message.loc.first_column,
+             message.loc.last_line, message.loc.last_column);
+    out += "{" + file_field + buf + "\"message\": \"" + json_escape(message.message) + "\"}\n";
+  }
+  return out;
+}
+
+// Relative file paths are valid relative URIs once anything special is escaped
+static std::string path_to_uri(const std::string &path) {
+  std::string uri;
+  for (char c : path) {
+    if (c == '\\') {
+      uri += '/';
+    } else if (c == '%' || c == ' ' || c == '#' || c == '?' || (unsigned char)c < 0x20 || (unsigned char)c >= 0x7f) {
+      char buf[4];
+      snprintf(buf, sizeof(buf), "%%%02X", (unsigned char)c);
+      uri += buf;
+    } else {
+      uri += c;
+    }
+  }
+  return uri;
+}
+
+// Streams a SARIF 2.1.0 log with a single run, results are written as soon as they're added
+// so CI can start on them before everything's done. Call `finish()` to close it off.
+class SarifWriter {
+  public:
+    explicit SarifWriter(FILE *out) : _mOut(out) {
+      fputs("{\"version\": \"2.1.0\", \"$schema\": \"https://json.schemastore.org/sarif-2.1.0.json\", \"runs\": [{"
+            "\"tool\": {\"driver\": {\"name\": \"tailslide\", \"informationUri\": \"https://github.com/SaladDais/tailslide\"}}, "
+            "\"results\": [", _mOut);
+    }
+
+    void addResults(const std::string &file, const std::vector<Diagnostic> &messages) {
+      for (const auto &message : messages) {
+        char region[160];
+        snprintf(region, sizeof(region),
+                 "{\"startLine\": %d, \"startColumn\": %d, \"endLine\": %d, \"endColumn\": %d}",
+                 message.loc.first_line, message.loc.first_column, message.loc.last_line, message.loc.last_column);
+        fprintf(_mOut, "%s\n{\"ruleId\": \"E%d\", \"level\": \"%s\", \"message\": {\"text\": \"%s\"}",
+                _mNumResults++ ? "," : "", (int)message.code, get_level_name(message.level),
+                json_escape(message.message).c_str());
+        // messages without a location, like failed assertions, only get the file
+        fprintf(_mOut, ", \"locations\": [{\"physicalLocation\": {\"artifactLocation\": {\"uri\": \"%s\"}",
+                json_escape(path_to_uri(file)).c_str());
+        if (message.loc.first_line)
+          fprintf(_mOut, ", \"region\": %s", region);
+        fputs("}}]}", _mOut);
+      }
+      fflush(_mOut);
+    }
+
+    // `properties` is a JSON object summarizing the file
+    void addArtifact(const std::string &file, const std::string &properties) {
+      _mArtifacts.push_back(
+          "{\"location\": {\"uri\": \"" + json_escape(path_to_uri(file)) + "\"}, \"properties\": " + properties + "}"
+      );
+    }
+
+    // `properties` is a JSON object summarizing the whole run
+    void finish(bool successful, const std::string &properties) {
+      fputs("\n], \"artifacts\": [", _mOut);
+      for (size_t i = 0; i < _mArtifacts.size(); ++i)
+        fprintf(_mOut, "%s\n%s", i ? "," : "", _mArtifacts[i].c_str());
+      fprintf(_mOut, "\n], \"invocations\": [{\"executionSuccessful\": %s, \"properties\": %s}]}]}\n",
+              successful ? "true" : "false", properties.c_str());
+      fflush(_mOut);
+    }
+
+  private:
+    FILE *_mOut;
+    size_t _mNumResults = 0;
+    std::vector<std::string> _mArtifacts;
+};
+
+namespace fs = std::filesystem;
+
+struct BatchJob {
+  fs::path path;
+  // where outputs for this script go, relative to the output directories
+  fs::path rel_path;
+};
+
+struct BatchOptions {
+  unsigned int jobs = 1;
+  std::string output_dir;
+  std::string lso_dir;
+  std::string mono_dir;
+};
+
+struct BatchState {
+  std::vector<BatchJob> jobs;
+  std::atomic<size_t> next_job {0};
+  std::mutex output_mutex;
+  // one per worker thread, only used when profiling
+  std::vector<PassProfiler> profilers;
+  int failed = 0;
+  int errors = 0;
+  int warnings = 0;
+  // only set when writing diagnostics as SARIF
+  SarifWriter *sarif = nullptr;
+};
+
+// Write one of a script's outputs, making sure its directory exists. Runs on worker
+// threads, so failures are returned through `error` rather than thrown.
+static bool write_batch_output(const std::string &dir, const fs::path &rel_path, const char *ext,
+                               const char *data, size_t len, std::string &error) {
+  fs::path dest = fs::path(dir) / rel_path;
+  if (ext)
+    dest.replace_extension(ext);
+  std::error_code ec;
+  fs::create_directories(dest.parent_path(), ec);
+  if (ec) {
+    error = "couldn't create " + dest.parent_path().string() + ": " + ec.message();
+    return false;
+  }
+  if (!write_file(dest.string(), data, len)) {
+    error = "couldn't write " + dest.string();
+    return false;
+  }
+  return true;
+}
+
+static void batch_worker(BatchState &state, const CLIOptions &opts, const BatchOptions &batch_opts,
+                         PassProfiler *profiler) {
+  // each thread keeps its own parser, its memory gets re-used from script to script
+  ScopedScriptParser parser(nullptr);
+  parser.context.profiler = profiler;
+  size_t job_idx;
+  while ((job_idx = state.next_job++) < state.jobs.size()) {
+    auto &job = state.jobs[job_idx];
+    auto start_time = std::chrono::steady_clock::now();
+    CompileResult output;
+    std::string source;
+    bool cached = false;
+
+    parser.reset();
+    if (profiler)
+      profiler->setScriptName(job.path.string());
+    bool opened = read_file(job.path.string(), source);
+    if (opened)
+      cached = compile_source(parser, opts, source, output);
+    int errors = output.errors;
+    int warnings = output.warnings;
+    bool ok = opened && output.parsed && !errors;
+
+    // the first output that couldn't be written, if any
+    std::string write_error;
+    if (ok && !output.pretty.empty() && !batch_opts.output_dir.empty()) {
+      output.pretty += "\n";
+      write_batch_output(batch_opts.output_dir, job.rel_path, nullptr,
+                         output.pretty.c_str(), output.pretty.size(), write_error);
+    }
+    // only empty if compilation didn't happen
+    if (write_error.empty() && !output.lso.empty())
+      write_batch_output(batch_opts.lso_dir, job.rel_path, ".lso", output.lso.data(), output.lso.size(), write_error);
+    else if (write_error.empty() && !output.cil.empty())
+      write_batch_output(batch_opts.mono_dir, job.rel_path, ".cil", output.cil.data(), output.cil.size(), write_error);
+    if (write_error.empty() && !output.tree.empty() && !batch_opts.output_dir.empty()) {
+      write_batch_output(batch_opts.output_dir, job.rel_path, ".tree",
+                         output.tree.c_str(), output.tree.size(), write_error);
+    }
+    if (!write_error.empty())
+      ok = false;
+
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start_time;
+
+    std::lock_guard<std::mutex> lock(state.output_mutex);
+    if (!ok)
+      ++state.failed;
+    state.errors += errors;
+    state.warnings += warnings;
+    if (opts.diagnostics_format == DIAGNOSTICS_TEXT)
+      fprintf(stderr, "%s:\n", job.path.string().c_str());
+    if (!opened)
+      fprintf(stderr, "couldn't open %s\n", job.path.string().c_str());
+    else if (opts.diagnostics_format == DIAGNOSTICS_TEXT)
+      fputs(output.diagnostics.c_str(), stderr);
+    else if (opts.diagnostics_format == DIAGNOSTICS_JSONL)
+      fputs(format_jsonl_diagnostics(output.messages, job.path.string()).c_str(), stdout);
+    if (!write_error.empty() && opts.diagnostics_format == DIAGNOSTICS_TEXT)
+      fprintf(stderr, "%s\n", write_error.c_str());
+
+    char summary[160];
+    snprintf(summary, sizeof(summary),
+             "\"ok\": %s, \"errors\": %d, \"warnings\": %d, \"cached\": %s, \"ms\": %.3f",
+             ok ? "true" : "false", errors, warnings, cached ? "true" : "false", elapsed.count());
+    std::string properties = summary;
+    if (!write_error.empty())
+      properties += ", \"write_error\": \"" + json_escape(write_error) + "\"";
+    properties += "}";
+    if (state.sarif) {
+      state.sarif->addResults(job.path.string(), output.messages);
+      state.sarif->addArtifact(job.path.string(), "{" + properties);
+    } else {
+      printf("{\"file\": \"%s\", %s\n", json_escape(job.path.string()).c_str(), properties.c_str());
+    }
+  }
+}
+
+// Expand directories and manifests into the list of scripts to process
+static bool collect_batch_jobs(const std::vector<std::string> &inputs, const std::string &manifest,
+                               std::vector<BatchJob> &jobs) {
+  std::vector<std::string> paths = inputs;
+  if (!manifest.empty()) {
+    std::ifstream f(manifest);
+    if (!f) {
+      fprintf(stderr, "couldn't open %s\n", manifest.c_str());
+      return false;
+    }
+    std::string line;
+    while (std::getline(f, line)) {
+      if (!line.empty() && line.back() == '\r')
+        line.pop_back();
+      if (!line.empty())
+        paths.emplace_back(line);
+    }
+  }
+
+  for (auto &path_str : paths) {
+    fs::path path(path_str);
+    std::error_code ec;
+    if (fs::is_directory(path, ec)) {
+      std::vector<BatchJob> dir_jobs;
+      for (auto &entry : fs::recursive_directory_iterator(path, ec)) {
+        if (entry.is_regular_file() && entry.path().extension() == ".lsl")
+          dir_jobs.push_back({entry.path(), fs::relative(entry.path(), path)});
+      }
+      // directory iteration order is unspecified, keep the summary stable.
+      std::sort(dir_jobs.begin(), dir_jobs.end(), [](const BatchJob &a, const BatchJob &b) {
+        return a.path < b.path;
+      });
+      jobs.insert(jobs.end(), dir_jobs.begin(), dir_jobs.end());
+    } else {
+      jobs.push_back({path, path.filename()});
+    }
+  }
+  return true;
+}
+
+// Make sure no two scripts would write their outputs to the same place,
+// like with `a/foo.lsl b/foo.lsl` or two directories with the same layout.
+static bool check_batch_output_paths(const std::vector<BatchJob> &jobs) {
+  // outputs may replace the extension, so `foo.lsl` and `foo.txt` collide too.
+  std::unordered_map<fs::path::string_type, const BatchJob *> seen;
+  for (auto &job : jobs) {
+    auto inserted = seen.emplace(fs::path(job.rel_path).replace_extension().native(), &job);
+    if (!inserted.second) {
+      fprintf(stderr, "%s and %s would both be written to %s, process them separately\n",
+              inserted.first->second->path.string().c_str(), job.path.string().c_str(),
+              job.rel_path.string().c_str());
+      return false;
+    }
+  }
+  return true;
+}
+
+static int run_batch(const std::vector<std::string> &inputs, const std::string &manifest,
+                     const CLIOptions &opts, BatchOptions batch_opts, PassProfiler &profiler_out) {
+  BatchState state;
+  if (!collect_batch_jobs(inputs, manifest, state.jobs))
+    return 1;
+  bool writes_outputs = !batch_opts.output_dir.empty() || !batch_opts.lso_dir.empty() || !batch_opts.mono_dir.empty();
+  if (writes_outputs && !check_batch_output_paths(state.jobs))
+    return 1;
+
+  std::unique_ptr<SarifWriter> sarif;
+  if (opts.diagnostics_format == DIAGNOSTICS_SARIF) {
+    sarif = std::make_unique<SarifWriter>(stdout);
+    state.sarif = sarif.get();
+  }
+
+  auto start_time = std::chrono::steady_clock::now();
+  if (batch_opts.jobs == 0)
+    batch_opts.jobs = std::max(1u, std::thread::hardware_concurrency());
+  batch_opts.jobs = std::min<size_t>(batch_opts.jobs, std::max<size_t>(1, state.jobs.size()));
+
+  if (opts.profile) {
+    for (unsigned int i = 0; i < batch_opts.jobs; ++i)
+      state.profilers.emplace_back(i);
+  }
+  std::vector<std::thread> threads;
+  for (unsigned int i = 0; i < batch_opts.jobs; ++i) {
+    PassProfiler *profiler = opts.profile ? &state.profilers[i] : nullptr;
+    threads.emplace_back(batch_worker, std::ref(state), std::cref(opts), std::cref(batch_opts), profiler);
+  }
+  for (auto &thread : threads)
+    thread.join();
+  for (auto &profiler : state.profilers)
+    profiler_out.merge(profiler);
+
+  std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start_time;
+  char summary[256];
+  snprintf(summary, sizeof(summary),
+      "{\"files\": %zu, \"failed\": %d, \"errors\": %d, \"warnings\": %d, \"cache_hits\": %llu, \"jobs\": %u, \"ms\": %.3f}",
+      state.jobs.size(), state.failed, state.errors, state.warnings,
+      opts.cache ? (unsigned long long)opts.cache->getHits() : 0ULL, batch_opts.jobs, elapsed.count()
+  );
+  if (sarif)
+    sarif->finish(state.failed == 0, summary);
+  else
+    printf("%s\n", summary);
+  return state.failed != 0;
+}
+
+/*
+ * Server mode keeps builtins and a parser per worker thread warm between requests.
+ * Requests and responses are framed as a header line followed by a payload of
+ * exactly `length` bytes.
+ *
+ * Request:  <id> <command> [<flag>...] <length>\n<script source>
+ * Response: <id> <kind> <length>\n<payload>
+ *
+ * `command` is one of lint, pretty, lso or cil. Flags are any of `OUTPUT_FLAGS`,
+ * "show-tree" or "check-asserts". They add to whatever was given on the command line.
+ * Requests are processed concurrently, so responses to different requests may be
+ * interleaved. Each request gets a frame for every output it produced, like
+ * "diagnostics", "pretty", "tree", "lso" or "cil", and then a "done" frame with a
+ * JSON summary. Malformed requests get an "error" frame instead. With
+ * `--diagnostics-format jsonl` "diagnostics" frames hold one JSON object per message.
+ *
+ * Editors can also keep documents open on a connection and send just their edits,
+ * only the parts of the script that changed get re-analyzed:
+ *
+ *   <id> open <doc> <length>\n<script source>
+ *   <id> edit <doc> <offset> <removed> <length>\n<replacement text>
+ *   <id> close <doc> 0\n
+ *
+ * `offset` and `removed` are in bytes. open and edit respond like lint does, and
+ * document requests are handled in the order they're received. Documents use the
+ * warning filters and semantics given on the command line, and can't be opened when
+ * it asks for assertions to be checked.
+ */
+
+// don't let a bogus length make us allocate all the memory in the world
+static const size_t MAX_REQUEST_SIZE = 64 * 1024 * 1024;
+
+class ServerConnection {
+  public:
+    ServerConnection(FILE *in, FILE *out, bool owned) : _mIn(in), _mOut(out), _mOwned(owned) {}
+    ~ServerConnection() {
+      if (_mOwned) {
+        fclose(_mIn);
+        fclose(_mOut);
+      }
+    }
+
+    // Read a header line, false on EOF
+    bool readLine(std::string &line) {
+      line.clear();
+      int c;
+      while ((c = fgetc(_mIn)) != EOF) {
+        if (c == '\n')
+          return true;
+        line += (char)c;
+        // nobody has a reason to send headers this long
+        if (line.size() > 4096)
+          return false;
+      }
+      return false;
+    }
+
+    bool readPayload(std::string &payload, size_t len) {
+      payload.resize(len);
+      return fread(&payload[0], 1, len, _mIn) == len;
+    }
+
+    // Safe to call from any thread, frames are never interleaved with each other
+    void writeFrame(const std::string &id, const char *kind, const std::string &payload) {
+      std::lock_guard<std::mutex> lock(_mWriteMutex);
+      fprintf(_mOut, "%s %s %zu\n", id.c_str(), kind, payload.size());
+      fwrite(payload.data(), 1, payload.size(), _mOut);
+      fflush(_mOut);
+    }
+
+#ifndef _WIN32
+    // Make anything reading from the connection see EOF, even if it's blocked in a read
+    void stopReading() {
+      shutdown(fileno(_mIn), SHUT_RD);
+    }
+#endif
+
+  private:
+    FILE *_mIn;
+    FILE *_mOut;
+    // stdin and stdout aren't ours to close
+    bool _mOwned;
+    std::mutex _mWriteMutex;
+};
+
+struct ServerJob {
+  std::shared_ptr<ServerConnection> conn;
+  std::string id;
+  CLIOptions opts;
+  std::string source;
+};
+
+struct ServerState {
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::deque<ServerJob> queue;
+  // set once no more jobs will be queued
+  bool stopping = false;
+};
+
+static void server_worker(ServerState &state) {
+  ScopedScriptParser parser(nullptr);
+  for (;;) {
+    ServerJob job;
+    {
+      std::unique_lock<std::mutex> lock(state.mutex);
+      state.cv.wait(lock, [&state] { return state.stopping || !state.queue.empty(); });
+      if (state.queue.empty())
+        return;
+      job = std::move(state.queue.front());
+      state.queue.pop_front();
+    }
+
+    auto start_time = std::chrono::steady_clock::now();
+    CompileResult output;
+    parser.reset();
+    bool cached = compile_source(parser, job.opts, job.source, output);
+    bool ok = output.parsed && !output.errors;
+
+    auto &conn = *job.conn;
+    if (job.opts.diagnostics_format == DIAGNOSTICS_JSONL && !output.messages.empty())
+      conn.writeFrame(job.id, "diagnostics", format_jsonl_diagnostics(output.messages, ""));
+    else if (!output.diagnostics.empty())
+      conn.writeFrame(job.id, "diagnostics", output.diagnostics);
+    if (ok && !output.pretty.empty())
+      conn.writeFrame(job.id, "pretty", output.pretty);
+    if (!output.tree.empty())
+      conn.writeFrame(job.id, "tree", output.tree);
+    if (!output.lso.empty())
+      conn.writeFrame(job.id, "lso", output.lso);
+    else if (!output.cil.empty())
+      conn.writeFrame(job.id, "cil", output.cil);
+
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start_time;
+    char summary[160];
+    snprintf(summary, sizeof(summary),
+             "{\"ok\": %s, \"errors\": %d, \"warnings\": %d, \"cached\": %s, \"ms\": %.3f}",
+             ok ? "true" : "false", output.errors, output.warnings,
+             cached ? "true" : "false", elapsed.count());
+    conn.writeFrame(job.id, "done", summary);
+  }
+}
+
+// Set up `opts` for a request's command and flags, returns an error message if they're bad
+static std::string parse_server_request(const std::vector<std::string> &words, CLIOptions &opts) {
+  const std::string &command = words[1];
+  opts.mono_semantics = true;
+  opts.lso_compile = false;
+  opts.mono_compile = false;
+  opts.pretty_print = false;
+  if (command == "pretty") {
+    opts.pretty_print = true;
+  } else if (command == "lso") {
+    opts.mono_semantics = false;
+    opts.lso_compile = true;
+  } else if (command == "cil") {
+    opts.mono_compile = true;
+  } else if (command != "lint") {
+    return "unknown command " + command;
+  }
+
+  for (size_t i = 2; i < words.size() - 1; ++i) {
+    std::string flag = words[i];
+    // allow flags to be written the same way as on the command line
+    if (flag.compare(0, 2, "--") == 0)
+      flag = flag.substr(2);
+    if (flag == "show-tree")
+      opts.show_tree = true;
+    else if (flag == "check-asserts")
+      opts.check_assertions = true;
+    else if (!apply_output_flag(opts, flag))
+      return "unknown flag " + flag;
+  }
+  return "";
+}
+
+using DocumentMap = std::unordered_map<std::string, std::unique_ptr<IncrementalScript>>;
+
+static bool parse_size(const std::string &str, size_t &val) {
+  char *end = nullptr;
+  unsigned long long parsed = strtoull(str.c_str(), &end, 10);
+  if (str.empty() || *end)
+    return false;
+  val = (size_t)parsed;
+  return true;
+}
+
+// Open, edit or close a document, responding immediately rather than going through the queue.
+// Returns false if `words` wasn't a document request.
+static bool handle_document_request(ServerConnection &conn, DocumentMap &docs, const CLIOptions &opts,
+                                    const std::vector<std::string> &words, std::string &payload) {
+  const std::string &id = words[0];
+  const std::string &command = words[1];
+  if (command != "open" && command != "edit" && command != "close")
+    return false;
+  if (words.size() != (command == "edit" ? 6 : 4)) {
+    conn.writeFrame(id, "error", "wrong number of arguments for " + command);
+    return true;
+  }
+
+  auto start_time = std::chrono::steady_clock::now();
+  const std::string &doc_name = words[2];
+  if (command == "close") {
+    docs.erase(doc_name);
+    conn.writeFrame(id, "done", "{\"ok\": true}");
+    return true;
+  }
+
+  // assertions are checked against the whole script's messages, edits only redo some of them.
+  if (opts.check_assertions) {
+    conn.writeFrame(id, "error", "documents can't check assertions");
+    return true;
+  }
+
+  IncrementalScript *doc;
+  if (command == "open") {
+    auto &slot = docs[doc_name];
+    slot = std::make_unique<IncrementalScript>(opts.mono_semantics);
+    doc = slot.get();
+    setup_logger(doc->getLogger(), opts);
+    // edits drop and shift earlier messages, so they have to be kept even with `--summary-only`.
+    doc->getLogger().setStoreMessages(true);
+    doc->setSource(std::move(payload));
+  } else {
+    auto doc_iter = docs.find(doc_name);
+    size_t offset, removed;
+    if (doc_iter == docs.end()) {
+      conn.writeFrame(id, "error", "no open document " + doc_name);
+      return true;
+    }
+    doc = doc_iter->second.get();
+    if (!parse_size(words[3], offset) || !parse_size(words[4], removed) || !doc->applyEdit(offset, removed, payload)) {
+      conn.writeFrame(id, "error", "bad edit range");
+      return true;
+    }
+  }
+
+  Logger &logger = doc->getLogger();
+  if (opts.summary_only)
+    conn.writeFrame(id, "diagnostics", "TOTAL:: Errors: " + std::to_string(logger.getErrors())
+                    + "  Warnings: " + std::to_string(logger.getWarnings()) + "\n");
+  else if (opts.diagnostics_format == DIAGNOSTICS_JSONL)
+    conn.writeFrame(id, "diagnostics", format_jsonl_diagnostics(logger.getDiagnostics(), ""));
+  else
+    conn.writeFrame(id, "diagnostics", logger.formatReport());
+  std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start_time;
+  char summary[160];
+  snprintf(summary, sizeof(summary),
+           "{\"ok\": %s, \"errors\": %d, \"warnings\": %d, \"incremental\": %s, \"ms\": %.3f}",
+           (doc->getScript() && !logger.getErrors()) ? "true" : "false", logger.getErrors(), logger.getWarnings(),
+           doc->wasIncremental() ? "true" : "false", elapsed.count());
+  conn.writeFrame(id, "done", summary);
+  return true;
+}
+
+// Queue up requests from `conn` until it's closed or sends something we can't make sense of
+static void server_read_requests(ServerState &state, const std::shared_ptr<ServerConnection> &conn,
+                                 const CLIOptions &base_opts) {
+  // documents only make sense to the connection that opened them
+  DocumentMap docs;
+  std::string line;
+  while (conn->readLine(line)) {
+    std::vector<std::string> words;
+    std::istringstream ss(line);
+    std::string word;
+    while (ss >> word)
+      words.push_back(word);
+    if (words.empty())
+      continue;
+
+    char *len_end = nullptr;
+    unsigned long long len = 0;
+    if (words.size() >= 3)
+      len = strtoull(words.back().c_str(), &len_end, 10);
+    if (!len_end || *len_end || len > MAX_REQUEST_SIZE) {
+      // we can't tell where the next request starts, give up on this connection.
+      conn->writeFrame(words[0], "error", "malformed request header");
+      return;
+    }
+
+    ServerJob job {conn, words[0], base_opts, {}};
+    if (!conn->readPayload(job.source, (size_t)len))
+      return;
+    if (handle_document_request(*conn, docs, base_opts, words, job.source))
+      continue;
+    std::string error = parse_server_request(words, job.opts);
+    if (!error.empty()) {
+      conn->writeFrame(job.id, "error", error);
+      continue;
+    }
+    {
+      std::lock_guard<std::mutex> lock(state.mutex);
+      state.queue.push_back(std::move(job));
+    }
+    state.cv.notify_one();
+  }
+}
+
+#ifndef _WIN32
+// A thread reading requests from one socket connection
+struct ServerReader {
+  std::thread thread;
+  // only alive while someone's still using the connection
+  std::weak_ptr<ServerConnection> conn;
+  std::atomic<bool> done {false};
+};
+
+// Accept connections on a Unix domain socket at `path` forever
+static int serve_socket(ServerState &state, const std::string &path, const CLIOptions &opts) {
+  sockaddr_un addr {};
+  addr.sun_family = AF_UNIX;
+  if (path.size() >= sizeof(addr.sun_path)) {
+    fprintf(stderr, "socket path %s is too long\n", path.c_str());
+    return 1;
+  }
+  strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) - 1);
+
+  int listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (listen_fd < 0) {
+    perror("socket");
+    return 1;
+  }
+  // probably left behind by an earlier server
+  unlink(path.c_str());
+  if (bind(listen_fd, (sockaddr *)&addr, sizeof(addr)) < 0 || listen(listen_fd, 16) < 0) {
+    perror(path.c_str());
+    close(listen_fd);
+    return 1;
+  }
+  // clients hanging up on us shouldn't take the server down with them
+  signal(SIGPIPE, SIG_IGN);
+
+  // Readers refer to `state` and `opts`, so they all have to be joined before we return
+  std::list<ServerReader> readers;
+  for (;;) {
+    int fd = accept(listen_fd, nullptr, nullptr);
+    if (fd < 0) {
+      if (errno == EINTR)
+        continue;
+      perror("accept");
+      break;
+    }
+    int out_fd = dup(fd);
+    FILE *in = fdopen(fd, "rb");
+    FILE *out = out_fd >= 0 ? fdopen(out_fd, "wb") : nullptr;
+    if (!in || !out) {
+      in ? fclose(in) : close(fd);
+      if (out_fd >= 0)
+        out ? fclose(out) : close(out_fd);
+      continue;
+    }
+    // clean up after connections that have already been closed
+    for (auto reader_iter = readers.begin(); reader_iter != readers.end();) {
+      if (reader_iter->done) {
+        reader_iter->thread.join();
+        reader_iter = readers.erase(reader_iter);
+      } else {
+        ++reader_iter;
+      }
+    }
+
+    auto conn = std::make_shared<ServerConnection>(in, out, true);
+    auto &reader = readers.emplace_back();
+    reader.conn = conn;
+    reader.thread = std::thread([&state, &opts, &reader, conn] {
+      server_read_requests(state, conn, opts);
+      reader.done = true;
+    });
+  }
+  for (auto &reader : readers) {
+    if (auto conn = reader.conn.lock())
+      conn->stopReading();
+  }
+  for (auto &reader : readers)
+    reader.thread.join();
+  close(listen_fd);
+  unlink(path.c_str());
+  return 1;
+}
+#endif
+
+// Serve requests from stdin, or from `socket_path` if it isn't empty
+static int run_server(const std::string &socket_path, const CLIOptions &opts, unsigned int jobs) {
+  ServerState state;
+  if (jobs == 0)
+    jobs = std::max(1u, std::thread::hardware_concurrency());
+  std::vector<std::thread> threads;
+  for (unsigned int i = 0; i < jobs; ++i)
+    threads.emplace_back(server_worker, std::ref(state));
+
+  int ret = 0;
+  if (socket_path.empty()) {
+    auto conn = std::make_shared<ServerConnection>(stdin, stdout, false);
+    server_read_requests(state, conn, opts);
+  } else {
+#ifndef _WIN32
+    ret = serve_socket(state, socket_path, opts);
+#else
+    fprintf(stderr, "--socket isn't supported on this platform\n");
+    ret = 1;
+#endif
+  }
+
+  // finish up anything that's still queued
+  {
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.stopping = true;
+  }
+  state.cv.notify_all();
+  for (auto &thread : threads)
+    thread.join();
+  return ret;
+}
+
+static void write_profile(const PassProfiler &profiler, bool time_passes, const std::string &trace_file) {
+  if (time_passes)
+    profiler.writeSummary(stderr);
+  if (!trace_file.empty()) {
+    std::ofstream f(trace_file);
+    if (!f) {
+      fprintf(stderr, "couldn't open %s\n", trace_file.c_str());
+      return;
+    }
+    profiler.writeTrace(f);
+  }
+}
+
+
+int main(int argc, char **argv) {
+  CLIOptions opts {};
 
   cxxopts::Options options("tailslide", "");
 
@@ -54,16 +1065,46 @@ int main(int argc, char **argv) {
       ("check-asserts", "check assert comments and suppress errors based on matches")
   ;
 
+  options.add_options("Diagnostics")
+      ("no-warnings", "Only report errors")
+      ("suppress", "Don't report these warnings, like --suppress 20009,20010", cxxopts::value<std::vector<std::string>>())
+      ("summary-only", "Only report the number of errors and warnings, not the messages themselves")
+      ("diagnostics-format", "How to write errors and warnings: text (to stderr), jsonl (one JSON object per message) or sarif. "
+                             "jsonl and sarif always go to stdout, a pretty-printed script or tree goes to stderr instead",
+                             cxxopts::value<std::string>()->default_value("text"))
+  ;
+
   options.add_options("Compilation")
-      ("lso-compile", "Compile to LSO and write to file", cxxopts::value<std::string>())
-      ("mono-compile", "Compile to Mono CIL and write to file", cxxopts::value<std::string>())
+      ("lso-compile", "Compile to LSO and write to file (or directory in batch mode)", cxxopts::value<std::string>())
+      ("mono-compile", "Compile to Mono CIL and write to file (or directory in batch mode)", cxxopts::value<std::string>())
+  ;
+
+  options.add_options("Batch")
+      ("manifest", "Process every script listed in this file, one path per line", cxxopts::value<std::string>())
+      ("j,jobs", "Number of scripts to process in parallel in batch or server mode, defaults to one per core", cxxopts::value<unsigned int>())
+      ("output-dir", "Write pretty-printed scripts to this directory in batch mode", cxxopts::value<std::string>())
+  ;
+
+  options.add_options("Server")
+      ("serve", "Keep running and compile scripts sent over stdin, see the protocol in main.cc")
+      ("socket", "Like --serve, but listen on a Unix domain socket at this path", cxxopts::value<std::string>())
+  ;
+
+  options.add_options("Caching")
+      ("cache-dir", "Reuse results from earlier runs with identical scripts and options, kept in this directory", cxxopts::value<std::string>())
+      ("cache-size", "Maximum size of the cache in MiB", cxxopts::value<uint64_t>()->default_value("1024"))
+  ;
+
+  options.add_options("Profiling")
+      ("time-passes", "Print how long each pass took and how much work it did")
+      ("trace-file", "Write pass timings as Chrome trace-event JSON to this file", cxxopts::value<std::string>())
   ;
 
   options.add_options()
-      ("script", "Input script's filename", cxxopts::value<std::string>())
+      ("script", "Input scripts' filenames or directories", cxxopts::value<std::vector<std::string>>())
   ;
   options.parse_positional({"script"});
-  options.positional_help("<script>");
+  options.positional_help("<script>...");
 
   cxxopts::ParseResult vm;
   try {
@@ -85,129 +1126,151 @@ int main(int argc, char **argv) {
     return 0;
   }
 
-  if (vm.count("script")) {
-    std::string filename = vm["script"].as<std::string>();
-    yyin = fopen(filename.c_str(), "r");
-    if (yyin == nullptr) {
-      fprintf(stderr, "couldn't open %s\n", filename.c_str());
+  std::vector<std::string> scripts;
+  if (vm.count("script"))
+    scripts = vm["script"].as<std::vector<std::string>>();
+  std::string manifest;
+  if (vm.count("manifest"))
+    manifest = vm["manifest"].as<std::string>();
+  // Several scripts, a directory of scripts or a manifest means batch mode,
+  // per-script output goes to files instead of stdout.
+  std::error_code ec;
+  std::string socket_path;
+  if (vm.count("socket"))
+    socket_path = vm["socket"].as<std::string>();
+  bool serve = vm.count("serve") || !socket_path.empty();
+  bool batch = !serve && (!manifest.empty() || scripts.size() > 1
+      || (scripts.size() == 1 && std::filesystem::is_directory(scripts[0], ec)));
+
+  std::string source;
+  if (!batch && !serve) {
+    if (scripts.empty()) {
+      std::stringstream ss;
+      ss << std::cin.rdbuf();
+      source = ss.str();
+    } else if (!read_file(scripts[0], source)) {
+      fprintf(stderr, "couldn't open %s\n", scripts[0].c_str());
       return 1;
     }
   }
 
-  bool check_assertions = vm.count("check-asserts");
+  opts.check_assertions = vm.count("check-asserts");
+  opts.summary_only = vm.count("summary-only") != 0;
+  std::string diagnostics_format = vm["diagnostics-format"].as<std::string>();
+  if (diagnostics_format == "jsonl") {
+    opts.diagnostics_format = DIAGNOSTICS_JSONL;
+  } else if (diagnostics_format == "sarif") {
+    opts.diagnostics_format = DIAGNOSTICS_SARIF;
+  } else if (diagnostics_format != "text") {
+    fprintf(stderr, "unknown diagnostics format %s\n", diagnostics_format.c_str());
+    return 1;
+  }
+  opts.no_warnings = vm.count("no-warnings") != 0;
+  if (vm.count("suppress") && !parse_suppressed_warnings(vm["suppress"].as<std::vector<std::string>>(), opts.suppressed_warnings))
+    return 1;
   if (vm.count("show-tree"))
-    show_tree = true;
+    opts.show_tree = true;
   if (vm.count("lint")) {
-    pretty_print = false;
+    opts.pretty_print = false;
   } else {
-
-    pretty_opts.mangle_global_names = vm.count("mangle-globals") != 0;
-    pretty_opts.mangle_local_names = vm.count("mangle-locals") != 0;
-    pretty_opts.mangle_func_names = vm.count("mangle-funcs") != 0;
-    pretty_opts.show_unmangled = vm.count("show-unmangled") != 0;
-    optim_ctx.fold_constants = vm.count("fold-constants") != 0;
-    optim_ctx.prune_unused_globals = vm.count("prune-globals") != 0;
-    optim_ctx.prune_unused_functions = vm.count("prune-funcs") != 0;
-    optim_ctx.prune_unused_locals = vm.count("prune-locals") != 0;
-
-    if (vm.count("O2")) {
-      optim_ctx.prune_unused_globals = true;
-      optim_ctx.prune_unused_locals = true;
-      optim_ctx.prune_unused_functions = true;
-      optim_ctx.fold_constants = true;
-    }
-    if (vm.count("O3")) {
-      optim_ctx.prune_unused_globals = true;
-      optim_ctx.prune_unused_locals = true;
-      optim_ctx.prune_unused_functions = true;
-      optim_ctx.fold_constants = true;
-      // the length of global vars / functions and their params has an impact on bytecode size
-      pretty_opts.mangle_global_names = true;
-      pretty_opts.mangle_func_names = true;
-      pretty_opts.show_unmangled = true;
-    }
-    if (vm.count("obfuscate")) {
-      optim_ctx.prune_unused_globals = true;
-      optim_ctx.prune_unused_locals = true;
-      optim_ctx.prune_unused_functions = true;
-      optim_ctx.fold_constants = true;
-      pretty_opts.mangle_global_names = true;
-      pretty_opts.mangle_func_names = true;
-      pretty_opts.mangle_local_names = true;
-      pretty_opts.show_unmangled = false;
+    for (const char *flag : OUTPUT_FLAGS) {
+      if (vm.count(flag))
+        apply_output_flag(opts, flag);
     }
   }
+  opts.mono_semantics = !vm.count("lso-compile");
+  opts.lso_compile = vm.count("lso-compile") != 0;
+  opts.mono_compile = !opts.lso_compile && vm.count("mono-compile");
+  bool time_passes = vm.count("time-passes") != 0;
+  std::string trace_file;
+  if (vm.count("trace-file"))
+    trace_file = vm["trace-file"].as<std::string>();
+  opts.profile = time_passes || !trace_file.empty();
+  PassProfiler profiler;
   tailslide_init_builtins(nullptr);
-  // set up the allocator and logger
-  ScopedScriptParser parser(nullptr);
-  Logger *logger = &parser.logger;
-  bool mono_semantics = !vm.count("lso-compile");
-
-  if (check_assertions)
-    logger->setCheckAssertions(true);
-
-  auto script = parser.parseLSLFile(yyin);
-  if (yyin != nullptr)
-    fclose(yyin);
-
-  if (script) {
-    script->collectSymbols();
-    script->determineTypes();
-    script->recalculateReferenceData();
-    script->propagateValues();
-    script->finalPass();
-
-    if (check_assertions) {
-      logger->filterAssertErrors();
-      logger->setCheckAssertions(false);
-    }
-    // Don't try to optimize if we have a possibly broken tree
-    if (!logger->getErrors()) {
-      script->optimize(optim_ctx);
-
-      // do these last since symbol usage and expressions may change
-      // when rewriting the tree
-      script->validateGlobals(mono_semantics);
-      script->checkSymbols();
-      if (pretty_print) {
-        parser.table_manager.setMangledNames();
-
-        PrettyPrintVisitor print_visitor(pretty_opts);
-        script->visit(&print_visitor);
-        std::cout << print_visitor.mStream.str() << "\n";
-      }
-    } else {
-      script->validateGlobals(mono_semantics);
-      script->checkSymbols();
-    }
-    logger->printReport();
-    if (show_tree) {
-      std::cout << "Tree:" << std::endl;
-      TreePrintingVisitor visitor;
-      script->visit(&visitor);
-      std::cout << visitor.mStream.str();
+
+  std::unique_ptr<CompileCache> cache;
+  if (vm.count("cache-dir")) {
+    uint64_t cache_size = vm["cache-size"].as<uint64_t>();
+    cache = std::make_unique<CompileCache>(vm["cache-dir"].as<std::string>(), cache_size * 1024 * 1024);
+    opts.cache = cache.get();
+  }
+
+  if (serve) {
+    // a response is a stream of frames, there's nowhere to put the rest of a SARIF log.
+    if (opts.diagnostics_format == DIAGNOSTICS_SARIF) {
+      fprintf(stderr, "server mode can't write SARIF, use jsonl\n");
+      return 1;
     }
-  } else {
-    logger->printReport();
+    // requests pick their own outputs
+    int ret = run_server(socket_path, opts, vm.count("jobs") ? vm["jobs"].as<unsigned int>() : 0);
+    if (cache)
+      cache->trim();
+    return ret;
   }
 
-  if (!logger->getErrors()) {
-    if (vm.count("lso-compile")) {
-      auto lso_dest = vm["lso-compile"].as<std::string>();
-      LSOScriptCompiler lso_visitor(&parser.allocator);
-      script->visit(&lso_visitor);
+  if (batch) {
+    BatchOptions batch_opts {};
+    if (vm.count("jobs"))
+      batch_opts.jobs = vm["jobs"].as<unsigned int>();
+    else
+      batch_opts.jobs = 0;
+    if (vm.count("output-dir"))
+      batch_opts.output_dir = vm["output-dir"].as<std::string>();
+    if (vm.count("lso-compile"))
+      batch_opts.lso_dir = vm["lso-compile"].as<std::string>();
+    else if (vm.count("mono-compile"))
+      batch_opts.mono_dir = vm["mono-compile"].as<std::string>();
+    int ret = run_batch(scripts, manifest, opts, batch_opts, profiler);
+    if (opts.profile)
+      write_profile(profiler, time_passes, trace_file);
+    if (cache)
+      cache->trim();
+    return ret;
+  }
 
-      std::ofstream f(lso_dest, std::ios::binary);
-      f.write((const char *) lso_visitor.mScriptBS.data(), (std::streamsize) lso_visitor.mScriptBS.size());
-    } else if (vm.count("mono-compile")) {
-      auto lso_dest = vm["mono-compile"].as<std::string>();
-      MonoScriptCompiler mono_visitor(&parser.allocator);
-      script->visit(&mono_visitor);
+  // set up the allocator and logger
+  ScopedScriptParser parser(nullptr);
+  if (opts.profile) {
+    parser.context.profiler = &profiler;
+    if (!scripts.empty())
+      profiler.setScriptName(scripts[0]);
+  }
 
-      std::ofstream f(lso_dest, std::ios::binary);
-      std::string cil_code {mono_visitor.mCIL.str()};
-      f.write(cil_code.c_str(), (std::streamsize) cil_code.size());
-    }
+  CompileResult output;
+  compile_source(parser, opts, source, output);
+  // Machine-readable diagnostics go to stdout same as in batch mode,
+  // anything meant for humans moves out of their way.
+  bool text_diagnostics = opts.diagnostics_format == DIAGNOSTICS_TEXT;
+  std::ostream &script_out = text_diagnostics ? std::cout : std::cerr;
+  if (output.parsed && !output.pretty.empty())
+    script_out << output.pretty << "\n";
+  std::string file = scripts.empty() ? "<stdin>" : scripts[0];
+  if (opts.diagnostics_format == DIAGNOSTICS_JSONL) {
+    fputs(format_jsonl_diagnostics(output.messages, file).c_str(), stdout);
+    printf("{\"file\": \"%s\", \"ok\": %s, \"errors\": %d, \"warnings\": %d}\n",
+           json_escape(file).c_str(), (output.parsed && !output.errors) ? "true" : "false",
+           output.errors, output.warnings);
+  } else if (opts.diagnostics_format == DIAGNOSTICS_SARIF) {
+    SarifWriter sarif(stdout);
+    sarif.addResults(file, output.messages);
+    sarif.finish(output.parsed && !output.errors, "{\"errors\": " + std::to_string(output.errors)
+                 + ", \"warnings\": " + std::to_string(output.warnings) + "}");
+  } else {
+    fputs(output.diagnostics.c_str(), stderr);
+  }
+  if (output.parsed && opts.show_tree) {
+    script_out << "Tree:" << std::endl;
+    script_out << output.tree;
   }
-  return logger->getErrors();
+
+  if (!output.lso.empty())
+    write_file(vm["lso-compile"].as<std::string>(), output.lso.data(), output.lso.size());
+  else if (!output.cil.empty())
+    write_file(vm["mono-compile"].as<std::string>(), output.cil.data(), output.cil.size());
+  if (opts.profile)
+    write_profile(profiler, time_passes, trace_file);
+  if (cache)
+    cache->trim();
+  return output.errors;
 }
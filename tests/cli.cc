@@ -0,0 +1,332 @@
+// Runs the tailslide CLI itself, for the modes that only exist there.
+#ifndef _WIN32
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <sys/wait.h>
+
+#include "doctest.hh"
+
+namespace fs = std::filesystem;
+
+TEST_SUITE_BEGIN("CLI");
+
+// A scratch directory that the CLI gets run from, removed afterwards
+class CLIRunner {
+  public:
+    CLIRunner() {
+      _mDir = fs::temp_directory_path() / ("tailslide-cli-test-" + std::to_string(std::random_device()()));
+      fs::create_directories(_mDir);
+    }
+    ~CLIRunner() {
+      std::error_code ec;
+      fs::remove_all(_mDir, ec);
+    }
+
+    void writeFile(const std::string &rel_path, const std::string &contents) {
+      fs::path path = _mDir / rel_path;
+      fs::create_directories(path.parent_path());
+      std::ofstream f(path, std::ios::binary);
+      f << contents;
+    }
+
+    std::string readFile(const std::string &rel_path) {
+      std::ifstream f(_mDir / rel_path, std::ios::binary);
+      std::stringstream ss;
+      ss << f.rdbuf();
+      return ss.str();
+    }
+
+    bool exists(const std::string &rel_path) {
+      return fs::exists(_mDir / rel_path);
+    }
+
+    // Run the CLI with `args` from the scratch directory, feeding it `input` on stdin.
+    // Returns its exit code.
+    int run(const std::vector<std::string> &args, const std::string &input = "") {
+      writeFile(".stdin", input);
+      std::string command = "cd " + quote(_mDir.string()) + " && " + quote(TAILSLIDE_CLI_PATH);
+      for (auto &arg : args)
+        command += " " + quote(arg);
+      command += " < .stdin > .stdout 2> .stderr";
+      int status = std::system(command.c_str());
+      out = readFile(".stdout");
+      err = readFile(".stderr");
+      return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+    }
+
+    std::string out;
+    std::string err;
+
+  private:
+    static std::string quote(const std::string &str) {
+      std::string quoted = "'";
+      for (char c : str) {
+        if (c == '\'')
+          quoted += "'\\''";
+        else
+          quoted += c;
+      }
+      return quoted + "'";
+    }
+
+    fs::path _mDir;
+};
+
+static const char *UNUSED_LOCAL_SRC = "default { state_entry() { integer x; } }\n";
+static const char *UNDECLARED_SRC = "default { state_entry() { llOwnerSay(y); } }\n";
+
+static std::vector<std::string> split_lines(const std::string &str) {
+  std::vector<std::string> lines;
+  std::istringstream ss(str);
+  std::string line;
+  while (std::getline(ss, line))
+    lines.push_back(line);
+  return lines;
+}
+
+// The line of batch output about `file`, scripts may finish in any order.
+static std::string find_file_line(const std::string &out, const std::string &file) {
+  for (auto &line : split_lines(out)) {
+    if (line.find("{\"file\": \"" + file + "\", \"ok\"") == 0)
+      return line;
+  }
+  return "";
+}
+
+TEST_CASE("Batch mode") {
+  CLIRunner cli;
+  cli.writeFile("in/a.lsl", UNUSED_LOCAL_SRC);
+  cli.writeFile("in/sub/b.lsl", "default { state_entry() { llOwnerSay(\"hi\"); } }\n");
+  CHECK_EQ(cli.run({"-j", "2", "--output-dir", "out", "in"}), 0);
+
+  auto a_line = find_file_line(cli.out, "in/a.lsl");
+  CHECK_NE(a_line.find("\"ok\": true, \"errors\": 0, \"warnings\": 1"), std::string::npos);
+  auto b_line = find_file_line(cli.out, "in/sub/b.lsl");
+  CHECK_NE(b_line.find("\"ok\": true, \"errors\": 0, \"warnings\": 0"), std::string::npos);
+  CHECK_EQ(split_lines(cli.out).back().find("{\"files\": 2, \"failed\": 0, \"errors\": 0, \"warnings\": 1"), 0);
+  // outputs keep the layout of the input directory
+  CHECK_NE(cli.readFile("out/a.lsl").find("integer x;"), std::string::npos);
+  CHECK_NE(cli.readFile("out/sub/b.lsl").find("llOwnerSay(\"hi\");"), std::string::npos);
+  CHECK_NE(cli.err.find("[E20009] variable `x' declared but never used."), std::string::npos);
+
+  // any script with errors fails the batch
+  cli.writeFile("in/c.lsl", UNDECLARED_SRC);
+  CHECK_EQ(cli.run({"--lint", "in"}), 1);
+  CHECK_NE(find_file_line(cli.out, "in/c.lsl").find("\"ok\": false, \"errors\": 1"), std::string::npos);
+  CHECK_EQ(split_lines(cli.out).back().find("{\"files\": 3, \"failed\": 1, \"errors\": 1"), 0);
+}
+
+TEST_CASE("Batch mode refuses colliding outputs") {
+  CLIRunner cli;
+  cli.writeFile("a/foo.lsl", UNUSED_LOCAL_SRC);
+  cli.writeFile("b/foo.lsl", UNUSED_LOCAL_SRC);
+  CHECK_EQ(cli.run({"--output-dir", "out", "a/foo.lsl", "b/foo.lsl"}), 1);
+  CHECK_NE(cli.err.find("a/foo.lsl and b/foo.lsl would both be written to foo.lsl"), std::string::npos);
+  // nothing was processed
+  CHECK(cli.out.empty());
+  CHECK_FALSE(cli.exists("out"));
+
+  // extensions get replaced, so these would collide too
+  cli.writeFile("b/foo.txt", UNUSED_LOCAL_SRC);
+  CHECK_EQ(cli.run({"--output-dir", "out", "a/foo.lsl", "b/foo.txt"}), 1);
+
+  // but they're fine if nothing gets written
+  CHECK_EQ(cli.run({"--lint", "a/foo.lsl", "b/foo.lsl"}), 0);
+}
+
+TEST_CASE("Batch mode reports output write failures") {
+  CLIRunner cli;
+  cli.writeFile("in/a.lsl", UNUSED_LOCAL_SRC);
+  cli.writeFile("in/b.lsl", UNUSED_LOCAL_SRC);
+  // can't make a directory under a regular file, even as root.
+  cli.writeFile("not_a_dir", "");
+  CHECK_EQ(cli.run({"-j", "2", "--output-dir", "not_a_dir/out", "in"}), 1);
+
+  for (const char *file : {"in/a.lsl", "in/b.lsl"}) {
+    CAPTURE(file);
+    auto line = find_file_line(cli.out, file);
+    CHECK_EQ(line.find("{\"file\": \"" + std::string(file) + "\", \"ok\": false, \"errors\": 0"), 0);
+    CHECK_NE(line.find("\"write_error\": \"couldn't create not_a_dir/out"), std::string::npos);
+  }
+  CHECK_EQ(split_lines(cli.out).back().find("{\"files\": 2, \"failed\": 2"), 0);
+  CHECK_NE(cli.err.find("couldn't create not_a_dir/out"), std::string::npos);
+
+  // SARIF logs get it in the artifact's properties
+  CHECK_EQ(cli.run({"--diagnostics-format", "sarif", "--output-dir", "not_a_dir/out", "in"}), 1);
+  CHECK_NE(cli.out.find("{\"location\": {\"uri\": \"in/a.lsl\"}, \"properties\": {\"ok\": false"), std::string::npos);
+  CHECK_NE(cli.out.find("\"write_error\": \"couldn't create not_a_dir/out"), std::string::npos);
+  CHECK_NE(cli.out.find("\"executionSuccessful\": false"), std::string::npos);
+}
+
+struct ServerFrame {
+  std::string id;
+  std::string kind;
+  std::string payload;
+};
+
+// Split server output into `<id> <kind> <length>\n<payload>` frames
+static std::vector<ServerFrame> parse_frames(const std::string &out) {
+  std::vector<ServerFrame> frames;
+  size_t pos = 0;
+  while (pos < out.size()) {
+    size_t header_end = out.find('\n', pos);
+    REQUIRE_NE(header_end, std::string::npos);
+    std::istringstream header(out.substr(pos, header_end - pos));
+    ServerFrame frame;
+    size_t len = 0;
+    header >> frame.id >> frame.kind >> len;
+    REQUIRE(header);
+    REQUIRE_LE(header_end + 1 + len, out.size());
+    frame.payload = out.substr(header_end + 1, len);
+    frames.push_back(std::move(frame));
+    pos = header_end + 1 + len;
+  }
+  return frames;
+}
+
+static std::vector<ServerFrame> frames_for(const std::vector<ServerFrame> &frames, const std::string &id) {
+  std::vector<ServerFrame> matching;
+  for (auto &frame : frames) {
+    if (frame.id == id)
+      matching.push_back(frame);
+  }
+  return matching;
+}
+
+static std::string server_request(const std::string &header, const std::string &payload) {
+  return header + " " + std::to_string(payload.size()) + "\n" + payload;
+}
+
+TEST_CASE("Server mode") {
+  CLIRunner cli;
+  std::string src = UNUSED_LOCAL_SRC;
+  std::string use_x = "llOwnerSay((string)x); ";
+  std::string requests;
+  requests += server_request("1 open doc", src);
+  // start using `x`, the warning should go away
+  size_t use_offset = src.find('}');
+  requests += server_request("2 edit doc " + std::to_string(use_offset) + " 0", use_x);
+  // and a typo that's an error instead
+  std::string edited = src.substr(0, use_offset) + use_x + src.substr(use_offset);
+  requests += server_request("3 edit doc " + std::to_string(edited.find("x)")) + " 1", "y");
+  requests += server_request("4 close doc", "");
+  requests += server_request("5 edit doc 0 0", "");
+  // queued requests get finished before the server exits
+  requests += server_request("6 pretty", UNDECLARED_SRC);
+  requests += server_request("7 frobnicate", "");
+  CHECK_EQ(cli.run({"--serve", "-j", "2"}, requests), 0);
+
+  auto frames = parse_frames(cli.out);
+  auto open_frames = frames_for(frames, "1");
+  REQUIRE_EQ(open_frames.size(), 2);
+  CHECK_EQ(open_frames[0].kind, "diagnostics");
+  CHECK_EQ(open_frames[0].payload, " WARN:: (  1, 27): [E20009] variable `x' declared but never used.\n"
+                                   "TOTAL:: Errors: 0  Warnings: 1\n");
+  CHECK_EQ(open_frames[1].kind, "done");
+  CHECK_EQ(open_frames[1].payload.find("{\"ok\": true, \"errors\": 0, \"warnings\": 1, \"incremental\": false"), 0);
+
+  auto edit_frames = frames_for(frames, "2");
+  REQUIRE_EQ(edit_frames.size(), 2);
+  CHECK_EQ(edit_frames[0].payload, "TOTAL:: Errors: 0  Warnings: 0\n");
+  CHECK_EQ(edit_frames[1].payload.find("{\"ok\": true, \"errors\": 0, \"warnings\": 0, \"incremental\": true"), 0);
+
+  auto typo_frames = frames_for(frames, "3");
+  REQUIRE_EQ(typo_frames.size(), 2);
+  CHECK_NE(typo_frames[0].payload.find("[E10006] `y' is undeclared."), std::string::npos);
+  CHECK_NE(typo_frames[0].payload.find("[E20009] variable `x' declared but never used."), std::string::npos);
+  CHECK_EQ(typo_frames[1].payload.find("{\"ok\": false, \"errors\": 1, \"warnings\": 1"), 0);
+
+  auto close_frames = frames_for(frames, "4");
+  REQUIRE_EQ(close_frames.size(), 1);
+  CHECK_EQ(close_frames[0].kind, "done");
+  auto closed_frames = frames_for(frames, "5");
+  REQUIRE_EQ(closed_frames.size(), 1);
+  CHECK_EQ(closed_frames[0].kind, "error");
+  CHECK_EQ(closed_frames[0].payload, "no open document doc");
+
+  auto pretty_frames = frames_for(frames, "6");
+  REQUIRE_EQ(pretty_frames.size(), 2);
+  CHECK_EQ(pretty_frames[0].kind, "diagnostics");
+  CHECK_NE(pretty_frames[0].payload.find("[E10006] `y' is undeclared."), std::string::npos);
+  CHECK_EQ(pretty_frames[1].kind, "done");
+  CHECK_EQ(pretty_frames[1].payload.find("{\"ok\": false, \"errors\": 1"), 0);
+
+  auto bad_frames = frames_for(frames, "7");
+  REQUIRE_EQ(bad_frames.size(), 1);
+  CHECK_EQ(bad_frames[0].kind, "error");
+  CHECK_EQ(bad_frames[0].payload, "unknown command frobnicate");
+}
+
+TEST_CASE("Server mode documents use the server's logger options") {
+  CLIRunner cli;
+  std::string requests = server_request("1 open doc", UNUSED_LOCAL_SRC);
+  CHECK_EQ(cli.run({"--serve", "--suppress", "20009"}, requests), 0);
+  auto frames = frames_for(parse_frames(cli.out), "1");
+  REQUIRE_EQ(frames.size(), 2);
+  CHECK_EQ(frames[0].payload, "TOTAL:: Errors: 0  Warnings: 0\n");
+
+  // assertions can't be checked against a document that's being edited
+  CHECK_EQ(cli.run({"--serve", "--check-asserts"}, requests), 0);
+  frames = frames_for(parse_frames(cli.out), "1");
+  REQUIRE_EQ(frames.size(), 1);
+  CHECK_EQ(frames[0].kind, "error");
+}
+
+static const char *ERROR_AND_WARNING_SRC = "default { state_entry() { integer x; llOwnerSay(y); } }\n";
+
+TEST_CASE("JSON Lines diagnostics") {
+  CLIRunner cli;
+  cli.writeFile("both.lsl", ERROR_AND_WARNING_SRC);
+  CHECK_EQ(cli.run({"--lint", "--diagnostics-format", "jsonl", "both.lsl"}), 1);
+  auto lines = split_lines(cli.out);
+  REQUIRE_EQ(lines.size(), 3);
+  CHECK_EQ(lines[0], "{\"file\": \"both.lsl\", \"level\": \"error\", \"code\": 10006, \"line\": 1, \"column\": 49, "
+                     "\"end_line\": 1, \"end_column\": 50, \"message\": \"`y' is undeclared.\"}");
+  CHECK_EQ(lines[1], "{\"file\": \"both.lsl\", \"level\": \"warning\", \"code\": 20009, \"line\": 1, \"column\": 27, "
+                     "\"end_line\": 1, \"end_column\": 36, \"message\": \"variable `x' declared but never used.\"}");
+  CHECK_EQ(lines[2], "{\"file\": \"both.lsl\", \"ok\": false, \"errors\": 1, \"warnings\": 1}");
+  // nothing goes to stderr when it's machine-readable
+  CHECK(cli.err.empty());
+
+  // no message text can contain quotes, but file names can
+  cli.writeFile("say \"hi\".lsl", UNUSED_LOCAL_SRC);
+  CHECK_EQ(cli.run({"--lint", "--diagnostics-format", "jsonl", "say \"hi\".lsl"}), 0);
+  lines = split_lines(cli.out);
+  REQUIRE_EQ(lines.size(), 2);
+  CHECK_EQ(lines[0].find("{\"file\": \"say \\\"hi\\\".lsl\", \"level\": \"warning\", \"code\": 20009"), 0);
+  CHECK_EQ(lines[1], "{\"file\": \"say \\\"hi\\\".lsl\", \"ok\": true, \"errors\": 0, \"warnings\": 1}");
+}
+
+TEST_CASE("SARIF diagnostics") {
+  CLIRunner cli;
+  cli.writeFile("both.lsl", ERROR_AND_WARNING_SRC);
+  cli.writeFile("say \"hi\".lsl", UNUSED_LOCAL_SRC);
+  CHECK_EQ(cli.run({"--lint", "--diagnostics-format", "sarif", "both.lsl", "say \"hi\".lsl"}), 1);
+  auto lines = split_lines(cli.out);
+  REQUIRE_GE(lines.size(), 1);
+  CHECK_EQ(lines[0].find("{\"version\": \"2.1.0\", \"$schema\": \"https://json.schemastore.org/sarif-2.1.0.json\", "
+                         "\"runs\": [{\"tool\": {\"driver\": {\"name\": \"tailslide\""), 0);
+  CHECK_NE(cli.out.find("\n{\"ruleId\": \"E10006\", \"level\": \"error\", \"message\": {\"text\": \"`y' is undeclared.\"}, "
+                        "\"locations\": [{\"physicalLocation\": {\"artifactLocation\": {\"uri\": \"both.lsl\"}, "
+                        "\"region\": {\"startLine\": 1, \"startColumn\": 49, \"endLine\": 1, \"endColumn\": 50}}}]}"),
+           std::string::npos);
+  CHECK_NE(cli.out.find("{\"ruleId\": \"E20009\", \"level\": \"warning\", "
+                        "\"message\": {\"text\": \"variable `x' declared but never used.\"}, "
+                        "\"locations\": [{\"physicalLocation\": {\"artifactLocation\": {\"uri\": \"both.lsl\"}, "
+                        "\"region\": {\"startLine\": 1, \"startColumn\": 27, \"endLine\": 1, \"endColumn\": 36}}}]}"),
+           std::string::npos);
+  // the file name is made into a URI and then escaped for JSON
+  CHECK_NE(cli.out.find("{\"artifactLocation\": {\"uri\": \"say%20\\\"hi\\\".lsl\"}"), std::string::npos);
+  CHECK_NE(cli.out.find("\"invocations\": [{\"executionSuccessful\": false, "
+                        "\"properties\": {\"files\": 2, \"failed\": 1, \"errors\": 1, \"warnings\": 2"),
+           std::string::npos);
+  CHECK_EQ(lines.back().substr(lines.back().size() - 5), "}]}]}");
+  CHECK(cli.err.empty());
+}
+
+TEST_SUITE_END();
+
+#endif
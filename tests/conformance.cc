@@ -1,3 +1,7 @@
+#include <algorithm>
+#include <filesystem>
+#include <thread>
+
 #include "tailslide.hh"
 #include "doctest.hh"
 #include "passes/pretty_print.hh"
@@ -184,6 +188,17 @@ TEST_CASE("mms_player.lsl") {
   checkPrettyPrintOutput("mms_player.lsl", ctx, pretty_ctx);
 }
 
+TEST_CASE("prune_cascade.lsl") {
+  OptimizationOptions ctx {
+      .fold_constants = true,
+      .prune_unused_locals = true,
+      .prune_unused_globals = true,
+      .prune_unused_functions = true,
+  };
+  PrettyPrintOpts pretty_ctx {};
+  checkPrettyPrintOutput("prune_cascade.lsl", ctx, pretty_ctx);
+}
+
 #ifndef _WIN32
 TEST_CASE("parserstackdepth2.lsl") {
   OptimizationOptions ctx{};
@@ -302,6 +317,55 @@ TEST_CASE("jump_kinds.lsl") {
   checkTreeDumpOutput("jump_kinds.lsl", OptimizationOptions{});
 }
 
+static std::string describeAnalysis(ScopedScriptParser *parser) {
+  // message order isn't meaningful, sort them so we can compare
+  std::vector<std::string> messages;
+  for (auto *msg : parser->logger.getMessages()) {
+    messages.emplace_back(
+        std::to_string(msg->getLoc()->first_line) + ":" + std::to_string(msg->getLoc()->first_column)
+        + " " + std::to_string(msg->getError()) + " " + msg->getMessage()
+    );
+  }
+  std::sort(messages.begin(), messages.end());
+  std::string desc;
+  for (auto &msg : messages)
+    desc += msg + "\n";
+  TreePrintingVisitor visitor;
+  parser->script->visit(&visitor);
+  return desc + visitor.mStream.str();
+}
+
+TEST_CASE("Fused analysis matches separate passes") {
+  for (auto *name : {"check_all_return.lsl", "constprop.lsl", "error1.lsl", "illegal_cast.lsl",
+                     "lsl_conformance.lsl", "scope1.lsl", "various_globals.lsl"}) {
+    CAPTURE(name);
+    std::string path = __FILE__;
+    path.erase(path.find_last_of("\\/"));
+    path += "/scripts/";
+    path += name;
+
+    ScopedScriptParser separate_parser(nullptr);
+    auto *script = separate_parser.parseLSLFile(path);
+    REQUIRE(script);
+    script->collectSymbols();
+    script->determineTypes();
+    script->recalculateReferenceData();
+    script->propagateValues();
+    script->finalPass();
+    script->validateGlobals(true);
+    script->checkSymbols();
+
+    ScopedScriptParser fused_parser(nullptr);
+    script = fused_parser.parseLSLFile(path);
+    REQUIRE(script);
+    script->analyze(true);
+
+    CHECK_EQ(separate_parser.logger.getErrors(), fused_parser.logger.getErrors());
+    CHECK_EQ(separate_parser.logger.getWarnings(), fused_parser.logger.getWarnings());
+    CHECK_EQ(describeAnalysis(&separate_parser), describeAnalysis(&fused_parser));
+  }
+}
+
 static const char *SIMPLE_SCRIPT_BYTES = "default{state_entry(){}}";
 
 TEST_CASE("Parse script buffer") {
@@ -311,4 +375,73 @@ TEST_CASE("Parse script buffer") {
   CHECK_EQ(0, parser->logger.getErrors());
 }
 
+// Everything we can observe about a script having gone through the whole pipeline
+static std::string describeCompilation(const std::string &path) {
+  ScopedScriptParser parser(nullptr);
+  auto *script = parser.parseLSLFile(path);
+  if (!script)
+    return "parse failed";
+  script->analyze(true, false);
+  std::string desc;
+  if (!parser.logger.getErrors()) {
+    script->optimize({.fold_constants = true, .prune_unused_locals = true,
+                      .prune_unused_globals = true, .prune_unused_functions = true});
+    script->validateGlobals(true);
+    script->checkSymbols();
+    parser.table_manager.setMangledNames();
+    // the visitor only keeps a reference to these
+    PrettyPrintOpts pretty_opts {};
+    PrettyPrintVisitor print_visitor(pretty_opts);
+    script->visit(&print_visitor);
+    desc = print_visitor.mStream.str();
+    if (!parser.logger.getErrors()) {
+      MonoScriptCompiler mono_visitor(&parser.allocator);
+      script->visit(&mono_visitor);
+      desc += mono_visitor.mCIL.str();
+    }
+  }
+  return describeAnalysis(&parser) + desc;
+}
+
+TEST_CASE("Concurrent parsing shares builtins safely") {
+  std::string scripts_dir = __FILE__;
+  scripts_dir.erase(scripts_dir.find_last_of("\\/"));
+  scripts_dir += "/scripts/";
+
+  std::vector<std::string> paths;
+  for (auto &entry : std::filesystem::directory_iterator(scripts_dir)) {
+    if (entry.path().extension() == ".lsl")
+      paths.emplace_back(entry.path().string());
+  }
+  std::sort(paths.begin(), paths.end());
+  REQUIRE_FALSE(paths.empty());
+
+  std::vector<std::string> expected;
+  for (auto &path : paths)
+    expected.emplace_back(describeCompilation(path));
+
+  // every thread does the whole corpus, starting at different offsets
+  // so different scripts are in flight at the same time.
+  const size_t num_threads = 8;
+  std::vector<std::vector<std::string>> results(num_threads, std::vector<std::string>(paths.size()));
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < num_threads; ++i) {
+    threads.emplace_back([&, i]() {
+      for (size_t j = 0; j < paths.size(); ++j) {
+        size_t idx = (j + i * paths.size() / num_threads) % paths.size();
+        results[i][idx] = describeCompilation(paths[idx]);
+      }
+    });
+  }
+  for (auto &thread : threads)
+    thread.join();
+
+  for (size_t i = 0; i < num_threads; ++i) {
+    for (size_t j = 0; j < paths.size(); ++j) {
+      CAPTURE(paths[j]);
+      CHECK_EQ(results[i][j], expected[j]);
+    }
+  }
+}
+
 TEST_SUITE_END();
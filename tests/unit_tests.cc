@@ -1,6 +1,23 @@
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <random>
+
 #include "tailslide.hh"
 #include "doctest.hh"
+#include "ast_serialization.hh"
 #include "bitstream.hh"
+#include "visitor.hh"
+#include "builtins_table.hh"
+#include "compile_cache.hh"
+#include "incremental.hh"
+#include "passes/control_flow.hh"
+#include "passes/dataflow.hh"
+#include "passes/tree_print.hh"
+#include "passes/tree_simplifier.hh"
+#include "passes/lso/script_compiler.hh"
+#include "passes/mono/script_compiler.hh"
+#include "script_generator.hh"
 
 using namespace Tailslide;
 
@@ -23,6 +40,741 @@ TEST_CASE("Get parent slot") {
   CHECK_EQ(int_const->getParentSlot(), 2);
 }
 
+TEST_CASE("Child slots stay in sync") {
+  ScriptAllocator allocator;
+  ScriptContext context {
+    nullptr,
+    &allocator
+  };
+  allocator.setContext(&context);
+
+  LSLIntegerConstant *consts[6];
+  auto *list_const = allocator.newTracked<LSLListConstant>(nullptr);
+  for (int i = 0; i < 6; ++i) {
+    consts[i] = allocator.newTracked<LSLIntegerConstant>(i);
+  }
+  // chains of siblings get pushed all at once
+  consts[0]->setNext(consts[1]);
+  consts[1]->setNext(consts[2]);
+  list_const->pushChild(consts[0]);
+  for (int i = 3; i < 6; ++i) {
+    list_const->pushChild(consts[i]);
+  }
+  CHECK_EQ(list_const->getNumChildren(), 6);
+  for (int i = 0; i < 6; ++i) {
+    CHECK_EQ(list_const->getChild(i), consts[i]);
+    CHECK_EQ(consts[i]->getParentSlot(), i);
+  }
+  CHECK_EQ(list_const->getChild(6), nullptr);
+
+  list_const->removeChild(consts[1]);
+  CHECK_EQ(list_const->getNumChildren(), 5);
+  CHECK_EQ(consts[1]->getParentSlot(), -1);
+  CHECK_EQ(list_const->getChild(1), consts[2]);
+  CHECK_EQ(list_const->getChild(3), consts[4]);
+  CHECK_EQ(list_const->getChild(4), consts[5]);
+  CHECK_EQ(consts[5]->getParentSlot(), 4);
+
+  auto *replacement = allocator.newTracked<LSLIntegerConstant>(10);
+  LSLASTNode::replaceNode(consts[4], replacement);
+  CHECK_EQ(list_const->getChild(3), replacement);
+  CHECK_EQ(replacement->getParentSlot(), 3);
+  list_const->setChild(4, consts[1]);
+  CHECK_EQ(list_const->getChild(4), consts[1]);
+
+  int idx = 0;
+  for (auto *child : *list_const) {
+    CHECK_EQ(list_const->getChild(idx++), child);
+  }
+  CHECK_EQ(idx, 5);
+}
+
+class ConstantCountingVisitor : public StaticASTVisitor<ConstantCountingVisitor> {
+  public:
+    using StaticASTVisitor::visit;
+    // no handler for the specific constant types, should fall back to this.
+    bool visit(LSLConstant *constant) {
+      ++constants;
+      return true;
+    }
+    bool visit(LSLStringConstant *str_const) {
+      ++strings;
+      return visit((LSLConstant *)str_const);
+    }
+    int constants = 0;
+    int strings = 0;
+};
+
+TEST_CASE("Static visitor dispatch") {
+  ScriptAllocator allocator;
+  ScriptContext context {
+    nullptr,
+    &allocator
+  };
+  allocator.setContext(&context);
+
+  auto *list_const = allocator.newTracked<LSLListConstant>(nullptr);
+  list_const->pushChild(allocator.newTracked<LSLIntegerConstant>(1));
+  list_const->pushChild(allocator.newTracked<LSLStringConstant>("foo"));
+  list_const->pushChild(allocator.newTracked<LSLKeyConstant>("bar"));
+  CHECK_EQ(list_const->getNodeType(), NODE_CONSTANT);
+  CHECK_EQ(list_const->getNodeSubType(), NODE_LIST_CONSTANT);
+
+  ConstantCountingVisitor visitor;
+  list_const->visit(&visitor);
+  CHECK_EQ(visitor.constants, 4);
+  // key constants fall back to the `LSLConstant` handler, same as with `ASTVisitor`
+  CHECK_EQ(visitor.strings, 1);
+}
+
+TEST_CASE("Arena allocator") {
+  ScriptAllocator allocator;
+  ScriptContext context {
+    nullptr,
+    &allocator
+  };
+  allocator.setContext(&context);
+  CHECK(allocator.usesArena());
+
+  auto *first = allocator.newTracked<LSLIntegerConstant>(1);
+  auto *second = allocator.newTracked<LSLIntegerConstant>(2);
+  // trivially torn down objects are laid out next to each other
+  CHECK_EQ((char *)second - (char *)first, sizeof(LSLIntegerConstant));
+  CHECK_EQ(second->getValue(), 2);
+  allocator.newTracked<LSLSymbolTable>(SYMTAB_LEXICAL);
+  const char *str = allocator.copyStr("foobar");
+  CHECK_EQ(std::string(str), "foobar");
+  // too big to share a block
+  allocator.alloc(ScriptAllocator::ARENA_BLOCK_SIZE);
+
+  auto stats = allocator.getStats();
+  CHECK_EQ(stats.objects, 3);
+  CHECK_EQ(stats.strings, 2);
+  CHECK_EQ(stats.destructors, 1);
+  CHECK_EQ(stats.blocks, 2);
+  CHECK_EQ(stats.bytes_reserved, ScriptAllocator::ARENA_BLOCK_SIZE * 2);
+  CHECK_GE(stats.bytes_used, ScriptAllocator::ARENA_BLOCK_SIZE + 7 + sizeof(LSLIntegerConstant) * 2);
+
+  ScriptAllocator heap_allocator(false);
+  heap_allocator.setContext(&context);
+  heap_allocator.newTracked<LSLIntegerConstant>(1);
+  CHECK_EQ(heap_allocator.getStats().blocks, 0);
+  CHECK_EQ(heap_allocator.getStats().objects, 1);
+}
+
+TEST_CASE("Reusing parser") {
+  const char *script_src = "default { state_entry() { llOwnerSay((string)(1 + 2)); } }";
+  ScopedScriptParser parser(nullptr);
+  // leave the scanner in the middle of a comment and with errors logged
+  const char *bad_src = "default { state_entry() { foo(); } } /* unterminated";
+  parser.parseLSLBytes(bad_src, (int)strlen(bad_src));
+  parser.script->collectSymbols();
+  CHECK_GT(parser.logger.getErrors(), 0);
+
+  parser.reset();
+  CHECK_EQ(parser.logger.getErrors(), 0);
+  CHECK_EQ(parser.allocator.getStats().objects, 0);
+  auto *script = parser.parseLSLBytes(script_src, (int)strlen(script_src));
+  REQUIRE(script);
+  script->collectSymbols();
+  CHECK_EQ(parser.logger.getErrors(), 0);
+  auto first_stats = parser.allocator.getStats();
+
+  // second parse of the same script should re-use the same blocks
+  parser.reset();
+  script = parser.parseLSLBytes(script_src, (int)strlen(script_src));
+  REQUIRE(script);
+  script->collectSymbols();
+  CHECK_EQ(parser.logger.getErrors(), 0);
+  auto second_stats = parser.allocator.getStats();
+  CHECK_EQ(first_stats.blocks, second_stats.blocks);
+  CHECK_EQ(first_stats.bytes_reserved, second_stats.bytes_reserved);
+  CHECK_EQ(first_stats.objects, second_stats.objects);
+  CHECK_EQ(script->getLoc()->first_line, 1);
+
+  // reference data from the previous script doesn't carry over to the next,
+  // even when the passes are run separately.
+  const char *usage_src = "integer g; default { state_entry() { g = 1; llOwnerSay((string)g); } }";
+  for (int i = 0; i < 2; ++i) {
+    parser.reset();
+    CHECK_FALSE(parser.context.usage_tracked);
+    script = parser.parseLSLBytes(usage_src, (int)strlen(usage_src));
+    REQUIRE(script);
+    script->collectSymbols();
+    script->determineTypes();
+    script->recalculateReferenceData();
+    script->propagateValues();
+    CHECK_EQ(parser.logger.getErrors(), 0);
+    auto *g_sym = script->lookupSymbol("g", SYM_VARIABLE);
+    REQUIRE(g_sym);
+    // the declaration, the assignment and the read
+    CHECK_EQ(g_sym->getReferences(), 3);
+    CHECK_EQ(g_sym->getAssignments(), 1);
+  }
+}
+
+TEST_CASE("Interned identifiers") {
+  ScopedScriptParser parser(nullptr);
+  auto &atoms = parser.allocator.getAtoms();
+  std::string name_buf = "some_name";
+  const char *atom = parser.allocator.intern(name_buf.c_str());
+  CHECK_NE(atom, name_buf.c_str());
+  CHECK_EQ(parser.allocator.intern("some_name"), atom);
+  CHECK_EQ(parser.allocator.intern("some_name_2", 9), atom);
+  CHECK_EQ(atoms.find("some_name"), atom);
+  CHECK_EQ(atoms.find("other_name"), nullptr);
+  CHECK_EQ(AtomTable::getLength(atom), 9);
+  CHECK_EQ(AtomTable::getHash(atom), AtomTable::hashString("some_name", 9));
+
+  const char *script_src = "integer foo; default { state_entry() { integer bar = foo; llOwnerSay((string)bar); } }";
+  auto *script = parser.parseLSLBytes(script_src, (int)strlen(script_src));
+  REQUIRE(script);
+  script->collectSymbols();
+  // every identifier with the same name shares the same string
+  auto *glob_id = ((LSLGlobalVariable *)script->getGlobals()->getChild(0))->getIdentifier();
+  CHECK_EQ(glob_id->getName(), atoms.find("foo"));
+  name_buf = "foo";
+  CHECK_EQ(script->lookupSymbol(name_buf.c_str(), SYM_VARIABLE), glob_id->getSymbol());
+  CHECK_NE(script->lookupSymbol("llOwnerSay", SYM_FUNCTION), nullptr);
+  CHECK_EQ(script->lookupSymbol("not_defined", SYM_ANY), nullptr);
+
+  parser.reset();
+  CHECK_EQ(atoms.size(), 0);
+  CHECK_EQ(atoms.find("foo"), nullptr);
+}
+
+TEST_CASE("Symbol tables and IDs") {
+  ScopedScriptParser parser(nullptr);
+  auto &allocator = parser.allocator;
+  auto *table = allocator.newTracked<LSLSymbolTable>(SYMTAB_LEXICAL);
+  auto make_symbol = [&](const char *name, LSLSymbolType sym_type) {
+    return allocator.newTracked<LSLSymbol>(name, TYPE(LST_INTEGER), sym_type, SYM_LOCAL);
+  };
+
+  // enough names to make the table grow a few times
+  std::vector<LSLSymbol *> symbols;
+  for (int i = 0; i < 100; ++i) {
+    std::string name = "sym" + std::to_string(i);
+    symbols.push_back(make_symbol(name.c_str(), SYM_VARIABLE));
+    table->define(symbols.back());
+  }
+  // IDs are dense and in creation order
+  for (uint32_t i = 0; i < symbols.size(); ++i)
+    CHECK_EQ(symbols[i]->getId(), i);
+  CHECK_EQ(parser.context.num_symbol_ids, symbols.size());
+  for (auto *sym : symbols)
+    CHECK_EQ(table->lookup(sym->getName()), sym);
+  CHECK_EQ(table->lookup("sym100"), nullptr);
+
+  // the newest definition of a name wins, unless we're looking for a different kind of symbol
+  auto *func_sym = make_symbol("sym5", SYM_FUNCTION);
+  auto *shadowing_sym = make_symbol("sym5", SYM_VARIABLE);
+  table->define(func_sym);
+  table->define(shadowing_sym);
+  CHECK_EQ(table->countAtom(symbols[5]->getName()), 3);
+  CHECK_EQ(table->lookup("sym5"), shadowing_sym);
+  CHECK_EQ(table->lookup("sym5", SYM_FUNCTION), func_sym);
+  CHECK(table->remove(shadowing_sym));
+  CHECK_FALSE(table->remove(shadowing_sym));
+  CHECK_EQ(table->lookup("sym5", SYM_VARIABLE), symbols[5]);
+
+  // removing most of them compacts the table without losing anything
+  for (int i = 0; i < 90; ++i)
+    CHECK(table->remove(symbols[i]));
+  CHECK_EQ(table->lookup("sym5"), func_sym);
+  CHECK_EQ(table->lookup("sym0"), nullptr);
+  CHECK_EQ(table->lookup("sym95"), symbols[95]);
+  std::vector<LSLSymbol *> remaining;
+  for (auto *sym : table->getSymbols())
+    remaining.push_back(sym);
+  REQUIRE_EQ(remaining.size(), 11);
+  // still in definition order
+  CHECK_EQ(remaining[0], symbols[90]);
+  CHECK_EQ(remaining[10], func_sym);
+
+  // per-symbol data lives in vectors indexed by ID, builtins get their own
+  SymbolDataVector<int> sym_data;
+  sym_data.reserveIds(get_num_builtin_symbol_ids(), parser.context.num_symbol_ids);
+  LSLSymbol *builtin_sym = nullptr;
+  for (auto *sym : parser.context.builtins->getSymbols()) {
+    CHECK_LT(sym->getId(), get_num_builtin_symbol_ids());
+    if (sym->getId() < symbols.size())
+      builtin_sym = sym;
+  }
+  REQUIRE(builtin_sym);
+  // same ID as one of the script's symbols, but not the same data
+  sym_data[builtin_sym] = 1;
+  sym_data[symbols[builtin_sym->getId()]] = 2;
+  CHECK_EQ(sym_data[builtin_sym], 1);
+  CHECK_EQ(sym_data[func_sym], 0);
+
+  // each script numbers its symbols from scratch
+  parser.reset();
+  CHECK_EQ(parser.context.num_symbol_ids, 0);
+
+  // event handlers' symbols are the script's own, making them doesn't use up builtin IDs
+  uint32_t num_builtin_ids = get_num_builtin_symbol_ids();
+  const char *script_src = "default { state_entry() {} touch_start(integer n) {} }";
+  auto *script = parser.parseLSLBytes(script_src, (int)strlen(script_src));
+  REQUIRE(script);
+  script->collectSymbols();
+  CHECK_EQ(get_num_builtin_symbol_ids(), num_builtin_ids);
+  auto *handler_sym = ((LSLState *)script->getStates()->getChild(0))->getEventHandlers()->getChild(1)->getSymbol();
+  REQUIRE(handler_sym);
+  CHECK_EQ(handler_sym->getSubType(), SYM_BUILTIN);
+  CHECK_FALSE(handler_sym->hasBuiltinId());
+  CHECK_LT(handler_sym->getId(), parser.context.num_symbol_ids);
+  CHECK(parser.context.builtins->lookup("touch_start", SYM_EVENT)->hasBuiltinId());
+}
+
+class LValueCollectingVisitor : public ASTVisitor {
+  public:
+    bool visit(LSLLValueExpression *lvalue) override {
+      lvalues.push_back(lvalue);
+      return false;
+    }
+    bool visit(LSLJumpStatement *jump_stmt) override {
+      jumps.push_back(jump_stmt);
+      return false;
+    }
+    std::vector<LSLLValueExpression *> lvalues;
+    std::vector<LSLJumpStatement *> jumps;
+};
+
+TEST_CASE("Scope chain resolution") {
+  ScopedScriptParser parser(nullptr);
+  const char *script_src = R"(
+integer x = 1;
+f(string x) {
+  { list x = [x]; x += x; }
+  x = "a";
+  x = (string)PI;
+  { jump end; }
+  @end;
+}
+default { state_entry() { x = 2; { float x = x; } } }
+)";
+  auto *script = parser.parseLSLBytes(script_src, (int)strlen(script_src));
+  REQUIRE(script);
+  script->collectSymbols();
+  CHECK_EQ(parser.logger.getErrors(), 0);
+
+  LValueCollectingVisitor visitor;
+  script->visit(&visitor);
+  REQUIRE_EQ(visitor.lvalues.size(), 8);
+  // every name resolves to the same symbol a walk up the tree would find,
+  // other than in initializers, where the new declaration isn't in scope yet.
+  for (auto *lvalue : visitor.lvalues) {
+    auto *id = lvalue->getIdentifier();
+    REQUIRE(id->getSymbol());
+    auto *stmt = lvalue->getParent();
+    while (stmt->getNodeType() != NODE_STATEMENT)
+      stmt = stmt->getParent();
+    if (stmt->getNodeSubType() != NODE_DECLARATION)
+      CHECK_EQ(id->getSymbol(), lvalue->lookupSymbol(id->getName(), SYM_VARIABLE));
+  }
+  auto sym_of = [&](int i) { return visitor.lvalues[i]->getIdentifier()->getSymbol(); };
+  // the initializer's `x` is resolved before the new `x` is declared
+  CHECK_EQ(sym_of(0)->getIType(), LST_STRING);
+  CHECK_EQ(sym_of(1)->getIType(), LST_LIST);
+  CHECK_EQ(sym_of(2)->getIType(), LST_LIST);
+  CHECK_EQ(sym_of(3)->getIType(), LST_STRING);
+  CHECK_EQ(sym_of(4)->getIType(), LST_STRING);
+  CHECK_EQ(sym_of(5)->getSubType(), SYM_BUILTIN);
+  CHECK_EQ(sym_of(6)->getSubType(), SYM_GLOBAL);
+  CHECK_EQ(sym_of(7)->getSubType(), SYM_GLOBAL);
+
+  // labels in enclosing scopes are visible to jumps in nested ones
+  REQUIRE_EQ(visitor.jumps.size(), 1);
+  auto *label_sym = visitor.jumps[0]->getIdentifier()->getSymbol();
+  REQUIRE(label_sym);
+  CHECK_EQ(label_sym->getLabelDecl()->getParent()->getParent()->getNodeType(), NODE_GLOBAL_FUNCTION);
+}
+
+TEST_CASE("Symbol usage tracking") {
+  ScopedScriptParser parser(nullptr);
+  const char *script_src = "integer g; f() { f(); g = 1; }\n"
+                           "default { state_entry() { f(); llOwnerSay((string)g); } }";
+  auto *script = parser.parseLSLBytes(script_src, (int)strlen(script_src));
+  REQUIRE(script);
+  script->analyze();
+  REQUIRE(parser.context.usage_tracked);
+
+  auto *g_sym = script->lookupSymbol("g", SYM_VARIABLE);
+  auto *f_sym = script->lookupSymbol("f", SYM_FUNCTION);
+  REQUIRE(g_sym);
+  REQUIRE(f_sym);
+  CHECK_EQ(g_sym->getReferences(), 3);
+  CHECK_EQ(g_sym->getAssignments(), 1);
+  // recursive calls don't count as uses
+  CHECK_EQ(f_sym->getReferences(), 2);
+
+  auto *f_body = script->getGlobals()->getChild(1)->getChild(2);
+  auto *assign_stmt = f_body->getChild(1);
+  auto *g_lvalue = (LSLLValueExpression *)assign_stmt->getChild(0)->getChild(0);
+  REQUIRE_EQ(g_lvalue->getNodeSubType(), NODE_LVALUE_EXPRESSION);
+  // a detached copy isn't part of the tree yet
+  g_lvalue->clone();
+  CHECK_EQ(g_sym->getReferences(), 3);
+
+  f_body->removeChild(assign_stmt);
+  CHECK_EQ(g_sym->getReferences(), 2);
+  CHECK_EQ(g_sym->getAssignments(), 0);
+  CHECK_FALSE(assign_stmt->isUsageTracked());
+
+  // edits within a detached subtree aren't counted until it's attached again
+  LSLASTNode::replaceNode(g_lvalue, g_lvalue->clone());
+  CHECK_EQ(g_sym->getReferences(), 2);
+  CHECK_EQ(g_sym->getAssignments(), 0);
+
+  // putting it back counts it again
+  f_body->pushChild(assign_stmt);
+  CHECK_EQ(g_sym->getReferences(), 3);
+  CHECK_EQ(g_sym->getAssignments(), 1);
+
+  // and the incrementally maintained counts match a full recount
+  script->invalidateReferenceData();
+  CHECK_FALSE(parser.context.usage_tracked);
+  script->recalculateReferenceData();
+  CHECK_EQ(g_sym->getReferences(), 3);
+  CHECK_EQ(g_sym->getAssignments(), 1);
+  CHECK_EQ(f_sym->getReferences(), 2);
+}
+
+TEST_CASE("Control flow graph construction") {
+  ScopedScriptParser parser(nullptr);
+  const char *script_src = R"(
+integer f(integer a) {
+  integer i;
+  while (i < a) {
+    if (i == 3)
+      jump done;
+    ++i;
+  }
+  @done;
+  return i;
+}
+default {
+  state_entry() {
+    do {
+      llOwnerSay("x");
+    } while (f(1));
+    state other;
+    llOwnerSay("unreachable");
+  }
+}
+state other { state_entry() {} }
+)";
+  auto *script = parser.parseLSLBytes(script_src, (int)strlen(script_src));
+  REQUIRE(script);
+  script->analyze();
+  REQUIRE_EQ(parser.logger.getErrors(), 0);
+
+  auto check_edges = [](const ControlFlowGraph &cfg) {
+    CHECK_EQ(cfg.getReversePostorder()[0], ControlFlowGraph::ENTRY);
+    for (uint32_t block_id = 0; block_id < cfg.getNumBlocks(); ++block_id) {
+      for (auto succ : cfg.getBlock(block_id).succs) {
+        const auto &preds = cfg.getBlock(succ).preds;
+        CHECK_NE(std::find(preds.begin(), preds.end(), block_id), preds.end());
+      }
+    }
+  };
+  // block holding the first node with the given operation or subtype
+  auto find_block = [](const ControlFlowGraph &cfg, LSLNodeSubType sub_type, LSLOperator op = OP_NONE) {
+    for (uint32_t block_id = 0; block_id < cfg.getNumBlocks(); ++block_id) {
+      for (auto *node : cfg.getBlock(block_id).nodes) {
+        if (node->getNodeSubType() != sub_type)
+          continue;
+        if (op == OP_NONE || ((LSLExpression *)node)->getOperation() == op)
+          return block_id;
+      }
+    }
+    return NO_BLOCK;
+  };
+
+  ControlFlowGraph func_cfg(script->getGlobals()->getChild(0));
+  check_edges(func_cfg);
+  CHECK(func_cfg.isReachable(ControlFlowGraph::EXIT));
+  uint32_t while_block = find_block(func_cfg, NODE_BINARY_EXPRESSION, OP_LESS);
+  uint32_t if_block = find_block(func_cfg, NODE_BINARY_EXPRESSION, OP_EQ);
+  uint32_t jump_block = find_block(func_cfg, NODE_JUMP_STATEMENT);
+  uint32_t return_block = find_block(func_cfg, NODE_RETURN_STATEMENT);
+  REQUIRE_NE(while_block, NO_BLOCK);
+  REQUIRE_NE(if_block, NO_BLOCK);
+  REQUIRE_NE(jump_block, NO_BLOCK);
+  REQUIRE_NE(return_block, NO_BLOCK);
+  const auto &while_cond = func_cfg.getBlock(while_block);
+  REQUIRE(while_cond.branch_cond);
+  REQUIRE_EQ(while_cond.succs.size(), 2);
+  CHECK_EQ(func_cfg.getBlock(if_block).succs[0], jump_block);
+  // both the jump and leaving the loop end up at the label
+  const auto &loop_exit = func_cfg.getBlock(while_cond.succs[1]);
+  REQUIRE_EQ(loop_exit.succs.size(), 1);
+  REQUIRE_EQ(func_cfg.getBlock(jump_block).succs.size(), 1);
+  CHECK_EQ(func_cfg.getBlock(jump_block).succs[0], loop_exit.succs[0]);
+  CHECK_EQ(func_cfg.getBlock(return_block).succs, std::vector<uint32_t>{ControlFlowGraph::EXIT});
+  CHECK_EQ(func_cfg.findNode(func_cfg.getBlock(return_block).nodes.back()).first, return_block);
+
+  auto *handler = script->getStates()->getChild(0)->getChild(1)->getChild(0);
+  ControlFlowGraph handler_cfg(handler);
+  check_edges(handler_cfg);
+  uint32_t do_block = find_block(handler_cfg, NODE_FUNCTION_EXPRESSION);
+  REQUIRE_NE(do_block, NO_BLOCK);
+  // the body comes before the condition, which loops back to it
+  const auto &do_cond = handler_cfg.getBlock(handler_cfg.getBlock(do_block).succs[0]);
+  REQUIRE(do_cond.branch_cond);
+  CHECK_EQ(do_cond.succs[0], do_block);
+  uint32_t state_block = find_block(handler_cfg, NODE_STATE_STATEMENT);
+  REQUIRE_NE(state_block, NO_BLOCK);
+  CHECK_EQ(handler_cfg.getBlock(state_block).succs, std::vector<uint32_t>{ControlFlowGraph::EXIT});
+  // nothing after the state change can run
+  uint32_t num_reachable_calls = 0, num_calls = 0;
+  for (uint32_t block_id = 0; block_id < handler_cfg.getNumBlocks(); ++block_id) {
+    for (auto *node : handler_cfg.getBlock(block_id).nodes) {
+      if (node->getNodeSubType() != NODE_FUNCTION_EXPRESSION)
+        continue;
+      ++num_calls;
+      num_reachable_calls += handler_cfg.isReachable(block_id);
+    }
+  }
+  CHECK_EQ(num_calls, 3);
+  CHECK_EQ(num_reachable_calls, 2);
+}
+
+TEST_CASE("Dataflow analyses") {
+  BitVector bits(70);
+  bits.set(3);
+  bits.set(68);
+  CHECK(bits.test(68));
+  CHECK_FALSE(bits.test(67));
+  CHECK_EQ(bits.count(), 2);
+  BitVector all_bits(70, true);
+  CHECK_EQ(all_bits.count(), 70);
+  all_bits.subtract(bits);
+  CHECK_EQ(all_bits.count(), 68);
+  all_bits.intersectWith(bits);
+  CHECK_EQ(all_bits.count(), 0);
+  all_bits.unionWith(bits);
+  CHECK(all_bits == bits);
+
+  ScopedScriptParser parser(nullptr);
+  const char *script_src = R"(
+f(integer a, vector v) {
+  integer b = a;
+  b = 2;
+  v.x = 1.0;
+  if (a)
+    b = 3;
+  llOwnerSay((string)b + (string)v);
+  while (a) {
+    --a;
+  }
+}
+g(integer p) {
+  integer x = 1;
+  float f = x;
+  integer y;
+  if (p)
+    y = x + 1;
+  else
+    y = 2;
+  integer z = 5;
+  while (p) {
+    z += 1;
+  }
+  integer w = y * 2;
+  llOwnerSay((string)[x, f, y, z, w, p]);
+}
+h(integer c) {
+  if (c)
+    jump skip;
+  integer i = 5;
+  @skip;
+  llOwnerSay((string)i);
+}
+default { state_entry() { f(1, ZERO_VECTOR); g(1); h(1); } }
+)";
+  auto *script = parser.parseLSLBytes(script_src, (int)strlen(script_src));
+  REQUIRE(script);
+  script->analyze();
+  REQUIRE_EQ(parser.logger.getErrors(), 0);
+
+  auto *f_func = script->getGlobals()->getChild(0);
+  LValueCollectingVisitor f_visitor;
+  f_func->visit(&f_visitor);
+  auto &f_lvalues = f_visitor.lvalues;
+  REQUIRE_EQ(f_lvalues.size(), 9);
+  ControlFlowGraph f_cfg(f_func);
+  FlowVariables f_vars(f_func);
+  REQUIRE_EQ(f_vars.size(), 3);
+  CHECK_EQ(f_vars.getNumParams(), 2);
+  uint32_t a_var = f_vars.getIndex(f_lvalues[0]->getSymbol());
+  uint32_t v_var = f_vars.getIndex(f_lvalues[2]->getSymbol());
+  uint32_t b_var = f_vars.getIndex(f_lvalues[1]->getSymbol());
+  CHECK_EQ(a_var, 0);
+  CHECK_EQ(v_var, 1);
+  CHECK_EQ(b_var, 2);
+
+  LivenessAnalysis liveness(f_cfg, f_vars);
+  const auto &entry_live = liveness.getLiveOut(ControlFlowGraph::ENTRY);
+  CHECK(entry_live.test(a_var));
+  CHECK(entry_live.test(v_var));
+  CHECK_FALSE(entry_live.test(b_var));
+  // `b` gets overwritten before anything reads what it was initialized with
+  auto *b_decl = f_func->getChild(2)->getChild(0);
+  auto decl_live = liveness.getLiveAfter(b_decl);
+  CHECK_FALSE(decl_live.test(b_var));
+  // writing to `v.x` keeps the rest of `v` around
+  CHECK(decl_live.test(v_var));
+  CHECK(liveness.getLiveAfter(f_lvalues[1]->getParent()).test(b_var));
+
+  ReachingDefinitions reaching(f_cfg, f_vars);
+  CHECK_EQ(reaching.getReachingDefs(f_lvalues[0]).size(), 1);
+  auto b_defs = reaching.getReachingDefs(f_lvalues[5]);
+  REQUIRE_EQ(b_defs.size(), 2);
+  CHECK_EQ(b_defs[0]->node, f_lvalues[1]->getParent());
+  CHECK_EQ(b_defs[1]->node, f_lvalues[4]->getParent());
+  auto v_defs = reaching.getReachingDefs(f_lvalues[6]);
+  REQUIRE_EQ(v_defs.size(), 2);
+  CHECK_EQ(v_defs[0]->node->getNodeType(), NODE_IDENTIFIER);
+  CHECK(v_defs[1]->partial);
+  // the decrement reaches itself through the loop
+  CHECK_EQ(reaching.getReachingDefs(f_lvalues[8]).size(), 2);
+
+  auto *g_func = script->getGlobals()->getChild(1);
+  LValueCollectingVisitor g_visitor;
+  g_func->visit(&g_visitor);
+  auto &g_lvalues = g_visitor.lvalues;
+  REQUIRE_EQ(g_lvalues.size(), 14);
+  ControlFlowGraph g_cfg(g_func);
+  FlowVariables g_vars(g_func);
+  TailslideOperationBehavior behavior(&parser.allocator);
+  ConstantPropagation constants(g_cfg, g_vars, &behavior, &parser.allocator);
+  auto int_value = [&](int i) -> int {
+    auto *cv = constants.getConstantValue(g_lvalues[i]);
+    REQUIRE(cv);
+    REQUIRE_EQ(cv->getIType(), LST_INTEGER);
+    return ((LSLIntegerConstant *)cv)->getValue();
+  };
+  CHECK_EQ(int_value(8), 1);
+  // both branches agree on what `y` is
+  CHECK_EQ(int_value(10), 2);
+  CHECK_EQ(int_value(12), 4);
+  auto *f_cv = constants.getConstantValue(g_lvalues[9]);
+  REQUIRE(f_cv);
+  CHECK_EQ(f_cv->getIType(), LST_FLOATINGPOINT);
+  CHECK_EQ(((LSLFloatConstant *)f_cv)->getValue(), 1.0);
+  // changed within the loop
+  CHECK_EQ(constants.getConstantValue(g_lvalues[11]), nullptr);
+  CHECK_EQ(constants.getConstantValue(g_lvalues[13]), nullptr);
+
+  // `i`'s declaration may be jumped over, so it isn't necessarily 5
+  auto *h_func = script->getGlobals()->getChild(2);
+  LValueCollectingVisitor h_visitor;
+  h_func->visit(&h_visitor);
+  REQUIRE_EQ(h_visitor.lvalues.size(), 2);
+  ControlFlowGraph h_cfg(h_func);
+  FlowVariables h_vars(h_func);
+  ConstantPropagation h_constants(h_cfg, h_vars, &behavior, &parser.allocator);
+  CHECK_EQ(h_constants.getConstantValue(h_visitor.lvalues[1]), nullptr);
+}
+
+TEST_CASE("Pass profiler") {
+  PassProfiler profiler(3);
+  ScopedScriptParser parser(nullptr);
+  parser.context.profiler = &profiler;
+  profiler.setScriptName("test.lsl");
+  const char *script_src = "integer foo = 1; default { state_entry() { llOwnerSay((string)(foo + 2)); } }";
+  auto *script = parser.parseLSLBytes(script_src, (int)strlen(script_src));
+  REQUIRE(script);
+  script->analyze();
+  script->optimize(OptimizationOptions{});
+
+  auto find_record = [&](const char *name) -> const PassRecord * {
+    for (auto &record : profiler.getRecords()) {
+      if (!strcmp(record.name, name))
+        return &record;
+    }
+    return nullptr;
+  };
+  auto *parse_record = find_record("parse");
+  REQUIRE(parse_record);
+  CHECK_EQ(parse_record->depth, 0);
+  CHECK_EQ(parse_record->thread_id, 3);
+  CHECK_EQ(parse_record->script, "test.lsl");
+  CHECK_GT(parse_record->allocations, 0);
+  auto *symbols_record = find_record("symbols");
+  REQUIRE(symbols_record);
+  // nested inside of `analyze()`
+  CHECK_EQ(symbols_record->depth, 1);
+  CHECK_GT(symbols_record->nodes_visited, 0);
+  CHECK_GT(symbols_record->symbol_lookups, 0);
+  CHECK(find_record("optimize"));
+
+  std::stringstream trace;
+  profiler.writeTrace(trace);
+  CHECK_NE(trace.str().find("\"name\": \"types\""), std::string::npos);
+}
+
+TEST_CASE("JSON string escaping") {
+  CHECK_EQ(json_escape("`x' declared"), "`x' declared");
+  CHECK_EQ(json_escape("a\"b\\c\nd\te\x01"), "a\\\"b\\\\c\\nd\\te\\u0001");
+  // UTF-8 passes through untouched
+  CHECK_EQ(json_escape("caf\xc3\xa9"), "caf\xc3\xa9");
+}
+
+TEST_CASE("Builtins table lookup") {
+  ScopedScriptParser parser(nullptr);
+  LSLSymbolTable *builtins = parser.context.builtins;
+
+  auto *func_sym = builtins->lookup("llList2Integer", SYM_FUNCTION);
+  REQUIRE(func_sym);
+  CHECK_EQ(func_sym->getIType(), LST_INTEGER);
+  CHECK_EQ(func_sym->getFunctionDecl()->getNumChildren(), 2);
+  CHECK_EQ(builtins->lookup("llList2Integer", SYM_VARIABLE), nullptr);
+  CHECK_EQ(builtins->lookup("state_entry", SYM_EVENT)->getSymbolType(), SYM_EVENT);
+
+  auto *int_const = (LSLIntegerConstant *)builtins->lookup("DEBUG_CHANNEL")->getConstantValue();
+  CHECK_EQ(int_const->getValue(), 2147483647);
+  auto *str_const = (LSLStringConstant *)builtins->lookup("NULL_KEY")->getConstantValue();
+  CHECK_EQ(strcmp(str_const->getValue(), "00000000-0000-0000-0000-000000000000"), 0);
+  auto *vec_const = (LSLVectorConstant *)builtins->lookup("ZERO_VECTOR")->getConstantValue();
+  CHECK_EQ(vec_const->getValue()->z, 0.0f);
+
+  CHECK_EQ(builtins->lookup("llNotARealFunction"), nullptr);
+  CHECK_EQ(builtins->lookup(""), nullptr);
+  CHECK_EQ(find_builtin_entry("llList2"), -1);
+}
+
+TEST_CASE("Builtins loaded from a file") {
+  namespace fs = std::filesystem;
+  auto builtins_path = fs::temp_directory_path() / ("tailslide-builtins-test-" + std::to_string(std::random_device()()));
+  {
+    std::ofstream builtins_file(builtins_path);
+    builtins_file << "// only what the script needs\n"
+                  << "void llOwnerSay(string msg)\n"
+                  << "event state_entry()\n"
+                  << "const float PI = 3.14159265\n";
+  }
+
+  // these have no perfect hash and are interned somewhere other than the script's allocator
+  ScriptAllocator builtins_allocator;
+  ScriptContext builtins_ctx;
+  builtins_ctx.allocator = &builtins_allocator;
+  builtins_allocator.setContext(&builtins_ctx);
+  LSLSymbolTable builtins{nullptr, SYMTAB_BUILTINS};
+  tailslide_load_builtins_file(builtins_path.string().c_str(), &builtins, &builtins_allocator);
+  fs::remove(builtins_path);
+  CHECK_NE(builtins.lookup("PI"), nullptr);
+
+  ScopedScriptParser parser(&builtins);
+  std::string source = "default { state_entry() { llOwnerSay((string)PI); } }";
+  auto *script = parser.parseLSLBytes(source.c_str(), (int)source.size());
+  REQUIRE(script);
+  script->analyze(true);
+  CHECK_EQ(parser.logger.getErrors(), 0);
+}
+
 TEST_CASE("BitStream int writing") {
   BitStream bs_big(ENDIAN_BIG);
   bs_big << (int32_t)1 << (uint16_t)2;
@@ -59,6 +811,48 @@ TEST_CASE("BitStream int reading") {
   CHECK_EQ(val_2, 2);
 }
 
+TEST_CASE("BitStream fixed endianness writing") {
+  BitStream bs(ENDIAN_LITTLE);
+  bs.writeValue<ENDIAN_BIG>((int32_t)1);
+  bs << (int32_t)1;
+  CHECK_EQ(bs.data()[3], 0x01);
+  CHECK_EQ(bs.data()[4], 0x01);
+
+  int32_t val;
+  bs.moveTo(0);
+  bs.readValue<ENDIAN_BIG>(val);
+  CHECK_EQ(val, 1);
+  bs >> val;
+  CHECK_EQ(val, 1);
+}
+
+TEST_CASE("BitStream growth") {
+  BitStream bs;
+  size_t reallocs = 0;
+  size_t alloc_size = bs.allocatedSize();
+  for (int i = 0; i < 10000; ++i) {
+    bs << (uint8_t)i;
+    if (bs.allocatedSize() != alloc_size) {
+      ++reallocs;
+      alloc_size = bs.allocatedSize();
+    }
+  }
+  CHECK_EQ(bs.size(), 10000);
+  CHECK_EQ(bs.data()[9999], (uint8_t)9999);
+  // doubling, not growing by a fixed step each time
+  CHECK_LT(reallocs, 20);
+
+  // reserving up front shouldn't change the size or need any more reallocs
+  BitStream reserved;
+  reserved.reserve(10000);
+  CHECK_EQ(reserved.size(), 0);
+  CHECK_EQ(reserved.allocatedSize(), 10000);
+  for (int i = 0; i < 10000; ++i)
+    reserved << (uint8_t)i;
+  CHECK_EQ(reserved.allocatedSize(), 10000);
+  CHECK_EQ(reserved, bs);
+}
+
 TEST_CASE("Bitstream equality") {
   BitStream bs1, bs2, bs3;
   bs1 << "foobar";
@@ -132,4 +926,365 @@ TEST_CASE("LLoc comparison works correctly") {
   CHECK(smaller_sameline < bigger);
 }
 
+TEST_CASE("Generated scripts are valid") {
+  ScriptShape small_shape {};
+  ScriptShape empty_shape {};
+  empty_shape.globals = 0;
+  empty_shape.functions = 0;
+  empty_shape.states = 0;
+  empty_shape.handlers = 0;
+  empty_shape.list_size = 0;
+  empty_shape.concat_length = 0;
+  ScriptShape big_shape {};
+  big_shape.globals = 40;
+  big_shape.functions = 30;
+  big_shape.states = 5;
+  big_shape.handlers = 100;
+  big_shape.nesting_depth = 12;
+  big_shape.list_size = 50;
+  big_shape.concat_length = 60;
+  big_shape.seed = 1234;
+
+  for (auto &shape : {small_shape, empty_shape, big_shape}) {
+    std::string source = generate_lsl_script(shape);
+    CHECK_EQ(source, generate_lsl_script(shape));
+    ScopedScriptParser parser(nullptr);
+    auto *script = parser.parseLSLBytes(source.c_str(), (int)source.size());
+    REQUIRE_NE(script, nullptr);
+    script->analyze();
+    CHECK_EQ(parser.logger.getErrors(), 0);
+  }
+}
+
+TEST_CASE("Compile cache") {
+  namespace fs = std::filesystem;
+  auto cache_dir = fs::temp_directory_path() / ("tailslide-cache-test-" + std::to_string(std::random_device()()));
+  CompileCache cache(cache_dir, 1024 * 1024);
+
+  std::string source = "default{state_entry(){}}";
+  auto key = CompileCache::makeKey(source, {}, {}, {}, 0);
+  CHECK_EQ(key, CompileCache::makeKey(source, {}, {}, {}, 0));
+  CHECK_EQ(key.size(), 64);
+  CHECK_EQ(CacheKeyBuilder().finish(), "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+  CHECK_EQ(CacheKeyBuilder().addBytes("abc", 3).finish(),
+           "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+  // everything that might change the output should change the key
+  CHECK_NE(key, CompileCache::makeKey(source + " ", {}, {}, {}, 0));
+  CHECK_NE(key, CompileCache::makeKey(source, {}, {}, {}, 1));
+  OptimizationOptions optim_opts {};
+  optim_opts.fold_constants = true;
+  CHECK_NE(key, CompileCache::makeKey(source, optim_opts, {}, {}, 0));
+  PrettyPrintOpts pretty_opts {};
+  pretty_opts.mangle_func_names = true;
+  CHECK_NE(key, CompileCache::makeKey(source, {}, pretty_opts, {}, 0));
+  MonoCompilationOptions mono_opts {};
+  mono_opts.omit_unnecessary_pushes = true;
+  CHECK_NE(key, CompileCache::makeKey(source, {}, {}, mono_opts, 0));
+
+  CompileResult result;
+  CHECK_FALSE(cache.lookup(key, result));
+
+  CompileResult stored;
+  stored.parsed = true;
+  stored.warnings = 2;
+  stored.diagnostics = "TOTAL:: Errors: 0  Warnings: 2\n";
+  stored.messages.push_back({LOG_WARN, W_EMPTY_IF, {3, 4, 3, 9}, "Empty if statement."});
+  stored.pretty = "default\n{\n}\n";
+  stored.lso = std::string("\0\1\2", 3);
+  REQUIRE(cache.store(key, stored));
+  REQUIRE(cache.lookup(key, result));
+  CHECK(result.parsed);
+  CHECK_EQ(result.errors, 0);
+  CHECK_EQ(result.warnings, 2);
+  CHECK_EQ(result.diagnostics, stored.diagnostics);
+  REQUIRE_EQ(result.messages.size(), 1);
+  CHECK_EQ(result.messages[0].level, LOG_WARN);
+  CHECK_EQ(result.messages[0].code, W_EMPTY_IF);
+  CHECK_EQ(result.messages[0].loc.last_column, 9);
+  CHECK_EQ(result.messages[0].message, stored.messages[0].message);
+  CHECK_EQ(result.pretty, stored.pretty);
+  CHECK_EQ(result.lso, stored.lso);
+  CHECK(result.cil.empty());
+  CHECK_EQ(cache.getHits(), 1);
+  CHECK_EQ(cache.getMisses(), 1);
+
+  // truncated entries are treated as misses
+  fs::path entry_path;
+  for (auto &entry : fs::recursive_directory_iterator(cache_dir)) {
+    if (entry.is_regular_file())
+      entry_path = entry.path();
+  }
+  REQUIRE_FALSE(entry_path.empty());
+  fs::resize_file(entry_path, fs::file_size(entry_path) - 1);
+  CHECK_FALSE(cache.lookup(key, result));
+
+  // trimming a cache that's too big evicts the oldest entries first
+  CompileCache small_cache(cache_dir, 1);
+  REQUIRE(small_cache.store(key, stored));
+  small_cache.trim();
+  CHECK_FALSE(small_cache.lookup(key, result));
+
+  // storing enough trims the cache without anyone calling `trim()`
+  CompileCache bounded_cache(cache_dir, 8 * 1024);
+  stored.pretty = std::string(1024, 'x');
+  for (int i = 0; i < 64; ++i)
+    REQUIRE(bounded_cache.store(CompileCache::makeKey(source, {}, {}, {}, i), stored));
+  uint64_t total_size = 0;
+  for (auto &entry : fs::recursive_directory_iterator(cache_dir)) {
+    if (entry.is_regular_file())
+      total_size += entry.file_size();
+  }
+  CHECK_LE(total_size, 8 * 1024 + 2048);
+
+  fs::remove_all(cache_dir);
+}
+
+TEST_CASE("Operator and coercion lookup tables match the table scans") {
+  for (int from = 0; from < LST_MAX; ++from) {
+    for (int to = 0; to < LST_MAX; ++to) {
+      CAPTURE(from);
+      CAPTURE(to);
+      CHECK_EQ(TYPE((LSLIType)from)->canCoerce(TYPE((LSLIType)to)),
+               can_coerce_by_scan(TYPE((LSLIType)from), TYPE((LSLIType)to)));
+    }
+  }
+
+  int num_valid = 0;
+  for (int op = 0; op < 256; ++op) {
+    for (int left = 0; left < LST_MAX; ++left) {
+      // LST_MAX stands in for no right-hand side
+      for (int right = 0; right <= LST_MAX; ++right) {
+        auto *left_type = TYPE((LSLIType)left);
+        auto *right_type = right == LST_MAX ? nullptr : TYPE((LSLIType)right);
+        auto *expected = get_result_type_by_scan(left_type, (LSLOperator)op, right_type);
+        auto *actual = left_type->getResultType((LSLOperator)op, right_type);
+        if (actual != expected) {
+          CAPTURE(op);
+          CAPTURE(left);
+          CAPTURE(right);
+          CHECK_EQ(actual, expected);
+        }
+        num_valid += expected != nullptr;
+      }
+    }
+  }
+  // make sure the scan found something
+  CHECK_GT(num_valid, 150);
+}
+
+TEST_CASE("Logger filters and deferred formatting") {
+  ScopedScriptParser parser(nullptr);
+  Logger &logger = parser.logger;
+  YYLTYPE loc {2, 3, 2, 8};
+
+  char name[] = "foo";
+  logger.error(&loc, E_MEMBER_NOT_VARIABLE, name, "x", "function");
+  // the argument's our copy, not the caller's buffer
+  name[0] = 'b';
+  REQUIRE_EQ(logger.getMessages().size(), 1);
+  auto *message = logger.getMessages()[0];
+  CHECK_EQ(message->getMessage(), "ERROR:: (  2,  3): [E10009] Trying to access `foo.x', but `foo' is a function");
+  logger.relocateMessage(message, {4, 1, 4, 2});
+  CHECK_EQ(message->getMessage(), "ERROR:: (  4,  1): [E10009] Trying to access `foo.x', but `foo' is a function");
+
+  logger.suppressCode(W_DECLARED_BUT_NOT_USED);
+  logger.error(&loc, W_DECLARED_BUT_NOT_USED, "variable", "bar");
+  CHECK_EQ(logger.getWarnings(), 0);
+  // suppressed errors still count
+  logger.suppressCode(E_UNDECLARED);
+  logger.error(&loc, E_UNDECLARED, "baz");
+  CHECK_EQ(logger.getErrors(), 2);
+  CHECK_EQ(logger.getMessages().size(), 1);
+
+  logger.setMaxLevel(LOG_ERROR);
+  logger.error(&loc, W_EMPTY_IF);
+  CHECK_EQ(logger.getWarnings(), 0);
+  logger.setMaxLevel(LOG_WARN);
+  logger.setStoreMessages(false);
+  logger.error(&loc, W_EMPTY_IF);
+  logger.error(&loc, E_UNDECLARED_WITH_SUGGESTION, "qux", "quux");
+  CHECK_EQ(logger.getWarnings(), 1);
+  CHECK_EQ(logger.getErrors(), 3);
+  CHECK_EQ(logger.getMessages().size(), 1);
+
+  // conversions that can't be deferred get formatted right away
+  logger.setStoreMessages(true);
+  logger.log(LOG_ERROR, &loc, "%.2f and %lu and %x%%", 1.5, 12UL, 255);
+  REQUIRE_EQ(logger.getMessages().size(), 2);
+  CHECK_EQ(logger.getMessages()[1]->getText(), "1.50 and 12 and ff%");
+}
+
+// Everything about a script that we'd expect to survive serialization.
+// Compiling de-sugars the tree, so compiled scripts may not be optimized afterwards.
+static std::string describe_script(ScopedScriptParser &parser, bool compile) {
+  TreePrintingVisitor tree_visitor;
+  parser.script->visit(&tree_visitor);
+  PrettyPrintOpts pretty_opts {};
+  pretty_opts.mangle_func_names = true;
+  pretty_opts.mangle_global_names = true;
+  pretty_opts.mangle_local_names = true;
+  pretty_opts.show_unmangled = true;
+  parser.table_manager.setMangledNames();
+  PrettyPrintVisitor pretty_visitor(pretty_opts);
+  parser.script->visit(&pretty_visitor);
+  std::string description = tree_visitor.mStream.str() + pretty_visitor.mStream.str();
+  if (!compile)
+    return description;
+  LSOScriptCompiler lso_visitor(&parser.allocator);
+  parser.script->visit(&lso_visitor);
+  MonoScriptCompiler mono_visitor(&parser.allocator);
+  parser.script->visit(&mono_visitor);
+  return description + std::string((const char *)lso_visitor.mScriptBS.data(), lso_visitor.mScriptBS.size())
+      + mono_visitor.mCIL.str();
+}
+
+TEST_CASE("AST serialization round-trips") {
+  namespace fs = std::filesystem;
+  fs::path scripts_dir = fs::path(__FILE__).parent_path() / "scripts";
+  OptimizationOptions optim_opts {};
+  optim_opts.fold_constants = true;
+  optim_opts.prune_unused_locals = true;
+  optim_opts.prune_unused_globals = true;
+  optim_opts.prune_unused_functions = true;
+
+  int num_checked = 0;
+  for (auto &entry : fs::directory_iterator(scripts_dir)) {
+    if (entry.path().extension() != ".lsl")
+      continue;
+    CAPTURE(entry.path());
+    ScopedScriptParser parser(nullptr);
+    parser.parseLSLFile(entry.path().string());
+    if (!parser.script)
+      continue;
+    // LSO semantics are stricter, anything that passes can be compiled either way.
+    parser.script->analyze(false);
+    if (parser.logger.getErrors())
+      continue;
+
+    std::string serialized = serialize_script(parser.script);
+    ScopedScriptParser loaded(nullptr);
+    REQUIRE_NE(loaded.loadSerialized(serialized.data(), serialized.size()), nullptr);
+    CHECK_EQ(loaded.ast_sane, parser.ast_sane);
+    CHECK_EQ(describe_script(loaded, false), describe_script(parser, false));
+
+    // symbol usage and the like have to come back too for the optimizer to do the same thing
+    parser.script->optimize(optim_opts);
+    loaded.script->optimize(optim_opts);
+
+    // and optimized scripts should survive another trip
+    serialized = serialize_script(parser.script);
+    ScopedScriptParser reloaded(nullptr);
+    REQUIRE_NE(reloaded.loadSerialized(serialized.data(), serialized.size()), nullptr);
+
+    std::string expected = describe_script(parser, true);
+    CHECK_EQ(describe_script(loaded, true), expected);
+    CHECK_EQ(describe_script(reloaded, true), expected);
+    ++num_checked;
+  }
+  CHECK_GT(num_checked, 20);
+}
+
+TEST_CASE("Bad serialized ASTs are rejected") {
+  std::string source = "integer g = 1; f(integer p) { @l; jump l; } default{state_entry(){ f(g + (integer)\"2\"); }}";
+  ScopedScriptParser parser(nullptr);
+  REQUIRE_NE(parser.parseLSLBytes(source.c_str(), (int)source.size()), nullptr);
+  parser.script->analyze();
+  std::string serialized = serialize_script(parser.script);
+
+  ScopedScriptParser loaded(nullptr);
+  REQUIRE_NE(loaded.loadSerialized(serialized.data(), serialized.size()), nullptr);
+  loaded.reset();
+  // truncated
+  CHECK_EQ(loaded.loadSerialized(serialized.data(), serialized.size() - 1), nullptr);
+  loaded.reset();
+  CHECK_EQ(loaded.loadSerialized(serialized.data(), sizeof(SerializedHeader) - 1), nullptr);
+  loaded.reset();
+  // wrong magic
+  std::string bad_magic = serialized;
+  bad_magic[0] = 'X';
+  CHECK_EQ(loaded.loadSerialized(bad_magic.data(), bad_magic.size()), nullptr);
+  loaded.reset();
+  // a node referring to a child that doesn't exist
+  std::string bad_ref = serialized;
+  SerializedHeader header {};
+  memcpy(&header, bad_ref.data(), sizeof(header));
+  uint32_t bogus_child = header.nodes.count + 1;
+  memcpy(&bad_ref[header.refs.offset], &bogus_child, sizeof(bogus_child));
+  CHECK_EQ(loaded.loadSerialized(bad_ref.data(), bad_ref.size()), nullptr);
+}
+
+
+// Report lines in a stable order, messages at the same position may come out in either order.
+static std::string describe_incremental(IncrementalScript &inc) {
+  std::string description;
+  if (inc.getScript()) {
+    ScopedScriptParser &parser = inc.getParser();
+    description = describe_script(parser, false);
+  }
+  std::vector<std::string> lines;
+  std::istringstream report(inc.getLogger().formatReport());
+  for (std::string line; std::getline(report, line);)
+    lines.push_back(line);
+  std::sort(lines.begin(), lines.end());
+  for (auto &line : lines)
+    description += line + '\n';
+  return description;
+}
+
+TEST_CASE("Incremental edits match a full re-parse") {
+  namespace fs = std::filesystem;
+  fs::path scripts_dir = fs::path(__FILE__).parent_path() / "scripts";
+
+  int num_checked = 0;
+  int num_incremental = 0;
+  for (auto &entry : fs::directory_iterator(scripts_dir)) {
+    if (entry.path().extension() != ".lsl")
+      continue;
+    CAPTURE(entry.path());
+    std::ifstream file(entry.path(), std::ios::binary);
+    std::string source((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    IncrementalScript inc;
+    inc.setSource(source);
+    if (!inc.getScript())
+      continue;
+    // edit just inside the body of every function and state, and the gaps between them.
+    std::vector<size_t> offsets;
+    for (size_t i = 0; i < source.size(); ++i) {
+      if (source[i] == '{' && i + 1 < source.size() && source[i + 1] == '\n')
+        offsets.push_back(i + 1);
+    }
+    if (offsets.size() > 6)
+      offsets.resize(6);
+    offsets.push_back(source.size());
+
+    const char *edits[] = {"\n\n", "  ", "integer zz;", "integer zz = 1; zz += 2;"};
+    for (size_t offset : offsets) {
+      for (const char *text : edits) {
+        CAPTURE(offset);
+        CAPTURE(text);
+        std::string inserted = text;
+        size_t edit_offset = std::min(offset, inc.getSource().size());
+        REQUIRE(inc.applyEdit(edit_offset, 0, inserted));
+        num_incremental += inc.wasIncremental();
+
+        IncrementalScript expected;
+        expected.setSource(inc.getSource());
+        CHECK_EQ(describe_incremental(inc), describe_incremental(expected));
+
+        // and take it back out again
+        REQUIRE(inc.applyEdit(edit_offset, inserted.size(), ""));
+        num_incremental += inc.wasIncremental();
+        REQUIRE_EQ(inc.getSource(), source);
+        IncrementalScript original;
+        original.setSource(source);
+        CHECK_EQ(describe_incremental(inc), describe_incremental(original));
+      }
+    }
+    ++num_checked;
+  }
+  CHECK_GT(num_checked, 20);
+  CHECK_GT(num_incremental, 100);
+}
+
 TEST_SUITE_END();